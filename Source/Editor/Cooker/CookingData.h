@@ -219,6 +219,16 @@ DECLARE_SCRIPTING_TYPE(CookingData);
         /// </summary>
         uint64 ContentSize = 0;
 
+        /// <summary>
+        /// The amount of assets of that type cooked in a build (excluding the ones reused from the cache).
+        /// </summary>
+        int32 CookedCount = 0;
+
+        /// <summary>
+        /// The total time (in seconds) spent on cooking the assets of that type (summed over all cooking threads).
+        /// </summary>
+        double CookTime = 0.0;
+
         bool operator<(const AssetTypeStatistics& other) const;
     };
 
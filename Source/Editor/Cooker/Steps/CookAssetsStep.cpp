@@ -5,12 +5,14 @@
 #include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/BinaryAsset.h"
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Content/AssetReference.h"
+#include "Engine/Content/ContentLoadTrace.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Texture.h"
@@ -35,6 +37,7 @@
 #include "Engine/Engine/Base/GameBase.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
+#include "Engine/Threading/Task.h"
 #if PLATFORM_TOOLS_WINDOWS
 #include "Engine/Platform/Windows/WindowsPlatformSettings.h"
 #endif
@@ -77,24 +80,34 @@ bool CookAssetsStep::CacheEntry::IsValid(bool withDependencies)
     return false;
 }
 
-CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const JsonAssetBase* asset, String& cachedFilePath)
+void CookAssetsStep::CacheData::SetupEntry(const JsonAssetBase* asset, CacheEntry& entry, String& cachedFilePath) const
 {
     ASSERT(asset->DataTypeName.HasChars());
-    auto& entry = Entries[asset->GetID()];
     entry.ID = asset->GetID();
     entry.TypeName = asset->DataTypeName;
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
-    return entry;
 }
 
-CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const Asset* asset, String& cachedFilePath)
+void CookAssetsStep::CacheData::SetupEntry(const Asset* asset, CacheEntry& entry, String& cachedFilePath) const
 {
-    auto& entry = Entries[asset->GetID()];
     entry.ID = asset->GetID();
     entry.TypeName = asset->GetTypeName();
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
+}
+
+CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const JsonAssetBase* asset, String& cachedFilePath)
+{
+    auto& entry = Entries[asset->GetID()];
+    SetupEntry(asset, entry, cachedFilePath);
+    return entry;
+}
+
+CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const Asset* asset, String& cachedFilePath)
+{
+    auto& entry = Entries[asset->GetID()];
+    SetupEntry(asset, entry, cachedFilePath);
     return entry;
 }
 
@@ -343,7 +356,7 @@ bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
     return false;
 }
 
-bool CookAssetsStep::Process(CookingData& data, CacheData& cache, Asset* asset)
+bool CookAssetsStep::Process(CookingData& data, const CacheData& cache, Asset* asset, CacheEntry& entry)
 {
     // Validate asset
     if (asset->IsVirtual())
@@ -360,10 +373,10 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, Asset* asset)
     // Switch based on an asset type
     const auto asBinaryAsset = dynamic_cast<BinaryAsset*>(asset);
     if (asBinaryAsset)
-        return Process(data, cache, asBinaryAsset);
+        return Process(data, cache, asBinaryAsset, entry);
     const auto asJsonAsset = dynamic_cast<JsonAssetBase*>(asset);
     if (asJsonAsset)
-        return Process(data, cache, asJsonAsset);
+        return Process(data, cache, asJsonAsset, entry);
 
     LOG(Error, "Unknown asset type \'{0}\'", asset->GetTypeName());
     return false;
@@ -749,7 +762,7 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
 }
 
-bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
+bool CookAssetsStep::Process(CookingData& data, const CacheData& cache, BinaryAsset* asset, CacheEntry& entry)
 {
     ASSERT(asset->IsLoaded() && asset->Storage != nullptr);
     FileDependenciesList fileDependencies;
@@ -791,7 +804,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
 
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
+    cache.SetupEntry(asset, entry, cachedFilePath);
     entry.FileDependencies = MoveTemp(fileDependencies);
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
@@ -806,7 +819,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
     return false;
 }
 
-bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase* asset)
+bool CookAssetsStep::Process(CookingData& data, const CacheData& cache, JsonAssetBase* asset, CacheEntry& entry)
 {
     ASSERT(asset->IsLoaded() && asset->Data != nullptr);
     FileDependenciesList fileDependencies;
@@ -835,7 +848,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
 
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
+    cache.SetupEntry(asset, entry, cachedFilePath);
     entry.FileDependencies = MoveTemp(fileDependencies);
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
@@ -850,6 +863,147 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
     return false;
 }
 
+/// <summary>
+/// Helper utility to layout the assets data in the packages using the recorded assets load traces (see Content::BeginLoadTrace).
+/// </summary>
+struct PackagesLayout
+{
+    struct ChunkLocation
+    {
+        int32 Package;
+        int32 Position;
+    };
+
+    struct AssetData
+    {
+        uint64 Size;
+        uint32 ChunksMask;
+    };
+
+    struct OrderedChunk
+    {
+        int32 Order;
+        FlaxChunk* Chunk;
+
+        bool operator<(const OrderedChunk& other) const
+        {
+            return Order < other.Order;
+        }
+    };
+
+    typedef Dictionary<Pair<Guid, int32>, ChunkLocation> Locations;
+
+    // The loaded traces (the first scene goes first)
+    Array<ContentLoadTrace> Traces;
+
+    // The first use order of the asset data chunks (over all traces)
+    Dictionary<Pair<Guid, int32>, int32> FirstUse;
+
+    // The final location of the asset data chunks in packages
+    Locations ChunkLocations;
+
+    // The packaged assets data
+    Dictionary<Guid, AssetData> Assets;
+
+    bool Load(const Guid& firstScene)
+    {
+        // Traces recorded by the cooked game (in its local data folder) need to be copied into this folder to be used
+        Array<String> files;
+        const String folder = Content::GetLoadTracesFolder();
+        if (!FileSystem::DirectoryExists(folder) || FileSystem::DirectoryGetFiles(files, folder, TEXT("*.trace"), DirectorySearchOption::TopDirectoryOnly))
+            return false;
+        Sorting::QuickSort(files.Get(), files.Count());
+        for (const String& file : files)
+        {
+            ContentLoadTrace trace;
+            if (trace.Load(file))
+                continue;
+            if (trace.Name == firstScene)
+                Traces.Insert(0, MoveTemp(trace));
+            else
+                Traces.Add(MoveTemp(trace));
+        }
+        for (const ContentLoadTrace& trace : Traces)
+        {
+            for (const ContentLoadTraceEvent& e : trace.Events)
+            {
+                const auto key = ToPair(e.AssetId, e.ChunkIndex);
+                if (e.ChunkIndex >= 0 && !FirstUse.ContainsKey(key))
+                    FirstUse.Add(key, FirstUse.Count());
+            }
+        }
+        return Traces.HasItems();
+    }
+
+    void GetAssetsOrder(const AssetsCache::Registry& registry, Array<Guid>& result) const
+    {
+        // Assets in the first use order, then the remaining ones
+        HashSet<Guid> added;
+        for (const ContentLoadTrace& trace : Traces)
+        {
+            for (const ContentLoadTraceEvent& e : trace.Events)
+            {
+                if (registry.ContainsKey(e.AssetId) && added.Add(e.AssetId))
+                    result.Add(e.AssetId);
+            }
+        }
+        for (auto i = registry.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (added.Add(i->Key))
+                result.Add(i->Key);
+        }
+    }
+
+    void GetDefaultLocations(const AssetsCache::Registry& registry, int32 maxAssetsPerPackage, uint64 maxPackageSize, Locations& result) const
+    {
+        // Simulate the packaging in the registry order with the default chunks layout
+        int32 packageIndex = 0, packageAssets = 0, position = 0;
+        uint64 packageSize = 0;
+        for (auto i = registry.Begin(); i.IsNotEnd(); ++i)
+        {
+            const AssetData* asset = Assets.TryGet(i->Key);
+            if (!asset)
+                continue;
+            if (packageAssets + 1 > maxAssetsPerPackage || packageSize + asset->Size > maxPackageSize)
+            {
+                if (packageAssets != 0)
+                {
+                    packageIndex++;
+                    packageAssets = 0;
+                    packageSize = 0;
+                    position = 0;
+                }
+            }
+            packageAssets++;
+            packageSize += asset->Size;
+            for (int32 j = 0; j < ASSET_FILE_DATA_CHUNKS; j++)
+            {
+                if (asset->ChunksMask & (1u << j))
+                    result.Add(ToPair(i->Key, j), { packageIndex, position++ });
+            }
+        }
+    }
+
+    static int32 CountSeeks(const ContentLoadTrace& trace, const Locations& locations, int32& reads)
+    {
+        // Every read that doesn't continue right after the previous one requires a seek (including the first one)
+        int32 seeks = 0;
+        ChunkLocation prev = { -1, -1 };
+        reads = 0;
+        for (const ContentLoadTraceEvent& e : trace.Events)
+        {
+            const ChunkLocation* location = e.ChunkIndex >= 0 ? locations.TryGet(ToPair(e.AssetId, e.ChunkIndex)) : nullptr;
+            if (!location)
+                continue;
+            reads++;
+            if (location->Package != prev.Package || location->Position != prev.Position + 1)
+                seeks++;
+            prev = *location;
+        }
+        return seeks;
+    }
+};
+
 /// <summary>
 /// Helper utility to build a package of set of assets (using limits parameters).
 /// </summary>
@@ -858,6 +1012,7 @@ class PackageBuilder : public NonCopyable
 private:
 
     int32 _packageIndex;
+    PackagesLayout* _layout;
     int32 MaxAssetsPerPackage;
     int32 MaxPackageSize;
     FlaxStorage::CustomData CustomData;
@@ -876,8 +1031,10 @@ class PackageBuilder : public NonCopyable
     /// <param name="maxAssetsPerPackage">The maximum assets per package.</param>
     /// <param name="maxPackageSizeMB">The maximum package size in MB.</param>
     /// <param name="contentKey">The content keycode.</param>
-    PackageBuilder(int32 maxAssetsPerPackage, int32 maxPackageSizeMB, int32 contentKey)
+    /// <param name="layout">The packages layout to use for the chunks data order (optional).</param>
+    PackageBuilder(int32 maxAssetsPerPackage, int32 maxPackageSizeMB, int32 contentKey, PackagesLayout* layout = nullptr)
         : _packageIndex(0)
+        , _layout(layout)
         , MaxAssetsPerPackage(maxAssetsPerPackage)
         , MaxPackageSize(maxPackageSizeMB * (1024 * 1024))
         , files(maxAssetsPerPackage)
@@ -931,6 +1088,8 @@ class PackageBuilder : public NonCopyable
         // Add
         addedEntries.Add(&entry);
         bytesAdded += size;
+        if (_layout)
+            _layout->Assets[entry.Info.ID].Size = size;
 
         // Gather the asset to package it later
         auto file = New<FlaxFile>(sourcePath);
@@ -976,11 +1135,48 @@ class PackageBuilder : public NonCopyable
             }
         }
 
+        // Layout the chunks data in the first use order, then the remaining ones in the default order
+        Array<FlaxChunk*> chunksOrder;
+        if (_layout)
+        {
+            Array<PackagesLayout::OrderedChunk> orderedChunks;
+            Dictionary<FlaxChunk*, Pair<Guid, int32>> chunksOwners;
+            for (int32 i = 0; i < count; i++)
+            {
+                const auto& header = assetsData[i].Header;
+                uint32 chunksMask = 0;
+                for (int32 j = 0; j < ASSET_FILE_DATA_CHUNKS; j++)
+                {
+                    if (header.Chunks[j] == nullptr)
+                        continue;
+                    chunksMask |= 1u << j;
+                    chunksOwners.Add(header.Chunks[j], ToPair(header.ID, j));
+                    const int32* order = _layout->FirstUse.TryGet(ToPair(header.ID, j));
+                    if (order)
+                        orderedChunks.Add({ *order, header.Chunks[j] });
+                }
+                _layout->Assets[header.ID].ChunksMask = chunksMask;
+            }
+            Sorting::QuickSort(orderedChunks.Get(), orderedChunks.Count());
+            for (const auto& e : orderedChunks)
+                chunksOrder.Add(e.Chunk);
+            for (int32 i = 0; i < count; i++)
+                assetsData[i].Header.GetLoadedChunks(chunksOrder);
+            HashSet<FlaxChunk*> addedChunks;
+            int32 position = 0;
+            for (FlaxChunk* chunk : chunksOrder)
+            {
+                Pair<Guid, int32> owner;
+                if (addedChunks.Add(chunk) && chunksOwners.TryGet(chunk, owner))
+                    _layout->ChunkLocations[owner] = { _packageIndex, position++ };
+            }
+        }
+
         // Create package
         // Note: FlaxStorage::Create overrides chunks locations in file so don't use files anymore (only readonly)
         const String localPath = String::Format(TEXT("Content/Data_{0}.{1}"), _packageIndex, PACKAGE_FILES_EXTENSION);
         const String path = data.DataOutputPath / localPath;
-        if (FlaxStorage::Create(path, assetsData, false, &CustomData))
+        if (FlaxStorage::Create(path, assetsData, false, &CustomData, &chunksOrder))
         {
             data.Error(TEXT("Failed to create assets package."));
             return true;
@@ -1000,6 +1196,57 @@ class PackageBuilder : public NonCopyable
     }
 };
 
+/// <summary>
+/// The asset to cook (item of the cooking work list).
+/// </summary>
+struct CookAssetsWorkItem
+{
+    Guid AssetId;
+    int32 Cost;
+    int32 Index;
+
+    bool operator<(const CookAssetsWorkItem& other) const
+    {
+        // Start with the most expensive assets to reduce the time when only a few threads are busy at the end, keep the original order otherwise
+        if (Cost != other.Cost)
+            return Cost > other.Cost;
+        return Index < other.Index;
+    }
+};
+
+/// <summary>
+/// The result of the asset cooking (written by the worker thread, committed into the cache in the work list order by the cooking thread).
+/// </summary>
+struct CookAssetsWorkResult
+{
+    enum States : int64
+    {
+        Pending = 0,
+        Done,
+        Failed,
+    };
+
+    int64 State = Pending;
+    String TypeName;
+    double CookTime = 0.0;
+    CookAssetsStep::CacheEntry Entry;
+};
+
+int32 GetAssetCookCost(const String& typeName)
+{
+    // Shaders compilation is the heaviest stage, then textures conversion (compression), other assets are mostly copied
+    if (typeName == Material::TypeName || typeName == Shader::TypeName || typeName == ParticleEmitter::TypeName)
+        return 2;
+    if (typeName == Texture::TypeName || typeName == CubeTexture::TypeName || typeName == SpriteAtlas::TypeName)
+        return 1;
+    return 0;
+}
+
+bool SortByCookTime(const CookingData::AssetTypeStatistics& a, const CookingData::AssetTypeStatistics& b)
+{
+    return a.CookTime > b.CookTime;
+}
+
 bool CookAssetsStep::Perform(CookingData& data)
 {
     float Step1ProgressStart = 0.1f;
@@ -1063,13 +1310,11 @@ bool CookAssetsStep::Perform(CookingData& data)
     auto minDateTime = DateTime::MinValue();
 #endif
     int32 subStepIndex = 0;
-    AssetReference<Asset> assetRef;
-    assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+    Array<CookAssetsWorkItem> workList;
     for (auto i = data.Assets.Begin(); i.IsNotEnd(); ++i)
     {
         BUILD_STEP_CANCEL_CHECK;
 
-        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(subStepIndex++) / data.Assets.Count()));
         const Guid assetId = i->Item;
 
         // Register asset
@@ -1080,13 +1325,14 @@ bool CookAssetsStep::Perform(CookingData& data)
 #endif
 
         // Check if asset is in cooking cache and was not modified since last build
+        const bool hasInfo = Content::GetAssetInfo(assetId, assetInfo);
         const auto cachedEntry = cache.Entries.TryGet(assetId);
         if (cachedEntry)
         {
             ASSERT(cachedEntry->ID == assetId);
 
             // Get actual asset info
-            if (Content::GetAssetInfo(assetId, assetInfo))
+            if (hasInfo)
             {
                 // Ensure that cached entry is valid
                 if (cachedEntry->TypeName == assetInfo.TypeName)
@@ -1121,24 +1367,114 @@ bool CookAssetsStep::Perform(CookingData& data)
             }
         }
 
-        // Load asset (and keep ref)
-        assetRef = Content::LoadAsync<Asset>(assetId);
-        if (assetRef == nullptr)
+        // Add to cook
+        auto& item = workList.AddOne();
+        item.AssetId = assetId;
+        item.Cost = hasInfo ? GetAssetCookCost(assetInfo.TypeName) : 0;
+        item.Index = workList.Count() - 1;
+    }
+
+    // Cook assets in parallel (each asset processing reads only its own data so there are no ordering constraints between them)
+    if (workList.HasItems())
+    {
+        Sorting::QuickSort(workList.Get(), workList.Count());
+        Array<CookAssetsWorkResult> results;
+        results.Resize(workList.Count());
+        int64 nextItem = 0, stop = 0;
+        Function<void()> worker = [this, &data, &cache, &workList, &results, &nextItem, &stop]()
         {
-            data.Error(TEXT("Failed to load asset included in build."));
-            return true;
-        }
-        e.Info.TypeName = assetRef->GetTypeName();
+            AssetReference<Asset> assetRef;
+            assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+            while (Platform::AtomicRead(&stop) == 0)
+            {
+                const int64 index = Platform::InterlockedIncrement(&nextItem) - 1;
+                if (index >= workList.Count())
+                    break;
+                auto& result = results[(int32)index];
+                const double startTime = Platform::GetTimeSeconds();
+
+                // Load asset (and keep ref)
+                bool failed;
+                assetRef = Content::LoadAsync<Asset>(workList[(int32)index].AssetId);
+                if (assetRef == nullptr)
+                {
+                    data.Error(TEXT("Failed to load asset included in build."));
+                    failed = true;
+                }
+                else
+                {
+                    // Cook asset
+                    result.TypeName = assetRef->GetTypeName();
+                    failed = Process(data, cache, assetRef.Get(), result.Entry);
+                }
+                assetRef = nullptr;
 
-        // Cook asset
-        if (Process(data, cache, assetRef.Get()))
+                result.CookTime = Platform::GetTimeSeconds() - startTime;
+                Platform::AtomicStore(&result.State, failed ? CookAssetsWorkResult::Failed : CookAssetsWorkResult::Done);
+                if (failed)
+                    Platform::AtomicStore(&stop, 1);
+            }
+        };
+        const int32 workersCount = Math::Clamp(Platform::GetCPUInfo().ProcessorCoreCount, 1, workList.Count());
+        Array<Task*> workers;
+        for (int32 i = 0; i < workersCount; i++)
+            workers.Add(Task::StartNew(worker));
+        LOG(Info, "Cooking {0} assets using {1} threads", workList.Count(), workersCount);
+
+        // Commit the cooking results in the work list order to keep the cache contents deterministic
+        const double startTime = Platform::GetTimeSeconds();
+        int32 committed = 0;
+        while (committed < results.Count())
+        {
+            auto& result = results[committed];
+            const int64 state = Platform::AtomicRead(&result.State);
+            if (state == CookAssetsWorkResult::Pending)
+            {
+                if (GameCooker::IsCancelRequested() || Platform::AtomicRead(&stop) != 0)
+                    break;
+                data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(committed) / workList.Count()));
+                Platform::Sleep(10);
+                continue;
+            }
+            if (state == CookAssetsWorkResult::Failed)
+                break;
+            committed++;
+
+            auto& e = AssetsRegistry[workList[committed - 1].AssetId];
+            e.Info.TypeName = result.TypeName;
+            if (result.Entry.ID.IsValid())
+                cache.Entries[result.Entry.ID] = MoveTemp(result.Entry);
+            auto& assetStats = data.Stats.AssetStats[result.TypeName];
+            assetStats.CookedCount++;
+            assetStats.CookTime += result.CookTime;
+            data.Stats.CookedAssets++;
+
+            // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
+            if (data.Stats.CookedAssets % 50 == 0)
+            {
+                cache.Save();
+            }
+        }
+        Platform::AtomicStore(&stop, 1);
+        Task::WaitAll(workers);
+        if (committed < results.Count())
+        {
+            // Keep the already cooked assets for the next build
+            cache.Save();
             return true;
-        data.Stats.CookedAssets++;
+        }
 
-        // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
-        if (data.Stats.CookedAssets % 50 == 0)
+        // Print cooking time per asset type
+        LOG(Info, "Cooked {0} assets in {1} s", workList.Count(), Utilities::RoundTo2DecimalPlaces(Platform::GetTimeSeconds() - startTime));
+        for (auto& e : data.Stats.AssetStats)
+            e.Value.TypeName = e.Key;
+        Array<CookingData::AssetTypeStatistics> assetTypes;
+        data.Stats.AssetStats.GetValues(assetTypes);
+        Sorting::QuickSort(assetTypes.Get(), assetTypes.Count(), SortByCookTime);
+        for (auto& e : assetTypes)
         {
-            cache.Save();
+            if (e.CookedCount != 0)
+                LOG(Info, "{0}: {1:>4} assets cooked in {2} s", e.TypeName, e.CookedCount, Utilities::RoundTo2DecimalPlaces(e.CookTime));
         }
     }
 
@@ -1185,15 +1521,31 @@ bool CookAssetsStep::Perform(CookingData& data)
 
     // Package all registered assets into packages
     {
-        PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey);
+        // Use the recorded assets load traces to place the data used together next to each other (reduces seeks when loading content)
+        PackagesLayout layout;
+        const bool useLayout = layout.Load(gameSettings->FirstScene);
+        Array<Guid> assetsOrder;
+        assetsOrder.EnsureCapacity(AssetsRegistry.Count());
+        if (useLayout)
+        {
+            LOG(Info, "Using {0} content load traces for the packages layout", layout.Traces.Count());
+            layout.GetAssetsOrder(AssetsRegistry, assetsOrder);
+        }
+        else
+        {
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+                assetsOrder.Add(i->Key);
+        }
+
+        PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey, useLayout ? &layout : nullptr);
 
         subStepIndex = 0;
-        for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+        for (const Guid& assetId : assetsOrder)
         {
             BUILD_STEP_CANCEL_CHECK;
 
             data.StepProgress(Step2Info, Math::Lerp(Step2ProgressStart, Step2ProgressEnd, static_cast<float>(subStepIndex++) / AssetsRegistry.Count()));
-            const auto assetId = i->Key;
+            auto& entry = AssetsRegistry[assetId];
 
             String cookedFilePath;
             cache.GetFilePath(assetId, cookedFilePath);
@@ -1204,11 +1556,11 @@ bool CookAssetsStep::Perform(CookingData& data)
                 continue;
             }
 
-            auto& assetStats = data.Stats.AssetStats[i->Value.Info.TypeName];
+            auto& assetStats = data.Stats.AssetStats[entry.Info.TypeName];
             assetStats.Count++;
             assetStats.ContentSize += FileSystem::GetFileSize(cookedFilePath);
 
-            if (packageBuilder.Add(data, i->Value, cookedFilePath))
+            if (packageBuilder.Add(data, entry, cookedFilePath))
                 return true;
         }
         if (packageBuilder.Package(data))
@@ -1216,6 +1568,20 @@ bool CookAssetsStep::Perform(CookingData& data)
         for (auto& e : data.Stats.AssetStats)
             e.Value.TypeName = e.Key;
         data.Stats.ContentSizeMB = static_cast<int32>(packageBuilder.GetPackagesSizeTotal() / (1024 * 1024));
+
+        // Print the expected seeks count for the recorded loads (default layout vs the first use layout)
+        if (useLayout)
+        {
+            PackagesLayout::Locations defaultLocations;
+            layout.GetDefaultLocations(AssetsRegistry, buildSettings->MaxAssetsPerPackage, (uint64)buildSettings->MaxPackageSizeMB * (1024 * 1024), defaultLocations);
+            for (const ContentLoadTrace& trace : layout.Traces)
+            {
+                int32 reads;
+                const int32 seeksBefore = PackagesLayout::CountSeeks(trace, defaultLocations, reads);
+                const int32 seeksAfter = PackagesLayout::CountSeeks(trace, layout.ChunkLocations, reads);
+                LOG(Info, "Content load trace {0}: {1} chunk reads, expected seeks: {2} (default layout: {3})", trace.Name, reads, seeksAfter, seeksBefore);
+            }
+        }
     }
 
     BUILD_STEP_CANCEL_CHECK;
@@ -16,7 +16,7 @@ struct AssetInitData;
 
 /// <summary>
 /// Cooking step that builds all the assets and packages them to the output directory.
-/// Uses incremental build cache to provide faster building.
+/// Uses incremental build cache to provide faster building. Assets are cooked in parallel on the thread pool.
 /// </summary>
 /// <seealso cref="GameCooker::BuildStep" />
 class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
@@ -120,6 +120,22 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
             cachedFilePath = CacheFolder / id.ToString(Guid::FormatType::N);
         }
 
+        /// <summary>
+        /// Initializes the entry for the cooked asset file (without adding it to the cache).
+        /// </summary>
+        /// <param name="asset">The asset.</param>
+        /// <param name="entry">The entry to initialize.</param>
+        /// <param name="cachedFilePath">The cached file path to use for creating cache storage.</param>
+        void SetupEntry(const JsonAssetBase* asset, CacheEntry& entry, String& cachedFilePath) const;
+
+        /// <summary>
+        /// Initializes the entry for the cooked asset file (without adding it to the cache).
+        /// </summary>
+        /// <param name="asset">The asset.</param>
+        /// <param name="entry">The entry to initialize.</param>
+        /// <param name="cachedFilePath">The cached file path to use for creating cache storage.</param>
+        void SetupEntry(const Asset* asset, CacheEntry& entry, String& cachedFilePath) const;
+
         /// <summary>
         /// Creates the new entry for the cooked asset file.
         /// </summary>
@@ -158,10 +174,13 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         void Save();
     };
 
+    /// <summary>
+    /// The asset cooking context. Note: assets are cooked in parallel so processors can be called from multiple threads at once.
+    /// </summary>
     struct FLAXENGINE_API AssetCookData
     {
         CookingData& Data;
-        CacheData& Cache;
+        const CacheData& Cache;
         AssetInitData& InitData;
         Asset* Asset;
         FileDependenciesList& FileDependencies;
@@ -181,9 +200,10 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
     AssetsCache::Registry AssetsRegistry;
     AssetsCache::PathsMapping AssetPathsMapping;
 
-    bool Process(CookingData& data, CacheData& cache, Asset* asset);
-    bool Process(CookingData& data, CacheData& cache, BinaryAsset* asset);
-    bool Process(CookingData& data, CacheData& cache, JsonAssetBase* asset);
+    // Note: cooking can run on multiple threads at once, the cooked asset cache entry is returned via the entry parameter (cache data is only read)
+    bool Process(CookingData& data, const CacheData& cache, Asset* asset, CacheEntry& entry);
+    bool Process(CookingData& data, const CacheData& cache, BinaryAsset* asset, CacheEntry& entry);
+    bool Process(CookingData& data, const CacheData& cache, JsonAssetBase* asset, CacheEntry& entry);
 
 public:
 
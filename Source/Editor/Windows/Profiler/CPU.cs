@@ -12,29 +12,27 @@ partial class ProfilerCPU
     {
         partial struct Event
         {
+            private static readonly Dictionary<int, string> _names = new Dictionary<int, string>();
+
             /// <summary>
             /// Gets the event name.
             /// </summary>
-            public unsafe string Name
+            public string Name
             {
                 get
                 {
-                    fixed (char* name = &Name0)
+                    if (!_names.TryGetValue(NameId, out var name))
                     {
-                        return new string(name);
+                        name = GetEventName(NameId);
+                        _names.Add(NameId, name);
                     }
+                    return name;
                 }
             }
 
-            internal unsafe bool NameStartsWith(string prefix)
+            internal bool NameStartsWith(string prefix)
             {
-                fixed (char* name = &Name0)
-                {
-                    fixed (char* p = prefix)
-                    {
-                        return Utils.MemoryCompare(new IntPtr(name), new IntPtr(p), (ulong)(prefix.Length * 2)) == 0;
-                    }
-                }
+                return Name.StartsWith(prefix, StringComparison.Ordinal);
             }
         }
     }
@@ -3,6 +3,7 @@
 #include "Animations.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
@@ -52,6 +53,7 @@ void AnimationsService::Dispose()
 void AnimationsSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Animations.Job");
+    PROFILE_MEM(Animation);
     auto animatedModel = UpdateList[index];
     auto skinnedModel = animatedModel->SkinnedModel.Get();
     auto graph = animatedModel->AnimationGraph.Get();
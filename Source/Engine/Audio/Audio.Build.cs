@@ -23,6 +23,7 @@ public override void Setup(BuildOptions options)
         bool useNone = true;
         bool useOpenAL = false;
         bool useXAudio2 = false;
+        bool useSoftware = false;
 
         switch (options.Platform.Target)
         {
@@ -30,6 +31,7 @@ public override void Setup(BuildOptions options)
             useNone = true;
             useOpenAL = true;
             //useXAudio2 = true;
+            useSoftware = true;
             break;
         case TargetPlatform.XboxOne:
         case TargetPlatform.UWP:
@@ -38,6 +40,7 @@ public override void Setup(BuildOptions options)
             break;
         case TargetPlatform.Linux:
             useOpenAL = true;
+            useSoftware = true;
             break;
         case TargetPlatform.PS4:
             options.SourcePaths.Add(Path.Combine(Globals.EngineRoot, "Source", "Platforms", "PS4", "Engine", "Audio"));
@@ -56,6 +59,7 @@ public override void Setup(BuildOptions options)
             break;
         case TargetPlatform.Mac:
             useOpenAL = true;
+            useSoftware = true;
             break;
         default: throw new InvalidPlatformException(options.Platform.Target);
         }
@@ -112,6 +116,12 @@ public override void Setup(BuildOptions options)
             }
         }
 
+        if (useSoftware)
+        {
+            options.SourcePaths.Add(Path.Combine(FolderPath, "Software"));
+            options.PublicDefinitions.Add("AUDIO_API_SOFTWARE");
+        }
+
         options.PrivateDependencies.Add("AudioTool");
     }
 
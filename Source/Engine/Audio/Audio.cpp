@@ -8,6 +8,7 @@
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Core/Log.h"
@@ -15,6 +16,9 @@
 #if AUDIO_API_NONE
 #include "None/AudioBackendNone.h"
 #endif
+#if AUDIO_API_SOFTWARE
+#include "Software/AudioBackendSoftware.h"
+#endif
 #if AUDIO_API_PS4
 #include "Platforms/PS4/Engine/Audio/AudioBackendPS4.h"
 #endif
@@ -187,6 +191,10 @@ bool AudioService::Init()
     if (mute)
         backend = New<AudioBackendNone>();
 #endif
+#if AUDIO_API_SOFTWARE
+    if (!backend && (CommandLine::Options.SoftwareAudio.IsTrue() || CommandLine::Options.AudioCapture.HasValue()))
+        backend = New<AudioBackendSoftware>();
+#endif
 #if AUDIO_API_PS4
     if (!backend)
         backend = New<AudioBackendPS4>();
@@ -237,6 +245,7 @@ bool AudioService::Init()
 void AudioService::Update()
 {
     PROFILE_CPU_NAMED("Audio.Update");
+    PROFILE_MEM(Audio);
 
     // Update the master volume
     float masterVolume = MasterVolume;
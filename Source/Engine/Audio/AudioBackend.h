@@ -36,6 +36,7 @@ class AudioBackend
     virtual void Source_IsLoopingChanged(AudioSource* source) = 0;
     virtual void Source_MinDistanceChanged(AudioSource* source) = 0;
     virtual void Source_AttenuationChanged(AudioSource* source) = 0;
+    virtual void Source_PriorityChanged(AudioSource* source) = 0;
     virtual void Source_ClipLoaded(AudioSource* source) = 0;
     virtual void Source_Cleanup(AudioSource* source) = 0;
     virtual void Source_Play(AudioSource* source) = 0;
@@ -145,6 +146,11 @@ class AudioBackend
             Instance->Source_AttenuationChanged(source);
         }
 
+        FORCE_INLINE static void PriorityChanged(AudioSource* source)
+        {
+            Instance->Source_PriorityChanged(source);
+        }
+
         FORCE_INLINE static void ClipLoaded(AudioSource* source)
         {
             Instance->Source_ClipLoaded(source);
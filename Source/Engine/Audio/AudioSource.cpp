@@ -18,6 +18,7 @@ AudioSource::AudioSource(const SpawnParams& params)
     , _pitch(1.0f)
     , _minDistance(1.0f)
     , _attenuation(1.0f)
+    , _priority(0)
     , _loop(false)
     , _playOnStart(false)
 {
@@ -100,6 +101,19 @@ void AudioSource::SetAttenuation(float value)
     }
 }
 
+void AudioSource::SetPriority(int32 value)
+{
+    if (_priority == value)
+        return;
+
+    _priority = value;
+
+    if (SourceIDs.HasItems())
+    {
+        AudioBackend::Source::PriorityChanged(this);
+    }
+}
+
 void AudioSource::Play()
 {
     auto state = _state;
@@ -325,6 +339,7 @@ void AudioSource::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(Pitch, _pitch);
     SERIALIZE_MEMBER(MinDistance, _minDistance);
     SERIALIZE_MEMBER(Attenuation, _attenuation);
+    SERIALIZE_MEMBER(Priority, _priority);
     SERIALIZE_MEMBER(Loop, _loop);
     SERIALIZE_MEMBER(PlayOnStart, _playOnStart);
 }
@@ -339,6 +354,7 @@ void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(Pitch, _pitch);
     DESERIALIZE_MEMBER(MinDistance, _minDistance);
     DESERIALIZE_MEMBER(Attenuation, _attenuation);
+    DESERIALIZE_MEMBER(Priority, _priority);
     DESERIALIZE_MEMBER(Loop, _loop);
     DESERIALIZE_MEMBER(PlayOnStart, _playOnStart);
 }
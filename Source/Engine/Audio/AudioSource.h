@@ -48,6 +48,7 @@ class FLAXENGINE_API AudioSource : public Actor
     float _pitch;
     float _minDistance;
     float _attenuation;
+    int32 _priority;
     bool _loop;
     bool _playOnStart;
 
@@ -164,6 +165,20 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     API_PROPERTY() void SetAttenuation(float value);
 
+    /// <summary>
+    /// Gets the playback priority. When the amount of playing sources exceeds the limit of the audio backend, sources with lower priority are virtualized first (not mixed but their playback time still advances).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(80), DefaultValue(0), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the playback priority. When the amount of playing sources exceeds the limit of the audio backend, sources with lower priority are virtualized first (not mixed but their playback time still advances).
+    /// </summary>
+    API_PROPERTY() void SetPriority(int32 value);
+
 public:
     /// <summary>
     /// Starts playing the currently assigned audio clip.
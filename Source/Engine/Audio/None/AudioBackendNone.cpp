@@ -60,6 +60,10 @@ void AudioBackendNone::Source_AttenuationChanged(AudioSource* source)
 {
 }
 
+void AudioBackendNone::Source_PriorityChanged(AudioSource* source)
+{
+}
+
 void AudioBackendNone::Source_ClipLoaded(AudioSource* source)
 {
 }
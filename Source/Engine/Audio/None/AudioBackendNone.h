@@ -27,6 +27,7 @@ class AudioBackendNone : public AudioBackend
     void Source_IsLoopingChanged(AudioSource* source) override;
     void Source_MinDistanceChanged(AudioSource* source) override;
     void Source_AttenuationChanged(AudioSource* source) override;
+    void Source_PriorityChanged(AudioSource* source) override;
     void Source_ClipLoaded(AudioSource* source) override;
     void Source_Cleanup(AudioSource* source) override;
     void Source_Play(AudioSource* source) override;
@@ -395,6 +395,11 @@ void AudioBackendOAL::Source_AttenuationChanged(AudioSource* source)
     }
 }
 
+void AudioBackendOAL::Source_PriorityChanged(AudioSource* source)
+{
+    // Sources priority is not supported by OpenAL
+}
+
 void AudioBackendOAL::Source_ClipLoaded(AudioSource* source)
 {
     if (source->SourceIDs.Count() < ALC::Contexts.Count())
@@ -0,0 +1,333 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if AUDIO_API_SOFTWARE
+
+#include "AudioBackendSoftware.h"
+#include "AudioMixer.h"
+#include "Engine/Audio/Audio.h"
+#include "Engine/Audio/AudioListener.h"
+#include "Engine/Audio/AudioSettings.h"
+#include "Engine/Audio/AudioSource.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace SoftwareAudio
+{
+    AudioMixer* Mixer = nullptr;
+    AudioListener* Listener = nullptr;
+    double PendingFrames = 0.0;
+    Array<float> Output;
+    bool Capture = false;
+
+    AudioMixer::Voice* GetVoice(const AudioSource* source)
+    {
+        if (source->SourceIDs.Count() == 0)
+            return nullptr;
+        return Mixer->GetVoice(source->SourceIDs[0]);
+    }
+
+    void UpdateListener()
+    {
+        Mixer->Listener.IsActive = Listener != nullptr;
+        if (Listener)
+        {
+            Mixer->Listener.Position = Listener->GetPosition();
+            Mixer->Listener.Orientation = Listener->GetOrientation();
+            Mixer->Listener.Velocity = Listener->GetVelocity();
+        }
+    }
+
+    void UpdateVoice(AudioMixer::Voice* voice, const AudioSource* source)
+    {
+        voice->Is3D = source->Is3D();
+        voice->Volume = source->GetVolume();
+        voice->Pitch = source->GetPitch();
+        voice->MinDistance = source->GetMinDistance();
+        voice->Attenuation = source->GetAttenuation();
+        voice->Priority = source->GetPriority();
+        voice->Position = source->GetPosition();
+        voice->Velocity = source->GetVelocity();
+
+        // When streaming the looping is handled by the source via buffers submission
+        voice->IsLooping = source->GetIsLooping() && !source->UseStreaming();
+    }
+}
+
+void AudioBackendSoftware::Listener_OnAdd(AudioListener* listener)
+{
+    // Note: only one listener is supported for now
+    if (!SoftwareAudio::Listener)
+    {
+        SoftwareAudio::Listener = listener;
+        SoftwareAudio::UpdateListener();
+    }
+}
+
+void AudioBackendSoftware::Listener_OnRemove(AudioListener* listener)
+{
+    if (SoftwareAudio::Listener == listener)
+    {
+        SoftwareAudio::Listener = nullptr;
+        for (AudioListener* e : Audio::Listeners)
+        {
+            if (e != listener)
+            {
+                SoftwareAudio::Listener = e;
+                break;
+            }
+        }
+        SoftwareAudio::UpdateListener();
+    }
+}
+
+void AudioBackendSoftware::Listener_VelocityChanged(AudioListener* listener)
+{
+    if (SoftwareAudio::Listener == listener)
+        SoftwareAudio::UpdateListener();
+}
+
+void AudioBackendSoftware::Listener_TransformChanged(AudioListener* listener)
+{
+    if (SoftwareAudio::Listener == listener)
+        SoftwareAudio::UpdateListener();
+}
+
+void AudioBackendSoftware::Source_OnAdd(AudioSource* source)
+{
+    const uint32 voiceId = SoftwareAudio::Mixer->CreateVoice();
+    SoftwareAudio::UpdateVoice(SoftwareAudio::Mixer->GetVoice(voiceId), source);
+    source->SourceIDs.Add(voiceId);
+
+    source->Restore();
+}
+
+void AudioBackendSoftware::Source_OnRemove(AudioSource* source)
+{
+    source->Cleanup();
+}
+
+void AudioBackendSoftware::Source_VelocityChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Velocity = source->GetVelocity();
+}
+
+void AudioBackendSoftware::Source_TransformChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Position = source->GetPosition();
+}
+
+void AudioBackendSoftware::Source_VolumeChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Volume = source->GetVolume();
+}
+
+void AudioBackendSoftware::Source_PitchChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Pitch = source->GetPitch();
+}
+
+void AudioBackendSoftware::Source_IsLoopingChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->IsLooping = source->GetIsLooping() && !source->UseStreaming();
+}
+
+void AudioBackendSoftware::Source_MinDistanceChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->MinDistance = source->GetMinDistance();
+}
+
+void AudioBackendSoftware::Source_AttenuationChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Attenuation = source->GetAttenuation();
+}
+
+void AudioBackendSoftware::Source_PriorityChanged(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        voice->Priority = source->GetPriority();
+}
+
+void AudioBackendSoftware::Source_ClipLoaded(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (voice)
+        SoftwareAudio::UpdateVoice(voice, source);
+}
+
+void AudioBackendSoftware::Source_Cleanup(AudioSource* source)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->DeleteVoice(source->SourceIDs[0]);
+}
+
+void AudioBackendSoftware::Source_Play(AudioSource* source)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->Play(source->SourceIDs[0]);
+}
+
+void AudioBackendSoftware::Source_Pause(AudioSource* source)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->Pause(source->SourceIDs[0]);
+}
+
+void AudioBackendSoftware::Source_Stop(AudioSource* source)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->Stop(source->SourceIDs[0]);
+}
+
+void AudioBackendSoftware::Source_SetCurrentBufferTime(AudioSource* source, float value)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->SetTime(source->SourceIDs[0], value);
+}
+
+float AudioBackendSoftware::Source_GetCurrentBufferTime(const AudioSource* source)
+{
+    return source->SourceIDs.HasItems() ? SoftwareAudio::Mixer->GetTime(source->SourceIDs[0]) : 0.0f;
+}
+
+void AudioBackendSoftware::Source_SetNonStreamingBuffer(AudioSource* source)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    if (!voice)
+        return;
+
+    // Replace the queued buffers with the single clip buffer
+    voice->Queue.Clear();
+    voice->ProcessedBuffers = 0;
+    voice->Cursor = 0.0;
+    voice->IsLooping = source->GetIsLooping();
+    SoftwareAudio::Mixer->QueueBuffer(source->SourceIDs[0], source->Clip->Buffers[0]);
+}
+
+void AudioBackendSoftware::Source_GetProcessedBuffersCount(AudioSource* source, int32& processedBuffersCount)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    processedBuffersCount = voice ? voice->ProcessedBuffers : 0;
+}
+
+void AudioBackendSoftware::Source_GetQueuedBuffersCount(AudioSource* source, int32& queuedBuffersCount)
+{
+    auto voice = SoftwareAudio::GetVoice(source);
+    queuedBuffersCount = voice ? voice->Queue.Count() : 0;
+}
+
+void AudioBackendSoftware::Source_QueueBuffer(AudioSource* source, uint32 bufferId)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->QueueBuffer(source->SourceIDs[0], bufferId);
+}
+
+void AudioBackendSoftware::Source_DequeueProcessedBuffers(AudioSource* source)
+{
+    if (source->SourceIDs.HasItems())
+        SoftwareAudio::Mixer->DequeueProcessedBuffers(source->SourceIDs[0]);
+}
+
+void AudioBackendSoftware::Buffer_Create(uint32& bufferId)
+{
+    bufferId = SoftwareAudio::Mixer->CreateBuffer();
+}
+
+void AudioBackendSoftware::Buffer_Delete(uint32& bufferId)
+{
+    SoftwareAudio::Mixer->DeleteBuffer(bufferId);
+}
+
+void AudioBackendSoftware::Buffer_Write(uint32 bufferId, byte* samples, const AudioDataInfo& info)
+{
+    SoftwareAudio::Mixer->WriteBuffer(bufferId, samples, info);
+}
+
+const Char* AudioBackendSoftware::Base_Name()
+{
+    return TEXT("Software");
+}
+
+void AudioBackendSoftware::Base_OnActiveDeviceChanged()
+{
+}
+
+void AudioBackendSoftware::Base_SetDopplerFactor(float value)
+{
+    if (SoftwareAudio::Mixer)
+        SoftwareAudio::Mixer->DopplerFactor = value;
+}
+
+void AudioBackendSoftware::Base_SetVolume(float value)
+{
+    if (SoftwareAudio::Mixer)
+        SoftwareAudio::Mixer->Volume = value;
+}
+
+bool AudioBackendSoftware::Base_Init()
+{
+    auto& devices = Audio::Devices;
+
+    SoftwareAudio::Mixer = New<AudioMixer>();
+    SoftwareAudio::Mixer->DopplerFactor = AudioSettings::Get()->DopplerFactor;
+    SoftwareAudio::PendingFrames = 0.0;
+    SoftwareAudio::Capture = CommandLine::Options.AudioCapture.HasValue();
+    LOG(Info, "Software audio mixer: 2 channels at {0} kHz, {1} real voices{2}", SoftwareAudio::Mixer->SampleRate / 1000.0f, SoftwareAudio::Mixer->MaxRealVoices, SoftwareAudio::Capture ? TEXT(" (capture enabled)") : TEXT(""));
+
+    // Dummy device
+    devices.Resize(1);
+    devices[0].Name = TEXT("Software mixer");
+    Audio::SetActiveDeviceIndex(0);
+
+    return false;
+}
+
+void AudioBackendSoftware::Base_Update()
+{
+    PROFILE_CPU();
+
+    // Mix the audio for the elapsed time
+    SoftwareAudio::PendingFrames += Time::Update.UnscaledDeltaTime.GetTotalSeconds() * SoftwareAudio::Mixer->SampleRate;
+    const int32 frames = Math::Min((int32)SoftwareAudio::PendingFrames, SoftwareAudio::Mixer->SampleRate);
+    SoftwareAudio::PendingFrames -= (int32)SoftwareAudio::PendingFrames;
+    if (frames <= 0)
+        return;
+    auto& output = SoftwareAudio::Output;
+    int32 start = 0;
+    if (SoftwareAudio::Capture)
+        start = output.Count();
+    output.Resize(start + frames * 2);
+    SoftwareAudio::Mixer->Mix(output.Get() + start, frames);
+}
+
+void AudioBackendSoftware::Base_Dispose()
+{
+    if (SoftwareAudio::Capture)
+    {
+        const String& path = CommandLine::Options.AudioCapture.GetValue();
+        LOG(Info, "Saving captured audio to {0}", path);
+        AudioMixer::SaveWav(path, SoftwareAudio::Output.Get(), SoftwareAudio::Output.Count() / 2, SoftwareAudio::Mixer->SampleRate);
+    }
+    SoftwareAudio::Output.Resize(0);
+    Delete(SoftwareAudio::Mixer);
+    SoftwareAudio::Mixer = nullptr;
+    SoftwareAudio::Listener = nullptr;
+}
+
+#endif
@@ -0,0 +1,547 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if AUDIO_API_SOFTWARE
+
+#include "AudioMixer.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Tools/AudioTool/AudioTool.h"
+
+// Matches the units conversion used by the other backends (engine units are centimeters)
+#define AUDIO_MIXER_UNITS_SCALE 0.01f
+
+// The speed of sound (in meters per second) used by the doppler effect
+#define AUDIO_MIXER_SPEED_OF_SOUND 343.3f
+
+namespace
+{
+    // Scratch buffers layout (planar, each of AUDIO_MIXER_BLOCK_SIZE floats)
+    enum ScratchSlot
+    {
+        SampleLeft0,
+        SampleLeft1,
+        SampleRight0,
+        SampleRight1,
+        SampleFraction,
+        ScratchSlotsCount,
+    };
+
+    FORCE_INLINE void MixChannel(float* output, const float* samples0, const float* samples1, const float* fraction, float gain, float gainStep, int32 frames)
+    {
+        // Linear interpolation between the samples and volume ramp, 4 frames at once
+        SimdVector4 gainVector = SIMD::Load(gain + gainStep, gain + gainStep * 2.0f, gain + gainStep * 3.0f, gain + gainStep * 4.0f);
+        const SimdVector4 gainVectorStep = SIMD::Splat(gainStep * 4.0f);
+        for (int32 i = 0; i < frames; i += 4)
+        {
+            const SimdVector4 s0 = SIMD::Load(samples0 + i);
+            const SimdVector4 s1 = SIMD::Load(samples1 + i);
+            const SimdVector4 sample = SIMD::Add(s0, SIMD::Mul(SIMD::Sub(s1, s0), SIMD::Load(fraction + i)));
+            SIMD::Store(output + i, SIMD::Add(SIMD::Load(output + i), SIMD::Mul(sample, gainVector)));
+            gainVector = SIMD::Add(gainVector, gainVectorStep);
+        }
+    }
+}
+
+AudioMixer::~AudioMixer()
+{
+    Clear();
+}
+
+uint32 AudioMixer::CreateBuffer()
+{
+    // Reuse free slot
+    for (int32 i = 0; i < _buffers.Count(); i++)
+    {
+        if (_buffers[i] == nullptr)
+        {
+            _buffers[i] = New<Buffer>();
+            return i + 1;
+        }
+    }
+    _buffers.Add(New<Buffer>());
+    return _buffers.Count();
+}
+
+void AudioMixer::DeleteBuffer(uint32 bufferId)
+{
+    if (bufferId == 0 || bufferId > (uint32)_buffers.Count())
+        return;
+    Buffer*& buffer = _buffers[bufferId - 1];
+    Delete(buffer);
+    buffer = nullptr;
+}
+
+void AudioMixer::WriteBuffer(uint32 bufferId, const byte* samples, const AudioDataInfo& info)
+{
+    if (bufferId == 0 || bufferId > (uint32)_buffers.Count() || !_buffers[bufferId - 1] || info.NumChannels == 0 || info.SampleRate == 0)
+        return;
+    PROFILE_CPU();
+    Buffer* buffer = _buffers[bufferId - 1];
+    buffer->SampleRate = info.SampleRate;
+    if (info.NumChannels <= 2)
+    {
+        buffer->Channels = info.NumChannels;
+        buffer->Samples.Resize(info.NumSamples, false);
+        AudioTool::ConvertToFloat(samples, info.BitDepth, buffer->Samples.Get(), info.NumSamples);
+    }
+    else
+    {
+        // Downmix to mono
+        const uint32 frames = info.NumSamples / info.NumChannels;
+        Array<byte> mono;
+        mono.Resize(frames * (info.BitDepth / 8), false);
+        AudioTool::ConvertToMono(samples, mono.Get(), info.BitDepth, info.NumSamples, info.NumChannels);
+        buffer->Channels = 1;
+        buffer->Samples.Resize(frames, false);
+        AudioTool::ConvertToFloat(mono.Get(), info.BitDepth, buffer->Samples.Get(), frames);
+    }
+    buffer->Frames = buffer->Samples.Count() / buffer->Channels;
+}
+
+const AudioMixer::Buffer* AudioMixer::GetBuffer(uint32 bufferId) const
+{
+    if (bufferId == 0 || bufferId > (uint32)_buffers.Count())
+        return nullptr;
+    return _buffers[bufferId - 1];
+}
+
+uint32 AudioMixer::CreateVoice()
+{
+    // Reuse free slot
+    int32 index = 0;
+    while (index < _voices.Count() && _voices[index].IsUsed)
+        index++;
+    if (index == _voices.Count())
+        _voices.AddOne();
+    Voice& voice = _voices[index];
+    voice = Voice();
+    voice.IsUsed = true;
+    return index + 1;
+}
+
+void AudioMixer::DeleteVoice(uint32 voiceId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (voice)
+        *voice = Voice();
+}
+
+AudioMixer::Voice* AudioMixer::GetVoice(uint32 voiceId)
+{
+    if (voiceId == 0 || voiceId > (uint32)_voices.Count() || !_voices[voiceId - 1].IsUsed)
+        return nullptr;
+    return &_voices[voiceId - 1];
+}
+
+void AudioMixer::Play(uint32 voiceId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (voice)
+        voice->IsPlaying = true;
+}
+
+void AudioMixer::Pause(uint32 voiceId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (voice)
+        voice->IsPlaying = false;
+}
+
+void AudioMixer::Stop(uint32 voiceId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (voice)
+    {
+        voice->IsPlaying = false;
+        voice->Queue.Clear();
+        voice->ProcessedBuffers = 0;
+        voice->Cursor = 0.0;
+        voice->StartTime = 0.0f;
+    }
+}
+
+void AudioMixer::QueueBuffer(uint32 voiceId, uint32 bufferId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (!voice || voice->Queue.Count() == AUDIO_MAX_SOURCE_BUFFERS)
+        return;
+    voice->Queue.Add(bufferId);
+    if (voice->Queue.Count() == 1 && voice->StartTime > ZeroTolerance)
+    {
+        // Apply the pending start time
+        const Buffer* buffer = GetBuffer(bufferId);
+        if (buffer)
+            voice->Cursor = Math::Min((double)voice->StartTime * buffer->SampleRate, (double)buffer->Frames);
+        voice->StartTime = 0.0f;
+    }
+}
+
+void AudioMixer::DequeueProcessedBuffers(uint32 voiceId)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (voice && voice->ProcessedBuffers != 0)
+    {
+        for (; voice->ProcessedBuffers > 0; voice->ProcessedBuffers--)
+            voice->Queue.RemoveAtKeepOrder(0);
+    }
+}
+
+void AudioMixer::SetTime(uint32 voiceId, float time)
+{
+    Voice* voice = GetVoice(voiceId);
+    if (!voice)
+        return;
+    const Buffer* buffer = GetCurrentBuffer(*voice);
+    if (buffer)
+        voice->Cursor = Math::Min((double)time * buffer->SampleRate, (double)buffer->Frames);
+    else
+        voice->StartTime = time;
+}
+
+float AudioMixer::GetTime(uint32 voiceId) const
+{
+    if (voiceId == 0 || voiceId > (uint32)_voices.Count())
+        return 0.0f;
+    const Voice& voice = _voices[voiceId - 1];
+    const Buffer* buffer = GetCurrentBuffer(voice);
+    return buffer ? (float)(voice.Cursor / Math::Max(buffer->SampleRate, 1)) : 0.0f;
+}
+
+void AudioMixer::Mix(float* output, int32 frames)
+{
+    PROFILE_CPU();
+    UpdateVoices();
+    _mix.Resize(AUDIO_MIXER_BLOCK_SIZE * 2, false);
+    _voiceMix.Resize(AUDIO_MIXER_BLOCK_SIZE * ScratchSlotsCount, false);
+    float* mixLeft = _mix.Get();
+    float* mixRight = mixLeft + AUDIO_MIXER_BLOCK_SIZE;
+
+    const int32 firstBlockFrames = Math::Min(frames, AUDIO_MIXER_BLOCK_SIZE);
+    for (int32 offset = 0; offset < frames; offset += AUDIO_MIXER_BLOCK_SIZE)
+    {
+        const int32 count = Math::Min(frames - offset, AUDIO_MIXER_BLOCK_SIZE);
+        Platform::MemoryClear(mixLeft, _mix.Count() * sizeof(float));
+
+        // Mix real voices
+        for (const int32 index : _realVoices)
+        {
+            Voice& voice = _voices[index];
+            MixVoice(voice, voice.TargetGain[0], voice.TargetGain[1], count);
+        }
+
+        // Fade out voices that got virtualized to prevent clicks
+        if (offset == 0)
+        {
+            for (const int32 index : _fadingVoices)
+                MixVoice(_voices[index], 0.0f, 0.0f, count);
+        }
+
+        if (output)
+        {
+            // Apply master volume and clip the output
+            const SimdVector4 volume = SIMD::Splat(Volume);
+            const SimdVector4 minValue = SIMD::Splat(-1.0f);
+            const SimdVector4 maxValue = SIMD::Splat(1.0f);
+            for (int32 i = 0; i < AUDIO_MIXER_BLOCK_SIZE * 2; i += 4)
+                SIMD::Store(mixLeft + i, SIMD::Min(SIMD::Max(SIMD::Mul(SIMD::Load(mixLeft + i), volume), minValue), maxValue));
+
+            // Interleave channels
+            float* dst = output + offset * 2;
+            for (int32 i = 0; i < count; i++)
+            {
+                dst[i * 2] = mixLeft[i];
+                dst[i * 2 + 1] = mixRight[i];
+            }
+        }
+    }
+
+    // Track the playback of the virtual voices
+    for (int32 i = 0; i < _voices.Count(); i++)
+    {
+        Voice& voice = _voices[i];
+        if (voice.IsUsed && voice.IsPlaying && voice.IsVirtual)
+            Advance(voice, _fadingVoices.Contains(i) ? frames - firstBlockFrames : frames);
+    }
+}
+
+bool AudioMixer::RenderToFile(const StringView& path, int32 frames)
+{
+    Array<float> samples;
+    samples.Resize(frames * 2, false);
+    Mix(samples.Get(), frames);
+    return SaveWav(path, samples.Get(), frames, SampleRate);
+}
+
+bool AudioMixer::SaveWav(const StringView& path, const float* samples, int32 frames, int32 sampleRate)
+{
+    PROFILE_CPU();
+    auto stream = FileWriteStream::Open(path);
+    if (stream == nullptr)
+    {
+        LOG(Warning, "Cannot write audio to file '{0}'", path);
+        return true;
+    }
+
+    // Header
+    const uint32 dataSize = frames * 2 * sizeof(int16);
+    stream->WriteBytes("RIFF", 4);
+    stream->WriteUint32(36 + dataSize);
+    stream->WriteBytes("WAVE", 4);
+    stream->WriteBytes("fmt ", 4);
+    stream->WriteUint32(16);
+    stream->WriteUint16(1); // PCM
+    stream->WriteUint16(2);
+    stream->WriteUint32(sampleRate);
+    stream->WriteUint32(sampleRate * 2 * sizeof(int16));
+    stream->WriteUint16(2 * sizeof(int16));
+    stream->WriteUint16(16);
+    stream->WriteBytes("data", 4);
+    stream->WriteUint32(dataSize);
+
+    // Samples
+    Array<int16> data;
+    data.Resize(frames * 2, false);
+    for (int32 i = 0; i < data.Count(); i++)
+        data[i] = (int16)Math::Clamp(samples[i] * 32767.0f, -32768.0f, 32767.0f);
+    stream->WriteBytes(data.Get(), dataSize);
+
+    Delete(stream);
+    return false;
+}
+
+void AudioMixer::Clear()
+{
+    _voices.Clear();
+    _realVoices.Clear();
+    _fadingVoices.Clear();
+    for (Buffer* buffer : _buffers)
+        Delete(buffer);
+    _buffers.Clear();
+}
+
+const AudioMixer::Buffer* AudioMixer::GetCurrentBuffer(const Voice& voice) const
+{
+    if (voice.ProcessedBuffers >= voice.Queue.Count())
+        return nullptr;
+    const Buffer* buffer = GetBuffer(voice.Queue[voice.ProcessedBuffers]);
+    return buffer && buffer->Frames != 0 ? buffer : nullptr;
+}
+
+void AudioMixer::UpdateVoices()
+{
+    PROFILE_CPU();
+    const float dopplerFactor = DopplerFactor;
+    const Quaternion listenerRotation = Listener.Orientation.Conjugated();
+    LastStats = Stats();
+    _ranks.Clear();
+    _realVoices.Clear();
+    _fadingVoices.Clear();
+    for (int32 i = 0; i < _voices.Count(); i++)
+    {
+        Voice& voice = _voices[i];
+        if (!voice.IsUsed)
+            continue;
+        const bool wasReal = !voice.IsVirtual;
+        voice.IsVirtual = true;
+        const Buffer* buffer = voice.IsPlaying ? GetCurrentBuffer(voice) : nullptr;
+        if (!buffer)
+        {
+            voice.Gain[0] = voice.Gain[1] = 0.0f;
+            continue;
+        }
+        LastStats.PlayingVoices++;
+
+        float gain = voice.Volume;
+        float gainLeft = 1.0f, gainRight = 1.0f;
+        double rate = (double)buffer->SampleRate / SampleRate * voice.Pitch;
+        if (voice.Is3D && Listener.IsActive)
+        {
+            const Float3 toSource = Float3(voice.Position - Listener.Position) * AUDIO_MIXER_UNITS_SCALE;
+            const float distance = toSource.Length();
+
+            // Inverse distance clamped attenuation
+            const float minDistance = Math::Max(voice.MinDistance, ZeroTolerance);
+            gain *= minDistance / (minDistance + voice.Attenuation * (Math::Max(distance, minDistance) - minDistance));
+
+            // Equal-power panning in listener space (sources within min distance blend towards the center)
+            float pan = 0.0f;
+            if (distance > ZeroTolerance)
+            {
+                const Float3 local = Float3::Transform(toSource, listenerRotation);
+                pan = Math::Clamp(local.X / distance, -1.0f, 1.0f) * Math::Saturate(distance / minDistance);
+            }
+            const float angle = (pan + 1.0f) * (PI / 4.0f);
+            gainLeft = Math::Cos(angle);
+            gainRight = Math::Sin(angle);
+
+            // Doppler shift
+            if (dopplerFactor > ZeroTolerance && distance > ZeroTolerance)
+            {
+                const Float3 toListener = toSource / -distance;
+                const float maxSpeed = AUDIO_MIXER_SPEED_OF_SOUND / dopplerFactor;
+                const float listenerSpeed = Math::Min(Float3::Dot(Float3(Listener.Velocity) * AUDIO_MIXER_UNITS_SCALE, toListener), maxSpeed);
+                const float sourceSpeed = Math::Min(Float3::Dot(Float3(voice.Velocity) * AUDIO_MIXER_UNITS_SCALE, toListener), maxSpeed);
+                const float shift = (AUDIO_MIXER_SPEED_OF_SOUND - dopplerFactor * listenerSpeed) / Math::Max(AUDIO_MIXER_SPEED_OF_SOUND - dopplerFactor * sourceSpeed, ZeroTolerance);
+                rate *= Math::Clamp(shift, 0.5f, 2.0f);
+            }
+        }
+        voice.Audibility = gain;
+        voice.TargetGain[0] = gain * gainLeft;
+        voice.TargetGain[1] = gain * gainRight;
+        voice.Rate = rate;
+
+        if (gain >= AudibilityThreshold)
+            _ranks.Add({ voice.Priority, gain, i });
+        if (wasReal)
+            _fadingVoices.Add(i);
+    }
+
+    // Pick the most important voices to mix
+    Sorting::QuickSort(_ranks.Get(), _ranks.Count());
+    const int32 realCount = Math::Min(_ranks.Count(), MaxRealVoices);
+    for (int32 i = 0; i < realCount; i++)
+    {
+        const int32 index = _ranks[i].Index;
+        _voices[index].IsVirtual = false;
+        _realVoices.Add(index);
+    }
+    for (int32 i = _fadingVoices.Count() - 1; i >= 0; i--)
+    {
+        if (!_voices[_fadingVoices[i]].IsVirtual)
+            _fadingVoices.RemoveAtKeepOrder(i);
+    }
+    LastStats.RealVoices = realCount;
+    LastStats.VirtualVoices = LastStats.PlayingVoices - realCount;
+}
+
+void AudioMixer::ProcessBufferEnd(Voice& voice) const
+{
+    while (voice.ProcessedBuffers < voice.Queue.Count())
+    {
+        const Buffer* buffer = GetBuffer(voice.Queue[voice.ProcessedBuffers]);
+        const int32 bufferFrames = buffer ? buffer->Frames : 0;
+        if (voice.Cursor < bufferFrames)
+            return;
+        if (voice.IsLooping && voice.Queue.Count() == 1 && bufferFrames != 0)
+        {
+            // Wrap around the single looped buffer
+            voice.Cursor -= (double)(int64)(voice.Cursor / bufferFrames) * bufferFrames;
+            return;
+        }
+        voice.Cursor -= bufferFrames;
+        voice.ProcessedBuffers++;
+    }
+    voice.Cursor = 0.0;
+}
+
+void AudioMixer::Advance(Voice& voice, int32 frames) const
+{
+    if (frames <= 0 || !GetCurrentBuffer(voice))
+        return;
+    voice.Cursor += frames * voice.Rate;
+    ProcessBufferEnd(voice);
+}
+
+void AudioMixer::MixVoice(Voice& voice, float gainLeft, float gainRight, int32 frames)
+{
+    float* left0 = _voiceMix.Get() + SampleLeft0 * AUDIO_MIXER_BLOCK_SIZE;
+    float* left1 = _voiceMix.Get() + SampleLeft1 * AUDIO_MIXER_BLOCK_SIZE;
+    float* right0 = _voiceMix.Get() + SampleRight0 * AUDIO_MIXER_BLOCK_SIZE;
+    float* right1 = _voiceMix.Get() + SampleRight1 * AUDIO_MIXER_BLOCK_SIZE;
+    float* fraction = _voiceMix.Get() + SampleFraction * AUDIO_MIXER_BLOCK_SIZE;
+    const double rate = voice.Rate;
+    bool stereo = false;
+
+    // Gather the samples to interpolate (can cross the buffers boundaries)
+    int32 done = 0;
+    while (done < frames)
+    {
+        const Buffer* buffer = GetCurrentBuffer(voice);
+        if (!buffer)
+            break;
+        const float* src = buffer->Samples.Get();
+        const int32 channels = buffer->Channels;
+        stereo |= channels == 2;
+
+        // Frames that can be interpolated within the current buffer
+        const int32 count = Math::Min(frames - done, Math::Max((int32)((buffer->Frames - 1 - voice.Cursor) / rate), 0));
+        double cursor = voice.Cursor;
+        if (channels == 2)
+        {
+            for (int32 i = done; i < done + count; i++)
+            {
+                const int32 index = (int32)cursor;
+                const float* s = src + index * 2;
+                left0[i] = s[0];
+                left1[i] = s[2];
+                right0[i] = s[1];
+                right1[i] = s[3];
+                fraction[i] = (float)(cursor - index);
+                cursor += rate;
+            }
+        }
+        else
+        {
+            for (int32 i = done; i < done + count; i++)
+            {
+                const int32 index = (int32)cursor;
+                left0[i] = right0[i] = src[index];
+                left1[i] = right1[i] = src[index + 1];
+                fraction[i] = (float)(cursor - index);
+                cursor += rate;
+            }
+        }
+        voice.Cursor = cursor;
+        done += count;
+        if (done == frames)
+            break;
+
+        // Last frame of the buffer (interpolate with the next buffer begin)
+        const int32 index = (int32)voice.Cursor;
+        if (index < buffer->Frames)
+        {
+            const float* next = src + index * channels;
+            if (voice.IsLooping && voice.Queue.Count() == 1)
+                next = src;
+            else if (voice.ProcessedBuffers + 1 < voice.Queue.Count())
+            {
+                const Buffer* nextBuffer = GetBuffer(voice.Queue[voice.ProcessedBuffers + 1]);
+                if (nextBuffer && nextBuffer->Frames != 0 && nextBuffer->Channels == channels)
+                    next = nextBuffer->Samples.Get();
+            }
+            const float* s = src + index * channels;
+            left0[done] = s[0];
+            left1[done] = next[0];
+            right0[done] = s[channels - 1];
+            right1[done] = next[channels - 1];
+            fraction[done] = (float)(voice.Cursor - index);
+            voice.Cursor += rate;
+            done++;
+        }
+        ProcessBufferEnd(voice);
+    }
+
+    // Silence the rest if reached the end of the queued data
+    const int32 framesAligned = Math::AlignUp(frames, 4);
+    for (int32 i = done; i < framesAligned; i++)
+        left0[i] = left1[i] = right0[i] = right1[i] = fraction[i] = 0.0f;
+
+    // Resample and mix the voice
+    float* mixLeft = _mix.Get();
+    float* mixRight = mixLeft + AUDIO_MIXER_BLOCK_SIZE;
+    const float stepLeft = (gainLeft - voice.Gain[0]) / frames;
+    const float stepRight = (gainRight - voice.Gain[1]) / frames;
+    MixChannel(mixLeft, left0, left1, fraction, voice.Gain[0], stepLeft, framesAligned);
+    if (stereo)
+        MixChannel(mixRight, right0, right1, fraction, voice.Gain[1], stepRight, framesAligned);
+    else
+        MixChannel(mixRight, left0, left1, fraction, voice.Gain[1], stepRight, framesAligned);
+    voice.Gain[0] = gainLeft;
+    voice.Gain[1] = gainRight;
+}
+
+#endif
@@ -0,0 +1,270 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if AUDIO_API_SOFTWARE
+
+#include "../Config.h"
+#include "../Types.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/StringView.h"
+
+// The amount of frames mixed at once (voice parameters are interpolated over the block)
+#define AUDIO_MIXER_BLOCK_SIZE 256
+
+/// <summary>
+/// Engine-side software audio mixer. Resamples, pans and attenuates the playing voices and mixes them into the interleaved stereo output.
+/// Only the most important voices (by priority and then audibility) are mixed, the others are virtual - their playback is tracked but they are not mixed.
+/// </summary>
+class FLAXENGINE_API AudioMixer
+{
+public:
+
+    /// <summary>
+    /// The audio data buffer (samples are converted to float, mono or interleaved stereo).
+    /// </summary>
+    struct Buffer
+    {
+        Array<float> Samples;
+        int32 Frames = 0;
+        int32 Channels = 0;
+        int32 SampleRate = 0;
+    };
+
+    /// <summary>
+    /// The playback voice. Identifiers are 1-based (0 is invalid).
+    /// </summary>
+    struct Voice
+    {
+        bool IsUsed = false;
+        bool IsPlaying = false;
+        bool IsLooping = false;
+        bool Is3D = false;
+        float Volume = 1.0f;
+        float Pitch = 1.0f;
+        float MinDistance = 1.0f;
+        float Attenuation = 1.0f;
+        int32 Priority = 0;
+        Vector3 Position = Vector3::Zero;
+        Vector3 Velocity = Vector3::Zero;
+
+        // Queued buffers (playback starts from the first not processed one)
+        Array<uint32, FixedAllocation<AUDIO_MAX_SOURCE_BUFFERS>> Queue;
+        int32 ProcessedBuffers = 0;
+        double Cursor = 0.0;
+        float StartTime = 0.0f;
+
+        // Mixing state
+        bool IsVirtual = true;
+        float Audibility = 0.0f;
+        float Gain[2] = { 0.0f, 0.0f };
+        float TargetGain[2] = { 0.0f, 0.0f };
+        double Rate = 1.0;
+    };
+
+    /// <summary>
+    /// The listener state.
+    /// </summary>
+    struct ListenerData
+    {
+        bool IsActive = false;
+        Vector3 Position = Vector3::Zero;
+        Quaternion Orientation = Quaternion::Identity;
+        Vector3 Velocity = Vector3::Zero;
+    };
+
+    /// <summary>
+    /// The last mixing statistics.
+    /// </summary>
+    struct Stats
+    {
+        int32 PlayingVoices = 0;
+        int32 RealVoices = 0;
+        int32 VirtualVoices = 0;
+    };
+
+private:
+
+    struct VoiceRank
+    {
+        int32 Priority;
+        float Audibility;
+        int32 Index;
+
+        bool operator<(const VoiceRank& other) const
+        {
+            // Higher priority and louder voices go first
+            if (Priority != other.Priority)
+                return Priority > other.Priority;
+            return Audibility > other.Audibility;
+        }
+    };
+
+    Array<Buffer*> _buffers;
+    Array<Voice> _voices;
+    Array<VoiceRank> _ranks;
+    Array<int32> _realVoices;
+    Array<int32> _fadingVoices;
+    Array<float> _mix;
+    Array<float> _voiceMix;
+
+public:
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="AudioMixer"/> class.
+    /// </summary>
+    ~AudioMixer();
+
+public:
+
+    /// <summary>
+    /// The output sample rate (frames per second).
+    /// </summary>
+    int32 SampleRate = 48000;
+
+    /// <summary>
+    /// The maximum amount of voices mixed at once. Voices above this limit are virtual.
+    /// </summary>
+    int32 MaxRealVoices = 64;
+
+    /// <summary>
+    /// The minimum voice audibility (volume including distance attenuation) required to be mixed. Quieter voices are virtual.
+    /// </summary>
+    float AudibilityThreshold = 0.0005f;
+
+    /// <summary>
+    /// The master volume.
+    /// </summary>
+    float Volume = 1.0f;
+
+    /// <summary>
+    /// The doppler effect factor. Use 0 to disable it.
+    /// </summary>
+    float DopplerFactor = 1.0f;
+
+    /// <summary>
+    /// The listener.
+    /// </summary>
+    ListenerData Listener;
+
+    /// <summary>
+    /// The last mixing statistics.
+    /// </summary>
+    Stats LastStats;
+
+public:
+
+    /// <summary>
+    /// Creates the audio data buffer.
+    /// </summary>
+    /// <returns>The buffer identifier.</returns>
+    uint32 CreateBuffer();
+
+    /// <summary>
+    /// Deletes the audio data buffer.
+    /// </summary>
+    void DeleteBuffer(uint32 bufferId);
+
+    /// <summary>
+    /// Writes the audio data to the buffer. Samples are converted to float and multi-channel data is downmixed to mono.
+    /// </summary>
+    void WriteBuffer(uint32 bufferId, const byte* samples, const AudioDataInfo& info);
+
+    /// <summary>
+    /// Gets the audio data buffer or null if identifier is invalid.
+    /// </summary>
+    const Buffer* GetBuffer(uint32 bufferId) const;
+
+    /// <summary>
+    /// Creates the playback voice.
+    /// </summary>
+    /// <returns>The voice identifier.</returns>
+    uint32 CreateVoice();
+
+    /// <summary>
+    /// Deletes the playback voice.
+    /// </summary>
+    void DeleteVoice(uint32 voiceId);
+
+    /// <summary>
+    /// Gets the playback voice or null if identifier is invalid.
+    /// </summary>
+    Voice* GetVoice(uint32 voiceId);
+
+    /// <summary>
+    /// Starts or resumes the voice playback.
+    /// </summary>
+    void Play(uint32 voiceId);
+
+    /// <summary>
+    /// Pauses the voice playback.
+    /// </summary>
+    void Pause(uint32 voiceId);
+
+    /// <summary>
+    /// Stops the voice playback and unbinds all the queued buffers.
+    /// </summary>
+    void Stop(uint32 voiceId);
+
+    /// <summary>
+    /// Queues the buffer to the voice playback. The pending start time is applied to the first queued buffer.
+    /// </summary>
+    void QueueBuffer(uint32 voiceId, uint32 bufferId);
+
+    /// <summary>
+    /// Unbinds the already processed buffers from the voice.
+    /// </summary>
+    void DequeueProcessedBuffers(uint32 voiceId);
+
+    /// <summary>
+    /// Sets the playback time (in seconds) relative to the start of the current buffer.
+    /// </summary>
+    void SetTime(uint32 voiceId, float time);
+
+    /// <summary>
+    /// Gets the playback time (in seconds) relative to the start of the current buffer.
+    /// </summary>
+    float GetTime(uint32 voiceId) const;
+
+    /// <summary>
+    /// Mixes the playing voices and advances their playback.
+    /// </summary>
+    /// <param name="output">The output buffer for the interleaved stereo samples (2 floats per frame). Can be null to advance the playback without the output.</param>
+    /// <param name="frames">The amount of frames to mix.</param>
+    void Mix(float* output, int32 frames);
+
+    /// <summary>
+    /// Mixes the given duration of audio (offline rendering) and saves it to the WAV file (16-bit PCM stereo).
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <param name="frames">The amount of frames to render.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool RenderToFile(const StringView& path, int32 frames);
+
+    /// <summary>
+    /// Saves the interleaved stereo samples to the WAV file (16-bit PCM).
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <param name="samples">The interleaved stereo samples.</param>
+    /// <param name="frames">The amount of frames.</param>
+    /// <param name="sampleRate">The sample rate.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool SaveWav(const StringView& path, const float* samples, int32 frames, int32 sampleRate);
+
+    /// <summary>
+    /// Releases all the voices and buffers.
+    /// </summary>
+    void Clear();
+
+private:
+
+    const Buffer* GetCurrentBuffer(const Voice& voice) const;
+    void UpdateVoices();
+    void ProcessBufferEnd(Voice& voice) const;
+    void Advance(Voice& voice, int32 frames) const;
+    void MixVoice(Voice& voice, float gainL, float gainR, int32 frames);
+};
+
+#endif
@@ -506,6 +506,11 @@ void AudioBackendXAudio2::Source_AttenuationChanged(AudioSource* source)
     // TODO: implement it
 }
 
+void AudioBackendXAudio2::Source_PriorityChanged(AudioSource* source)
+{
+    // Voices limit is not used by the XAudio2 backend
+}
+
 void AudioBackendXAudio2::Source_ClipLoaded(AudioSource* source)
 {
     auto aSource = XAudio2::GetSource(source);
@@ -0,0 +1,505 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "CSGBuildCache.h"
+
+#if COMPILE_WITH_CSG_BUILDER
+
+#include "CSGMesh.h"
+#include "CSGData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// Size of the spatial grid cell used to find overlapping brushes
+#define CSG_GRID_CELL_SIZE 1000.0f
+
+// Maximum amount of grid cells covered by a brush (bigger brushes are tested against all the other brushes)
+#define CSG_GRID_MAX_CELLS 512
+
+// Margin added to the brush bounds when testing overlaps (touching brushes share surfaces)
+#define CSG_ISLAND_MARGIN 1.0f
+
+using namespace CSG;
+
+namespace
+{
+    bool SurfaceEquals(const Surface& a, const Surface& b)
+    {
+        return a.Normal == b.Normal &&
+                a.D == b.D &&
+                a.Material == b.Material &&
+                a.TexCoordScale == b.TexCoordScale &&
+                a.TexCoordOffset == b.TexCoordOffset &&
+                a.TexCoordRotation == b.TexCoordRotation &&
+                a.ScaleInLightmap == b.ScaleInLightmap;
+    }
+
+    int32 CaptureNode(Actor* actor, BuildCache::Snapshot& snapshot, int32 parent)
+    {
+        const int32 nodeIndex = snapshot.Nodes.Count();
+        {
+            auto& node = snapshot.Nodes.AddOne();
+            node.Parent = parent;
+            node.Brush = -1;
+            node.Children.Clear();
+        }
+
+        // Check if actor is a brush
+        auto brush = dynamic_cast<Brush*>(actor);
+        if (brush && brush->CanUseCSG())
+        {
+            auto brushSnapshot = New<BuildCache::BrushSnapshot>();
+            brushSnapshot->BrushScene = brush->GetBrushScene();
+            brushSnapshot->ID = brush->GetBrushID();
+            brushSnapshot->BrushMode = brush->GetBrushMode();
+            brushSnapshot->ParentID = actor->GetParent() ? actor->GetParent()->GetID() : Guid::Empty;
+            brush->GetSurfaces(brushSnapshot->Surfaces);
+            snapshot.Nodes[nodeIndex].Brush = snapshot.Brushes.Count();
+            snapshot.Brushes.Add(brushSnapshot);
+            snapshot.BrushNodes.Add(nodeIndex);
+        }
+
+        for (Actor* child : actor->Children)
+        {
+            const int32 childIndex = CaptureNode(child, snapshot, nodeIndex);
+            if (childIndex != -1)
+                snapshot.Nodes[nodeIndex].Children.Add(childIndex);
+        }
+
+        // Skip actors without brushes in the subtree (all the subtree nodes have been already removed so it's the last one)
+        if (parent != -1 && snapshot.Nodes[nodeIndex].Brush == -1 && snapshot.Nodes[nodeIndex].Children.IsEmpty())
+        {
+            snapshot.Nodes.RemoveLast();
+            return -1;
+        }
+        return nodeIndex;
+    }
+
+    struct CombineContext
+    {
+        const BuildCache::Snapshot* Snapshot;
+        Array<Mesh*> Meshes;
+        Array<int32> NodeIslands;
+        int32 Island;
+    };
+
+    Mesh* Combine(CombineContext& context, int32 nodeIndex, Mesh* combineParent)
+    {
+        const auto& node = context.Snapshot->Nodes[nodeIndex];
+        Mesh* result = nullptr;
+        Mesh* myBrush = node.Brush != -1 ? context.Meshes[node.Brush] : nullptr;
+
+        // Get first child mesh with valid data (has additive brush)
+        int32 childIndex = 0;
+        while (childIndex < node.Children.Count())
+        {
+            const int32 childNode = node.Children[childIndex++];
+            if (context.NodeIslands[childNode] != context.Island)
+                continue;
+            auto child = Combine(context, childNode, combineParent);
+            if (child)
+            {
+                // If brush was based on additive brush or current actor is a brush we can stop searching
+                if (child->HasMode(Mode::Additive) || myBrush)
+                {
+                    // End searching
+                    result = child;
+                    break;
+                }
+
+                if (combineParent)
+                {
+                    // Combine
+                    combineParent->PerformOperation(child);
+                }
+            }
+        }
+
+        // Check if has any child with CSG brush
+        if (result)
+        {
+            // Check if has own brush
+            if (myBrush)
+            {
+                // Combine with first child
+                myBrush->PerformOperation(result);
+
+                // Set this actor brush as a result
+                result = myBrush;
+            }
+
+            // Merge with the other children
+            while (childIndex < node.Children.Count())
+            {
+                const int32 childNode = node.Children[childIndex++];
+                if (context.NodeIslands[childNode] != context.Island)
+                    continue;
+                auto child = Combine(context, childNode, result);
+                if (child)
+                {
+                    // Combine
+                    result->PerformOperation(child);
+                }
+            }
+        }
+        else
+        {
+            // Use this actor brush (may be empty)
+            result = myBrush;
+        }
+
+        return result;
+    }
+
+    int32 FindRoot(Array<int32>& parents, int32 i)
+    {
+        while (parents[i] != i)
+        {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    }
+
+    void Union(Array<int32>& parents, int32 a, int32 b)
+    {
+        a = FindRoot(parents, a);
+        b = FindRoot(parents, b);
+        if (a != b)
+        {
+            // Keep the lower index as a root to preserve the brushes order
+            if (a < b)
+                parents[b] = a;
+            else
+                parents[a] = b;
+        }
+    }
+
+    FORCE_INLINE int64 GetCellKey(int32 x, int32 y, int32 z)
+    {
+        return ((int64)(x & 0x1fffff) << 42) | ((int64)(y & 0x1fffff) << 21) | (int64)(z & 0x1fffff);
+    }
+}
+
+bool BuildCache::BrushSnapshot::Equals(const BrushSnapshot& other) const
+{
+    if (ID != other.ID || BrushMode != other.BrushMode || ParentID != other.ParentID || Surfaces.Count() != other.Surfaces.Count())
+        return false;
+    for (int32 i = 0; i < Surfaces.Count(); i++)
+    {
+        if (!SurfaceEquals(Surfaces[i], other.Surfaces[i]))
+            return false;
+    }
+    return true;
+}
+
+Scene* BuildCache::BrushSnapshot::GetBrushScene() const
+{
+    return BrushScene;
+}
+
+Guid BuildCache::BrushSnapshot::GetBrushID() const
+{
+    return ID;
+}
+
+Mode BuildCache::BrushSnapshot::GetBrushMode() const
+{
+    return BrushMode;
+}
+
+void BuildCache::BrushSnapshot::GetSurfaces(Array<Surface, HeapAllocation>& surfaces)
+{
+    surfaces = Surfaces;
+}
+
+int32 BuildCache::BrushSnapshot::GetSurfacesCount()
+{
+    return Surfaces.Count();
+}
+
+void BuildCache::Snapshot::Clear()
+{
+    Nodes.Clear();
+    Brushes.ClearDelete();
+    BrushNodes.Clear();
+}
+
+void BuildCache::Capture(Actor* root, Snapshot& snapshot)
+{
+    PROFILE_CPU_NAMED("CSG.Capture");
+    snapshot.Clear();
+    if (root)
+        CaptureNode(root, snapshot, -1);
+}
+
+void BuildCache::Build(Snapshot& snapshot, RawData& data)
+{
+    PROFILE_CPU_NAMED("CSG.Build");
+    const double startTime = Platform::GetTimeSeconds();
+    const int32 brushesCount = snapshot.Brushes.Count();
+    LastStats = Stats();
+    LastStats.Brushes = brushesCount;
+    _stamp++;
+
+    // Build meshes for the new and modified brushes (reuse meshes of the unchanged brushes)
+    Array<BrushSnapshot*> toDeleteBrushes;
+    Array<Mesh*> toDeleteMeshes;
+    Array<bool> dirty;
+    dirty.Resize(brushesCount);
+    Array<Mesh*> meshes;
+    meshes.Resize(brushesCount);
+    {
+        PROFILE_CPU_NAMED("Brushes");
+        for (int32 i = 0; i < brushesCount; i++)
+        {
+            BrushSnapshot* brush = snapshot.Brushes[i];
+            CachedBrush* cached = _brushes.TryGet(brush->ID);
+            if (cached && cached->Brush->Equals(*brush))
+            {
+                Delete(brush);
+                snapshot.Brushes[i] = cached->Brush;
+                dirty[i] = false;
+            }
+            else
+            {
+                Mesh* mesh = New<Mesh>();
+                mesh->Build(brush);
+                if (cached)
+                {
+                    toDeleteBrushes.Add(cached->Brush);
+                    toDeleteMeshes.Add(cached->Mesh);
+                }
+                else
+                {
+                    cached = &_brushes[brush->ID];
+                }
+                cached->Brush = brush;
+                cached->Mesh = mesh;
+                dirty[i] = true;
+                LastStats.BuiltBrushes++;
+            }
+            cached->Stamp = _stamp;
+
+            // Skip brushes that failed to build (eg. too many planes)
+            meshes[i] = cached->Mesh->GetVertices()->HasItems() ? cached->Mesh : nullptr;
+        }
+    }
+
+    // Remove brushes missing in the snapshot (deleted or disabled)
+    for (auto i = _brushes.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value.Stamp != _stamp)
+        {
+            toDeleteBrushes.Add(i->Value.Brush);
+            toDeleteMeshes.Add(i->Value.Mesh);
+            _brushes.Remove(i);
+        }
+    }
+
+    // Find islands of the brushes with overlapping bounds (brushes from different islands don't affect each other)
+    Array<int32> parents;
+    parents.Resize(brushesCount);
+    {
+        PROFILE_CPU_NAMED("Islands");
+        Dictionary<int64, Array<int32>> grid(brushesCount * 2);
+        Array<int32> largeBrushes;
+        Array<AABB> bounds;
+        bounds.Resize(brushesCount);
+        for (int32 i = 0; i < brushesCount; i++)
+        {
+            parents[i] = i;
+            if (!meshes[i])
+                continue;
+            AABB& box = bounds[i];
+            box = meshes[i]->GetBounds();
+            box.Minimum -= CSG_ISLAND_MARGIN;
+            box.Maximum += CSG_ISLAND_MARGIN;
+            const Vector3 cellMin = box.Minimum / CSG_GRID_CELL_SIZE;
+            const Vector3 cellMax = box.Maximum / CSG_GRID_CELL_SIZE;
+            const Int3 min((int32)Math::Floor(cellMin.X), (int32)Math::Floor(cellMin.Y), (int32)Math::Floor(cellMin.Z));
+            const Int3 max((int32)Math::Floor(cellMax.X), (int32)Math::Floor(cellMax.Y), (int32)Math::Floor(cellMax.Z));
+            const int64 cellsCount = (int64)(max.X - min.X + 1) * (max.Y - min.Y + 1) * (max.Z - min.Z + 1);
+            if (cellsCount > CSG_GRID_MAX_CELLS)
+            {
+                largeBrushes.Add(i);
+                continue;
+            }
+            for (int32 x = min.X; x <= max.X; x++)
+            {
+                for (int32 y = min.Y; y <= max.Y; y++)
+                {
+                    for (int32 z = min.Z; z <= max.Z; z++)
+                    {
+                        auto& cell = grid[GetCellKey(x, y, z)];
+                        for (int32 j : cell)
+                        {
+                            if (FindRoot(parents, i) != FindRoot(parents, j) && !AABB::IsOutside(box, bounds[j]))
+                                Union(parents, i, j);
+                        }
+                        cell.Add(i);
+                    }
+                }
+            }
+        }
+        for (int32 i : largeBrushes)
+        {
+            for (int32 j = 0; j < brushesCount; j++)
+            {
+                if (meshes[j] && i != j && FindRoot(parents, i) != FindRoot(parents, j) && !AABB::IsOutside(bounds[i], bounds[j]))
+                    Union(parents, i, j);
+            }
+        }
+    }
+
+    // Gather islands members (in the hierarchy order)
+    Array<Island> islands;
+    Array<Array<int32>> islandsBrushes;
+    Array<int32> brushIslands;
+    brushIslands.Resize(brushesCount);
+    for (int32 i = 0; i < brushesCount; i++)
+    {
+        brushIslands[i] = -1;
+        if (!meshes[i])
+            continue;
+        const int32 root = FindRoot(parents, i);
+        if (root == i)
+        {
+            brushIslands[i] = islands.Count();
+            auto& island = islands.AddOne();
+            island.Members.Clear();
+            island.Result = nullptr;
+            islandsBrushes.AddOne().Clear();
+        }
+        else
+        {
+            brushIslands[i] = brushIslands[root];
+        }
+        islands[brushIslands[i]].Members.Add(snapshot.Brushes[i]->ID);
+        islandsBrushes[brushIslands[i]].Add(i);
+    }
+    LastStats.Islands = islands.Count();
+
+    // Reuse results of the unchanged islands
+    Dictionary<Guid, int32> oldIslands(_islands.Count() * 2);
+    for (int32 i = 0; i < _islands.Count(); i++)
+    {
+        if (_islands[i].Members.HasItems())
+            oldIslands[_islands[i].Members[0]] = i;
+    }
+    Array<bool> islandsReused;
+    islandsReused.Resize(islands.Count());
+    for (int32 i = 0; i < islands.Count(); i++)
+    {
+        auto& island = islands[i];
+        islandsReused[i] = false;
+        int32 oldIndex;
+        if (!oldIslands.TryGet(island.Members[0], oldIndex))
+            continue;
+        auto& oldIsland = _islands[oldIndex];
+        if (oldIsland.Members != island.Members)
+            continue;
+        bool isDirty = false;
+        for (int32 j : islandsBrushes[i])
+            isDirty |= dirty[j];
+        if (isDirty)
+            continue;
+        island.Result = oldIsland.Result;
+        oldIsland.Result = nullptr;
+        islandsReused[i] = true;
+    }
+
+    // Combine the modified islands (performs actual CSG operations on geometry in tree structure)
+    {
+        PROFILE_CPU_NAMED("Combine");
+        CombineContext context;
+        context.Snapshot = &snapshot;
+        context.Meshes.Resize(brushesCount);
+        Platform::MemoryClear(context.Meshes.Get(), context.Meshes.Count() * sizeof(Mesh*));
+        context.NodeIslands.Resize(snapshot.Nodes.Count());
+        for (int32& e : context.NodeIslands)
+            e = -1;
+        Array<int32> islandMeshes;
+        for (int32 islandIndex = 0; islandIndex < islands.Count(); islandIndex++)
+        {
+            if (islandsReused[islandIndex])
+                continue;
+            LastStats.CombinedIslands++;
+            context.Island = islandIndex;
+
+            // Copy island brush meshes (operations modify meshes) and mark nodes of the island subtree
+            islandMeshes.Clear();
+            bool started = false;
+            for (int32 i : islandsBrushes[islandIndex])
+            {
+                // Skip subtract meshes from the beginning (they have no effect)
+                if (!started && snapshot.Brushes[i]->BrushMode != Mode::Additive)
+                {
+                    LOG(Info, "Skipping CSG brush '{0}'", snapshot.Brushes[i]->ID);
+                    continue;
+                }
+                started = true;
+                context.Meshes[i] = New<Mesh>(*meshes[i]);
+                islandMeshes.Add(i);
+                for (int32 node = snapshot.BrushNodes[i]; node != -1 && context.NodeIslands[node] != islandIndex; node = snapshot.Nodes[node].Parent)
+                    context.NodeIslands[node] = islandIndex;
+            }
+            if (islandMeshes.IsEmpty())
+                continue;
+
+            Mesh* result = Combine(context, 0, nullptr);
+            islands[islandIndex].Result = result;
+            for (int32 i : islandMeshes)
+            {
+                // Other meshes have been merged into the result
+                if (context.Meshes[i] != result)
+                    Delete(context.Meshes[i]);
+                context.Meshes[i] = nullptr;
+            }
+        }
+    }
+
+    // Free the old data (after islands that could reference old brushes)
+    for (auto& island : _islands)
+    {
+        if (island.Result)
+            Delete(island.Result);
+    }
+    _islands = MoveTemp(islands);
+    toDeleteMeshes.ClearDelete();
+    toDeleteBrushes.ClearDelete();
+    snapshot.Brushes.Clear();
+
+    // Triangulate meshes
+    {
+        PROFILE_CPU_NAMED("Triangulate");
+        Array<RawModelVertex> vertexBuffer;
+        for (auto& island : _islands)
+        {
+            if (island.Result)
+                island.Result->Triangulate(data, vertexBuffer);
+        }
+    }
+
+    LastStats.TimeMs = (Platform::GetTimeSeconds() - startTime) * 1000.0;
+}
+
+void BuildCache::Clear()
+{
+    for (auto& island : _islands)
+    {
+        if (island.Result)
+            Delete(island.Result);
+    }
+    _islands.Clear();
+    for (auto i = _brushes.Begin(); i.IsNotEnd(); ++i)
+    {
+        Delete(i->Value.Mesh);
+        Delete(i->Value.Brush);
+    }
+    _brushes.Clear();
+}
+
+#endif
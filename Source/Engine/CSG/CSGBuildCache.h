@@ -0,0 +1,147 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Brush.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+#if COMPILE_WITH_CSG_BUILDER
+
+class Actor;
+
+namespace CSG
+{
+    class Mesh;
+    class RawData;
+
+    /// <summary>
+    /// Incremental CSG geometry builder. Brushes are grouped into islands (brushes with overlapping bounds found via spatial grid) that are combined independently.
+    /// Keeps the brush meshes and the combined islands from the previous build so only the modified brushes and the islands affected by them get rebuilt.
+    /// </summary>
+    class FLAXENGINE_API BuildCache
+    {
+    public:
+
+        /// <summary>
+        /// The brush data captured on the main thread (can be processed on any thread).
+        /// </summary>
+        class FLAXENGINE_API BrushSnapshot : public Brush
+        {
+        public:
+
+            Scene* BrushScene = nullptr;
+            Guid ID;
+            Mode BrushMode;
+            Guid ParentID;
+            Array<Surface> Surfaces;
+
+            bool Equals(const BrushSnapshot& other) const;
+
+        public:
+
+            // [Brush]
+            Scene* GetBrushScene() const override;
+            Guid GetBrushID() const override;
+            Mode GetBrushMode() const override;
+            void GetSurfaces(Array<Surface, HeapAllocation>& surfaces) override;
+            int32 GetSurfacesCount() override;
+        };
+
+        /// <summary>
+        /// The actors hierarchy node captured on the main thread (only actors with brushes in the subtree are captured).
+        /// </summary>
+        struct Node
+        {
+            int32 Parent;
+            int32 Brush;
+            Array<int32> Children;
+        };
+
+        /// <summary>
+        /// The scene CSG brushes captured on the main thread.
+        /// </summary>
+        struct Snapshot
+        {
+            Array<Node> Nodes;
+            Array<BrushSnapshot*> Brushes;
+            Array<int32> BrushNodes;
+
+            ~Snapshot()
+            {
+                Clear();
+            }
+
+            void Clear();
+        };
+
+        /// <summary>
+        /// The last build statistics.
+        /// </summary>
+        struct Stats
+        {
+            int32 Brushes = 0;
+            int32 BuiltBrushes = 0;
+            int32 Islands = 0;
+            int32 CombinedIslands = 0;
+            double TimeMs = 0;
+        };
+
+    private:
+
+        struct CachedBrush
+        {
+            BrushSnapshot* Brush;
+            Mesh* Mesh;
+            uint32 Stamp;
+        };
+
+        struct Island
+        {
+            Array<Guid> Members;
+            Mesh* Result;
+        };
+
+        Dictionary<Guid, CachedBrush> _brushes;
+        Array<Island> _islands;
+        uint32 _stamp = 0;
+
+    public:
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="BuildCache"/> class.
+        /// </summary>
+        ~BuildCache()
+        {
+            Clear();
+        }
+
+    public:
+
+        /// <summary>
+        /// The last build statistics.
+        /// </summary>
+        Stats LastStats;
+
+        /// <summary>
+        /// Captures the brushes from the actors hierarchy. Must be called on the main thread.
+        /// </summary>
+        /// <param name="root">The hierarchy root actor (eg. scene).</param>
+        /// <param name="snapshot">The output snapshot.</param>
+        static void Capture(Actor* root, Snapshot& snapshot);
+
+        /// <summary>
+        /// Builds the CSG geometry of the captured brushes. Can be called on any thread. The snapshot brushes are consumed by the cache.
+        /// </summary>
+        /// <param name="snapshot">The captured brushes.</param>
+        /// <param name="data">The output geometry data.</param>
+        void Build(Snapshot& snapshot, RawData& data);
+
+        /// <summary>
+        /// Clears the cached data.
+        /// </summary>
+        void Clear();
+    };
+};
+
+#endif
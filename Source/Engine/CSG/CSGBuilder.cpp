@@ -3,9 +3,9 @@
 #include "CSGBuilder.h"
 #include "CSGMesh.h"
 #include "CSGData.h"
+#include "CSGBuildCache.h"
 #include "Engine/Level/Level.h"
-#include "Engine/Level/SceneQuery.h"
-#include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/Scene.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Graphics/Models/ModelData.h"
@@ -18,6 +18,7 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/ThreadPoolTask.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -26,23 +27,74 @@
 
 using namespace CSG;
 
-// Enable/disable locking scene during building CSG brushes nodes
-#define CSG_USE_SCENE_LOCKS 0
-
-struct BuildData;
+struct SceneBuild;
 
 namespace CSGBuilderImpl
 {
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Scene*, SceneBuild*> Builds;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
-    bool buildInner(Scene* scene, BuildData& data);
-    void build(Scene* scene);
-    bool generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath);
+    bool buildInner(SceneBuild& build);
+    void startBuild(Scene* scene, SceneBuild& build);
+    void endBuild(SceneBuild& build);
+    bool generateRawDataAsset(RawData& meshData, Guid& assetId, const String& assetPath);
 }
 
 using namespace CSGBuilderImpl;
 
+/// <summary>
+/// The scene CSG building state. Brushes are captured on the main thread and the geometry is built on a thread pool (incrementally, using the data from the previous builds).
+/// </summary>
+struct SceneBuild
+{
+    Scene* TargetScene;
+    BuildCache Cache;
+    BuildCache::Snapshot Snapshot;
+    Task* Job = nullptr;
+    double StartTime;
+
+    // Inputs (captured on the main thread)
+    Transform SceneTransform;
+    String SceneDataFolderPath;
+    Guid ModelAssetId;
+    Guid RawDataAssetId;
+    Guid CollisionDataAssetId;
+
+    // Outputs
+    Guid OutputModelAssetId;
+    Guid OutputRawDataAssetId;
+    Guid OutputCollisionDataAssetId;
+
+    ~SceneBuild()
+    {
+        if (Job)
+            Job->Wait();
+    }
+};
+
+class CSGBuildTask : public ThreadPoolTask
+{
+private:
+
+    SceneBuild* _build;
+
+public:
+
+    CSGBuildTask(SceneBuild* build)
+        : _build(build)
+    {
+    }
+
+protected:
+
+    // [ThreadPoolTask]
+    bool Run() override
+    {
+        return buildInner(*_build);
+    }
+};
+
 class CSGBuilderService : public EngineService
 {
 public:
@@ -53,6 +105,7 @@ class CSGBuilderService : public EngineService
 
     bool Init() override;
     void Update() override;
+    void Dispose() override;
 };
 
 CSGBuilderService CSGBuilderServiceInstance;
@@ -63,6 +116,12 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    SceneBuild* build;
+    if (Builds.TryGet(scene, build))
+    {
+        Builds.Remove(scene);
+        Delete(build);
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -74,6 +133,17 @@ bool CSGBuilderService::Init()
 
 void CSGBuilderService::Update()
 {
+    // Apply the finished builds
+    for (auto& e : Builds)
+    {
+        SceneBuild* build = e.Value;
+        if (build->Job && build->Job->IsEnded())
+        {
+            build->Job = nullptr;
+            endBuild(*build);
+        }
+    }
+
     // Check if build is pending
     if (ScenesToRebuild.HasItems() && Engine::IsReady())
     {
@@ -84,17 +154,44 @@ void CSGBuilderService::Update()
             auto scene = ScenesToRebuild[i];
             if (now - scene->CSGData.BuildTime >= 0)
             {
+                SceneBuild* build;
+                if (!Builds.TryGet(scene, build))
+                {
+                    build = New<SceneBuild>();
+                    build->TargetScene = scene;
+                    Builds.Add(scene, build);
+                }
+
+                // Wait for the active build to end (scene will be built again with the latest changes)
+                if (build->Job)
+                    continue;
+
                 scene->CSGData.BuildTime.Ticks = 0;
                 ScenesToRebuild.RemoveAt(i--);
-                build(scene);
+                startBuild(scene, *build);
             }
         }
     }
 }
 
+void CSGBuilderService::Dispose()
+{
+    for (auto& e : Builds)
+        Delete(e.Value);
+    Builds.Clear();
+    ScenesToRebuild.Clear();
+}
+
 bool Builder::IsActive()
 {
-    return ScenesToRebuild.HasItems();
+    if (ScenesToRebuild.HasItems())
+        return true;
+    for (auto& e : Builds)
+    {
+        if (e.Value->Job)
+            return true;
+    }
+    return false;
 }
 
 void Builder::Build(Scene* scene, float timeoutMs)
@@ -116,154 +213,15 @@ void Builder::Build(Scene* scene, float timeoutMs)
     scene->CSGData.BuildTime = DateTime::NowUTC() + TimeSpan::FromMilliseconds(timeoutMs);
 }
 
-namespace CSG
+bool CSGBuilderImpl::buildInner(SceneBuild& build)
 {
-    typedef Dictionary<Actor*, Mesh*> MeshesLookup;
+    build.OutputModelAssetId = Guid::Empty;
+    build.OutputRawDataAssetId = Guid::Empty;
+    build.OutputCollisionDataAssetId = Guid::Empty;
 
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
-    {
-        // Check if actor is a brush
-        auto brush = dynamic_cast<Brush*>(actor);
-        if (brush)
-        {
-            // Check if can build it
-            if (brush->CanUseCSG())
-            {
-                // Skip subtract/common meshes from the beginning (they have no effect)
-                if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
-                {
-                    // Create new mesh and build for given brush
-                    auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
-
-                    // Save results
-                    meshes.Add(mesh);
-                    cache.Add(actor, mesh);
-                }
-                else
-                {
-                    // Info
-                    LOG(Info, "Skipping CSG brush '{0}'", actor->ToString());
-                }
-            }
-        }
-
-        return true;
-    }
-
-    Mesh* Combine(Actor* actor, MeshesLookup& cache, Mesh* combineParent)
-    {
-        ASSERT(actor);
-        Mesh* result = nullptr;
-        Mesh* myBrush = nullptr;
-        cache.TryGet(actor, myBrush);
-
-        // Get first child mesh with valid data (has additive brush)
-        int32 childIndex = 0;
-        while (childIndex < actor->Children.Count())
-        {
-            auto child = Combine(actor->Children[childIndex], cache, combineParent);
-
-            childIndex++;
-            if (child)
-            {
-                // If brush was based on additive brush or current actor is a brush we can stop searching
-                if (child->HasMode(Mode::Additive) || myBrush)
-                {
-                    // End searching
-                    result = child;
-                    break;
-                }
-
-                if (combineParent)
-                {
-                    // Combine
-                    combineParent->PerformOperation(child);
-                }
-            }
-        }
-
-        // Check if has any child with CSG brush
-        if (result)
-        {
-            // Check if has own brush
-            if (myBrush)
-            {
-                // Combine with first child
-                myBrush->PerformOperation(result);
-
-                // Set this actor brush as a result
-                result = myBrush;
-            }
-
-            // Merge with the other children
-            while (childIndex < actor->Children.Count())
-            {
-                auto child = Combine(actor->Children[childIndex], cache, result);
-                if (child)
-                {
-                    // Combine
-                    result->PerformOperation(child);
-                }
-
-                childIndex++;
-            }
-        }
-        else
-        {
-            // Use this actor brush (may be empty)
-            result = myBrush;
-        }
-
-        return result;
-    }
-
-    Mesh* Combine(Scene* scene, MeshesLookup& cache)
-    {
-#if CSG_USE_SCENE_LOCKS
-		auto Level = Level::Instance();
-		Level->Lock();
-#endif
-
-        Mesh* result = Combine(scene, cache, nullptr);
-
-#if CSG_USE_SCENE_LOCKS
-		Level->Unlock();
-#endif
-
-        return result;
-    }
-}
-
-struct BuildData
-{
-    MeshesArray meshes;
-    MeshesLookup cache;
-    Guid outputModelAssetId = Guid::Empty;
-    Guid outputRawDataAssetId = Guid::Empty;
-    Guid outputCollisionDataAssetId = Guid::Empty;
-
-    BuildData(int32 meshesCapacity = 32)
-        : meshes(meshesCapacity * 32)
-        , cache(meshesCapacity * 4)
-    {
-    }
-};
-
-bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
-{
-    // Setup CSG meshes list and build them
-    {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
-    }
-    if (data.meshes.IsEmpty())
-        return false;
-
-    // Process all meshes (performs actual CSG opterations on geometry in tree structure)
-    CSG::Mesh* combinedMesh = Combine(scene, data.cache);
-    if (combinedMesh == nullptr)
-        return false;
+    // Process all brushes (performs actual CSG operations on geometry in tree structure, reuses unmodified parts from the previous build)
+    RawData meshData;
+    build.Cache.Build(build.Snapshot, meshData);
 
     // TODO: split too big meshes (too many verts, to far parts, etc.)
 
@@ -272,29 +230,27 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
         // TODO: setup valid loop for splited meshes
 
         // Convert CSG meshes into raw triangles data
-        RawData meshData;
-        Array<RawModelVertex> vertexBuffer;
-        combinedMesh->Triangulate(meshData, vertexBuffer);
         meshData.RemoveEmptySlots();
         if (meshData.Slots.HasItems())
         {
-            const auto sceneDataFolderPath = scene->GetDataFolderPath();
+            const String& sceneDataFolderPath = build.SceneDataFolderPath;
+            Matrix sceneWorld, sceneWorldToLocal;
+            build.SceneTransform.GetWorld(sceneWorld);
+            Matrix::Invert(sceneWorld, sceneWorldToLocal);
 
             // Convert CSG mesh data to common storage type
             ModelData modelData;
             meshData.ToModelData(modelData);
 
             // Convert CSG mesh to the local transformation of the scene
-            if (!scene->GetTransform().IsIdentity())
+            if (!build.SceneTransform.IsIdentity())
             {
-                Matrix t;
-                scene->GetWorldToLocalMatrix(t);
-                modelData.TransformBuffer(t);
+                modelData.TransformBuffer(sceneWorldToLocal);
             }
 
             // Import model data to the asset
             {
-                Guid modelDataAssetId = scene->CSGData.Model.GetID();
+                Guid modelDataAssetId = build.ModelAssetId;
                 if (!modelDataAssetId.IsValid())
                     modelDataAssetId = Guid::New();
                 const String modelDataAssetPath = sceneDataFolderPath / TEXT("CSG_Mesh") + ASSET_FILES_EXTENSION_WITH_DOT;
@@ -303,32 +259,28 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
                     LOG(Warning, "Failed to import CSG mesh data");
                     return true;
                 }
-                data.outputModelAssetId = modelDataAssetId;
+                build.OutputModelAssetId = modelDataAssetId;
             }
 
             // Generate asset with CSG mesh metadata (for collisions and brush queries)
             {
-                Guid rawDataAssetId = scene->CSGData.Data.GetID();
+                Guid rawDataAssetId = build.RawDataAssetId;
                 if (!rawDataAssetId.IsValid())
                     rawDataAssetId = Guid::New();
                 const String rawDataAssetPath = sceneDataFolderPath / TEXT("CSG_Data") + ASSET_FILES_EXTENSION_WITH_DOT;
-                if (generateRawDataAsset(scene, meshData, rawDataAssetId, rawDataAssetPath))
+                if (generateRawDataAsset(meshData, rawDataAssetId, rawDataAssetPath))
                 {
                     LOG(Warning, "Failed to create raw CSG data");
                     return true;
                 }
-                data.outputRawDataAssetId = rawDataAssetId;
+                build.OutputRawDataAssetId = rawDataAssetId;
             }
 
             // Generate CSG mesh collision asset
             {
                 // Convert CSG mesh to scene local space (fix issues when scene has transformation applied)
-                if (!scene->GetTransform().IsIdentity())
+                if (!build.SceneTransform.IsIdentity())
                 {
-                    Matrix m1, m2;
-                    scene->GetTransform().GetWorld(m1);
-                    Matrix::Invert(m1, m2);
-
                     for (int32 lodIndex = 0; lodIndex < modelData.LODs.Count(); lodIndex++)
                     {
                         auto lod = &modelData.LODs[lodIndex];
@@ -336,7 +288,7 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
                         {
                             Array<Float3>& v = lod->Meshes[meshIndex]->Positions;
                             for (int32 i = 0; i < v.Count(); i++)
-                                Float3::Transform(v[i], m2, v[i]);
+                                Float3::Transform(v[i], sceneWorldToLocal, v[i]);
                         }
                     }
                 }
@@ -345,7 +297,7 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
                 CollisionCooking::Argument arg;
                 arg.Type = CollisionDataType::TriangleMesh;
                 arg.OverrideModelData = &modelData;
-                Guid collisionDataAssetId = scene->CSGData.CollisionData.GetID();
+                Guid collisionDataAssetId = build.CollisionDataAssetId;
                 if (!collisionDataAssetId.IsValid())
                     collisionDataAssetId = Guid::New();
                 const String collisionDataAssetPath = sceneDataFolderPath / TEXT("CSG_Collision") + ASSET_FILES_EXTENSION_WITH_DOT;
@@ -354,9 +306,9 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
                     LOG(Warning, "Failed to cook CSG mesh collision data");
                     return true;
                 }
-                data.outputCollisionDataAssetId = collisionDataAssetId;
+                build.OutputCollisionDataAssetId = collisionDataAssetId;
 #else
-                data.outputCollisionDataAssetId = Guid::Empty;
+                build.OutputCollisionDataAssetId = Guid::Empty;
 #endif
             }
         }
@@ -365,30 +317,41 @@ bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
     return false;
 }
 
-void CSGBuilderImpl::build(Scene* scene)
+void CSGBuilderImpl::startBuild(Scene* scene, SceneBuild& build)
 {
     // Start
-    auto startTime = DateTime::Now();
+    build.StartTime = Platform::GetTimeSeconds();
     LOG(Info, "Start building CSG...");
 
-    // Build
-    BuildData data;
-    bool failed = buildInner(scene, data);
+    // Capture brushes and scene data on the main thread
+    BuildCache::Capture(scene, build.Snapshot);
+    build.SceneTransform = scene->GetTransform();
+    build.SceneDataFolderPath = scene->GetDataFolderPath();
+    build.ModelAssetId = scene->CSGData.Model.GetID();
+    build.RawDataAssetId = scene->CSGData.Data.GetID();
+    build.CollisionDataAssetId = scene->CSGData.CollisionData.GetID();
 
-    // Link new (or empty) CSG mesh
-    scene->CSGData.Data = Content::LoadAsync<RawDataAsset>(data.outputRawDataAssetId);
-    scene->CSGData.Model = Content::LoadAsync<Model>(data.outputModelAssetId);
-    scene->CSGData.CollisionData = Content::LoadAsync<CollisionData>(data.outputCollisionDataAssetId);
+    // Build in async
+    build.Job = Task::StartNew(New<CSGBuildTask>(&build));
+}
+
+void CSGBuilderImpl::endBuild(SceneBuild& build)
+{
+    // Link new (or empty) CSG mesh (swap all assets at once)
+    Scene* scene = build.TargetScene;
+    scene->CSGData.Data = Content::LoadAsync<RawDataAsset>(build.OutputRawDataAssetId);
+    scene->CSGData.Model = Content::LoadAsync<Model>(build.OutputModelAssetId);
+    scene->CSGData.CollisionData = Content::LoadAsync<CollisionData>(build.OutputCollisionDataAssetId);
     // TODO: also set CSGData.InstanceBuffer - lightmap scales for the entries so csg mesh gets better quality in lightmaps
     scene->CSGData.PostCSGBuild();
 
     // End
-    data.meshes.ClearDelete();
-    auto endTime = DateTime::Now();
-    LOG(Info, "CSG build in {0} ms! {1} brush(es)", (endTime - startTime).GetTotalMilliseconds(), data.meshes.Count());
+    const auto& stats = build.Cache.LastStats;
+    const double totalTime = (Platform::GetTimeSeconds() - build.StartTime) * 1000.0;
+    LOG(Info, "CSG build in {0} ms (geometry {1} ms)! {2} brush(es), {3} rebuilt, {4} of {5} island(s) combined", totalTime, stats.TimeMs, stats.Brushes, stats.BuiltBrushes, stats.CombinedIslands, stats.Islands);
 }
 
-bool CSGBuilderImpl::generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath)
+bool CSGBuilderImpl::generateRawDataAsset(RawData& meshData, Guid& assetId, const String& assetPath)
 {
     // Prepare data
     MemoryWriteStream stream(4096);
@@ -10,6 +10,7 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Threading/MainThreadTask.h"
 #include "Engine/Threading/ConcurrentTaskQueue.h"
 #if USE_MONO
@@ -547,6 +548,8 @@ bool Asset::IsInternalType() const
 
 bool Asset::onLoad(LoadAssetTask* task)
 {
+    PROFILE_MEM(Content);
+
     // It may fail when task is cancelled and new one is created later (don't crash but just end with an error)
     if (task->Asset.Get() != this || _loadingTask == nullptr)
         return true;
@@ -3,6 +3,7 @@
 #include "Animation.h"
 #include "SkinnedModel.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Name.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
 #include "Engine/Animations/CurveSerialization.h"
@@ -110,22 +111,22 @@ const Animation::NodeToChannel* Animation::GetMapping(SkinnedModel* obj)
         obj->OnUnloaded.Bind<Animation, &Animation::OnSkinnedModelUnloaded>(this);
         obj->OnReloading.Bind<Animation, &Animation::OnSkinnedModelUnloaded>(this);
 
-        // Initialize the mapping
+        // Initialize the mapping (match nodes with channels by the interned names instead of comparing strings for each pair)
         const auto& skeleton = obj->Skeleton;
         const int32 nodesCount = skeleton.Nodes.Count();
         result->Resize(nodesCount, false);
         result->SetAll(-1);
+        Dictionary<Name, int32> channels(Data.Channels.Count() * 2);
         for (int32 i = 0; i < Data.Channels.Count(); i++)
+            channels[Name(Data.Channels[i].NodeName)] = i;
+        Name nodeName;
+        int32 channelIndex;
+        for (int32 j = 0; j < nodesCount; j++)
         {
-            auto& nodeAnim = Data.Channels[i];
-
-            for (int32 j = 0; j < nodesCount; j++)
+            if (Name::Find(skeleton.Nodes[j].Name, nodeName) && channels.TryGet(nodeName, channelIndex))
             {
-                if (skeleton.Nodes[j].Name == nodeAnim.NodeName)
-                {
-                    result->At(j) = i;
-                    break;
-                }
+                result->At(j) = channelIndex;
+                channels.Remove(nodeName);
             }
         }
     }
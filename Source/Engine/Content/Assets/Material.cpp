@@ -75,6 +75,12 @@ bool Material::CanUseInstancing(InstancingHandler& handler) const
     return _materialShader && _materialShader->CanUseInstancing(handler);
 }
 
+void Material::Prewarm()
+{
+    if (_materialShader && _materialShader->IsReady())
+        _materialShader->Prewarm();
+}
+
 void Material::Bind(BindParameters& params)
 {
     ASSERT(IsReady());
@@ -47,6 +47,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Material : public ShaderAssetTypeBase<Ma
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
+    void Prewarm() override;
     void Bind(BindParameters& params) override;
 
     // [ShaderAssetBase]
@@ -55,6 +55,14 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MaterialBase : public BinaryAs
         return Params.Get(name);
     }
 
+    /// <summary>
+    /// Gets the material parameter (by the interned name, eg. cached in a static variable for the frequent lookups).
+    /// </summary>
+    FORCE_INLINE MaterialParameter* GetParameter(const Name& name)
+    {
+        return Params.Get(name);
+    }
+
     /// <summary>
     /// Gets the material parameter value.
     /// </summary>
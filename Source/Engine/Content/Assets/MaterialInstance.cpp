@@ -170,6 +170,12 @@ bool MaterialInstance::CanUseInstancing(InstancingHandler& handler) const
     return _baseMaterial && _baseMaterial->CanUseInstancing(handler);
 }
 
+void MaterialInstance::Prewarm()
+{
+    if (_baseMaterial)
+        _baseMaterial->Prewarm();
+}
+
 void MaterialInstance::Bind(BindParameters& params)
 {
     //ASSERT(IsReady());
@@ -60,6 +60,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialInstance : public MaterialBase
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
+    void Prewarm() override;
     void Bind(BindParameters& params) override;
 
 protected:
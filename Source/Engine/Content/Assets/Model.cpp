@@ -200,6 +200,7 @@ void Model::Draw(const RenderContext& renderContext, MaterialBase* material, con
     if (lodIndex == -1)
         return;
     lodIndex += renderContext.View.ModelLODBias;
+    RequestLOD(lodIndex);
     lodIndex = ClampLODIndex(lodIndex);
 
     // Draw
@@ -254,6 +255,7 @@ void Model::Draw(const RenderContext& renderContext, const Mesh::DrawInfo& info)
         }
     }
     lodIndex += info.LODBias + renderContext.View.ModelLODBias;
+    RequestLOD(lodIndex);
     lodIndex = ClampLODIndex(lodIndex);
 
     if (renderContext.View.IsSingleFrame)
@@ -402,6 +404,13 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                 stream->WriteBool(mesh.HasLightmapUVs());
             }
         }
+
+        // UVs density
+        for (int32 lodIndex = 0; lodIndex < lods; lodIndex++)
+        {
+            for (const Mesh& mesh : LODs[lodIndex].Meshes)
+                stream->WriteFloat(mesh.GetUVDensity());
+        }
     }
 
     // Use a temporary chunks for data storage for virtual assets
@@ -952,6 +961,20 @@ Asset::LoadResult Model::load()
         }
     }
 
+    // UVs density (optional, missing in models saved before)
+    if (stream->CanRead())
+    {
+        for (auto& lod : LODs)
+        {
+            for (auto& mesh : lod.Meshes)
+            {
+                float uvDensity;
+                stream->ReadFloat(&uvDensity);
+                mesh.SetUVDensity(uvDensity);
+            }
+        }
+    }
+
     // Load SDF
     auto chunk15 = GetChunk(15);
     if (chunk15 && chunk15->IsLoaded() && EnableModelSDF == 1)
@@ -1065,6 +1088,60 @@ void ModelBase::SetupMaterialSlots(int32 slotsCount)
         MaterialSlots[i].Name = String::Format(TEXT("Material {0}"), i + 1);
 }
 
+int32 ModelBase::UpdateUsedLOD(double currentTime, float timeout)
+{
+    // Flush the requests
+    int32 requestedLOD = Platform::AtomicRead(&_requestedLOD);
+    while (requestedLOD != MAX_int32)
+    {
+        const int32 prev = Platform::InterlockedCompareExchange(&_requestedLOD, MAX_int32, requestedLOD);
+        if (prev == requestedLOD)
+            break;
+        requestedLOD = prev;
+    }
+    if (requestedLOD != MAX_int32)
+        requestedLOD = Math::Max(requestedLOD, 0);
+
+    // Higher quality LOD is used at once, lower quality LOD (or none) replaces it only after the timeout
+    if (requestedLOD <= _usedLOD || currentTime - _usedLODTime >= timeout)
+    {
+        if (requestedLOD != MAX_int32 || _usedLOD != MAX_int32)
+            _usedLODTime = currentTime;
+        _usedLOD = requestedLOD;
+    }
+    return _usedLOD;
+}
+
+bool ModelBase::WaitForLOD(int32 lodIndex, double timeoutMilliseconds)
+{
+    if (WaitForLoaded())
+        return true;
+    const int32 lodsCount = GetLODsCount();
+    lodIndex = Math::Clamp(lodIndex, 0, lodsCount - 1);
+    if (lodsCount - GetCurrentResidency() <= lodIndex)
+        return false; // Already resident
+    if (IsInMainThread())
+    {
+        LOG(Warning, "Cannot wait for the model LOD streaming on a main thread.");
+        return true;
+    }
+
+    // Keep requesting the LOD (requests are flushed on every streaming update) until it gets resident
+    const double startTime = Platform::GetTimeSeconds();
+    while (lodsCount - GetCurrentResidency() > lodIndex)
+    {
+        if ((Platform::GetTimeSeconds() - startTime) * 1000.0 > timeoutMilliseconds)
+        {
+            LOG(Warning, "Waiting for the model {0} LOD{1} streaming timed out.", ToString(), lodIndex);
+            return true;
+        }
+        RequestLOD(lodIndex);
+        RequestStreamingUpdate();
+        Platform::Sleep(1);
+    }
+    return false;
+}
+
 MaterialSlot* ModelBase::GetSlot(const StringView& name)
 {
     MaterialSlot* result = nullptr;
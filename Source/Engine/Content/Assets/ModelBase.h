@@ -80,6 +80,10 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API ModelBase : public BinaryAsset
     };
 
 protected:
+    mutable volatile int32 _requestedLOD = MAX_int32;
+    int32 _usedLOD = MAX_int32;
+    double _usedLODTime = 0.0;
+
     explicit ModelBase(const SpawnParams& params, const AssetInfo* info, StreamingGroup* group)
         : BinaryAsset(params, info)
         , StreamableResource(group)
@@ -122,6 +126,47 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API ModelBase : public BinaryAsset
     /// </summary>
     virtual int32 GetLODsCount() const = 0;
 
+    /// <summary>
+    /// Gets the highest quality LOD index used to draw this model recently (tracked by the streaming to unload the unused LODs). Returns -1 if model was not drawn.
+    /// </summary>
+    API_PROPERTY() int32 GetUsedLOD() const
+    {
+        return _usedLOD != MAX_int32 ? _usedLOD : -1;
+    }
+
+    /// <summary>
+    /// Requests the LOD to be resident for the rendering. The highest quality LOD requested since the last streaming update is used to stream in or out the model LODs. Thread-safe and lock-free.
+    /// </summary>
+    /// <param name="lodIndex">The LOD index selected for drawing (before clamping to the resident LODs).</param>
+    void RequestLOD(int32 lodIndex) const
+    {
+        // Atomic min (most of the requests don't change the value so skip the write then)
+        int32 current = Platform::AtomicRead(&_requestedLOD);
+        while (lodIndex < current)
+        {
+            const int32 prev = Platform::InterlockedCompareExchange(&_requestedLOD, lodIndex, current);
+            if (prev == current)
+                break;
+            current = prev;
+        }
+    }
+
+    /// <summary>
+    /// Flushes the requested LOD and updates the used LOD. Higher quality LOD is used at once, lower quality LOD replaces it only after the timeout. Called by the streaming.
+    /// </summary>
+    /// <param name="currentTime">The current time (in seconds).</param>
+    /// <param name="timeout">The time (in seconds) after which the lower quality LOD replaces the used one.</param>
+    /// <returns>The used LOD index (MAX_int32 if model was not drawn).</returns>
+    int32 UpdateUsedLOD(double currentTime, float timeout);
+
+    /// <summary>
+    /// Requests the LOD and waits for it to be streamed in. Used by the tools that access the model data outside the rendering (eg. lightmaps baking or collision cooking). Cannot be called from the main thread (model streaming is updated there).
+    /// </summary>
+    /// <param name="lodIndex">The LOD index.</param>
+    /// <param name="timeoutMilliseconds">The maximum time to wait (in milliseconds).</param>
+    /// <returns>True if failed (eg. model failed to load or timeout), otherwise false.</returns>
+    bool WaitForLOD(int32 lodIndex, double timeoutMilliseconds = 30000.0);
+
     /// <summary>
     /// Gets the meshes for a particular LOD index.
     /// </summary>
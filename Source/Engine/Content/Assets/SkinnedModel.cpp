@@ -220,6 +220,7 @@ void SkinnedModel::Draw(RenderContext& renderContext, const SkinnedMesh::DrawInf
         }
     }
     lodIndex += info.LODBias + renderContext.View.ModelLODBias;
+    RequestLOD(lodIndex);
     lodIndex = ClampLODIndex(lodIndex);
 
     if (renderContext.View.IsSingleFrame)
@@ -1507,6 +1507,9 @@ void VisualScript::unload(bool isReloading)
     _methods.Clear();
     _fields.Clear();
     Graph.Clear();
+#if COMPILE_WITH_PROFILER
+    ProfilerCPU::InvalidateNamesCache();
+#endif
 
     // Note: preserve the registered scripting type but invalidate the locally cached handle
     if (_scriptingTypeHandle)
@@ -1568,7 +1571,7 @@ void VisualScript::CacheScriptingType()
             const int32 typeIndex = binaryModule.Types.Count();
             binaryModule.Types.AddUninitialized();
             new(binaryModule.Types.Get() + binaryModule.Types.Count() - 1)ScriptingType(_typename, &binaryModule, baseType.GetType().Size, ScriptingType::DefaultInitRuntime, VisualScriptingBinaryModule::VisualScriptObjectSpawn, baseType);
-            binaryModule.TypeNameToTypeIndex[_typename] = typeIndex;
+            binaryModule.TypeNameToTypeIndex[Name(_typename)] = typeIndex;
             _scriptingTypeHandle = ScriptingTypeHandle(&binaryModule, typeIndex);
             binaryModule.Scripts.Add(this);
 
@@ -1798,12 +1801,12 @@ bool VisualScriptingBinaryModule::IsLoaded() const
     return true;
 }
 
-bool VisualScriptingBinaryModule::FindScriptingType(const StringAnsiView& typeName, int32& typeIndex)
+bool VisualScriptingBinaryModule::FindScriptingType(const StringAnsiView& typeName, const Name& name, int32& typeIndex)
 {
     // Type Name for Visual Scripts is 32 chars Guid representation of asset ID
     if (typeName.Length() == 32)
     {
-        if (TypeNameToTypeIndex.TryGet(typeName, typeIndex))
+        if (name.HasChars() && TypeNameToTypeIndex.TryGet(name, typeIndex))
             return true;
         Guid id;
         if (!Guid::Parse(typeName, id))
@@ -329,7 +329,8 @@ class FLAXENGINE_API VisualScriptingBinaryModule : public BinaryModule
     // [BinaryModule]
     const StringAnsi& GetName() const override;
     bool IsLoaded() const override;
-    bool FindScriptingType(const StringAnsiView& typeName, int32& typeIndex) override;
+    using BinaryModule::FindScriptingType;
+    bool FindScriptingType(const StringAnsiView& typeName, const Name& name, int32& typeIndex) override;
     void* FindMethod(const ScriptingTypeHandle& typeHandle, const StringAnsiView& name, int32 numParams = 0) override;
     bool InvokeMethod(void* method, const Variant& instance, Span<Variant> paramValues, Variant& result) override;
     void GetMethodSignature(void* method, ScriptingTypeMethodSignature& methodSignature) override;
@@ -267,6 +267,7 @@ bool BinaryAsset::LoadChunk(int32 chunkIndex)
     {
         if (Storage->LoadAssetChunk(chunk))
             return true;
+        Content::TraceLoad(GetID(), chunkIndex);
     }
 
     return false;
@@ -291,6 +292,7 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
         {
             if (Storage->LoadAssetChunk(chunk))
                 return true;
+            Content::TraceLoad(GetID(), i);
         }
     }
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Content.h"
+#include "ContentLoadTrace.h"
 #include "JsonAsset.h"
 #include "Cache/AssetsCache.h"
 #include "Storage/ContentStorageManager.h"
@@ -8,6 +9,7 @@
 #include "Factories/IAssetFactory.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Platform/FileSystem.h"
@@ -57,6 +59,13 @@ namespace
     DateTime LastWorkspaceDiscovery;
     CriticalSection WorkspaceDiscoveryLocker;
 #endif
+
+    // Assets load trace
+    int64 LoadTraceActive = 0;
+    CriticalSection LoadTraceLocker;
+    ContentLoadTrace LoadTrace;
+    HashSet<Pair<Guid, int32>> LoadTraceRecorded;
+    double LoadTraceStartTime;
 }
 
 #if ENABLE_ASSETS_DISCOVERY
@@ -162,6 +171,7 @@ void ContentService::LateUpdate()
 void ContentService::Dispose()
 {
     IsExiting = true;
+    Content::EndLoadTrace();
 
     // Save assets registry before engine closing
     Cache.Save();
@@ -975,6 +985,53 @@ Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type)
     return result;
 }
 
+void Content::BeginLoadTrace(const Guid& name)
+{
+    ScopeLock lock(LoadTraceLocker);
+    EndLoadTrace();
+    LoadTrace.Name = name;
+    LoadTraceStartTime = Platform::GetTimeSeconds();
+    Platform::AtomicStore(&LoadTraceActive, 1);
+}
+
+void Content::EndLoadTrace()
+{
+    ScopeLock lock(LoadTraceLocker);
+    if (Platform::AtomicRead(&LoadTraceActive) == 0)
+        return;
+    Platform::AtomicStore(&LoadTraceActive, 0);
+    const String folder = GetLoadTracesFolder();
+    if (!FileSystem::DirectoryExists(folder))
+        FileSystem::CreateDirectory(folder);
+    const String path = folder / LoadTrace.Name.ToString(Guid::FormatType::N) + TEXT(".trace");
+    LOG(Info, "Saving content load trace with {0} events to '{1}'", LoadTrace.Events.Count(), path);
+    LoadTrace.Save(path);
+    LoadTrace.Events.Clear();
+    LoadTraceRecorded.Clear();
+}
+
+String Content::GetLoadTracesFolder()
+{
+#if USE_EDITOR
+    return Globals::ProjectCacheFolder / TEXT("LoadTraces");
+#else
+    return Globals::ProductLocalFolder / TEXT("LoadTraces");
+#endif
+}
+
+void Content::TraceLoad(const Guid& id, int32 chunkIndex)
+{
+    if (Platform::AtomicRead(&LoadTraceActive) == 0)
+        return;
+    ScopeLock lock(LoadTraceLocker);
+    if (Platform::AtomicRead(&LoadTraceActive) == 0 || !LoadTraceRecorded.Add(ToPair(id, chunkIndex)))
+        return;
+    auto& e = LoadTrace.Events.AddOne();
+    e.AssetId = id;
+    e.ChunkIndex = chunkIndex;
+    e.Time = (float)(Platform::GetTimeSeconds() - LoadTraceStartTime);
+}
+
 Asset* Content::load(const Guid& id, const ScriptingTypeHandle& type, AssetInfo& assetInfo)
 {
     // Get cached asset info (from registry)
@@ -1040,6 +1097,7 @@ Asset* Content::load(const Guid& id, const ScriptingTypeHandle& type, AssetInfo&
     AssetsLocker.Unlock();
 
     // Start asset loading
+    TraceLoad(id, -1);
     result->startLoading();
 
     return result;
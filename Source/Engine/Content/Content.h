@@ -351,6 +351,31 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// <returns>Created asset or null if failed.</returns>
     static Asset* CreateVirtualAsset(const ScriptingTypeHandle& type);
 
+    /// <summary>
+    /// Begins recording the assets load trace (assets and their data chunks in the order of the first use). Ends the current trace if any. Traces are used by the game cooker to layout the content packages so the data used together is read sequentially.
+    /// </summary>
+    /// <remarks>Traces are recorded automatically for every loaded scene when running with -loadtrace command line switch.</remarks>
+    /// <param name="name">The trace identifier (eg. the id of the scene that is loaded).</param>
+    API_FUNCTION() static void BeginLoadTrace(const Guid& name);
+
+    /// <summary>
+    /// Ends recording the assets load trace and saves it to the file in the load traces folder.
+    /// </summary>
+    API_FUNCTION() static void EndLoadTrace();
+
+    /// <summary>
+    /// Gets the folder with the recorded assets load traces (project cache in Editor, local product data folder in game).
+    /// </summary>
+    /// <remarks>Game cooker uses only the traces from the Editor folder (Cache/LoadTraces in the project folder). To use the traces recorded by the cooked game copy the *.trace files from the game local data folder into the project one.</remarks>
+    API_PROPERTY() static String GetLoadTracesFolder();
+
+    /// <summary>
+    /// Records the asset data usage in the active load trace (if any).
+    /// </summary>
+    /// <param name="id">The asset id.</param>
+    /// <param name="chunkIndex">The loaded data chunk index or -1 for the asset load start.</param>
+    static void TraceLoad(const Guid& id, int32 chunkIndex);
+
     /// <summary>
     /// Occurs when asset is being disposed and will be unloaded (by force). All references to it should be released.
     /// </summary>
@@ -0,0 +1,59 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ContentLoadTrace.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/FileWriteStream.h"
+
+#define CONTENT_LOAD_TRACE_MAGIC_CODE 0x54444C43 // CLDT
+#define CONTENT_LOAD_TRACE_VERSION 1
+
+bool ContentLoadTrace::Save(const StringView& path) const
+{
+    auto stream = FileWriteStream::Open(path);
+    if (stream == nullptr)
+    {
+        LOG(Warning, "Failed to save content load trace to '{0}'", path);
+        return true;
+    }
+    stream->WriteInt32(CONTENT_LOAD_TRACE_MAGIC_CODE);
+    stream->WriteInt32(CONTENT_LOAD_TRACE_VERSION);
+    stream->Write(&Name);
+    stream->WriteInt32(Events.Count());
+    for (const ContentLoadTraceEvent& e : Events)
+    {
+        stream->Write(&e.AssetId);
+        stream->WriteInt32(e.ChunkIndex);
+        stream->WriteFloat(e.Time);
+    }
+    Delete(stream);
+    return false;
+}
+
+bool ContentLoadTrace::Load(const StringView& path)
+{
+    auto stream = FileReadStream::Open(path);
+    if (stream == nullptr)
+        return true;
+    int32 magicCode, version, count;
+    stream->ReadInt32(&magicCode);
+    stream->ReadInt32(&version);
+    if (magicCode != CONTENT_LOAD_TRACE_MAGIC_CODE || version != CONTENT_LOAD_TRACE_VERSION)
+    {
+        LOG(Warning, "Invalid content load trace file '{0}'", path);
+        Delete(stream);
+        return true;
+    }
+    stream->Read(&Name);
+    stream->ReadInt32(&count);
+    Events.Resize(Math::Max(count, 0));
+    for (ContentLoadTraceEvent& e : Events)
+    {
+        stream->Read(&e.AssetId);
+        stream->ReadInt32(&e.ChunkIndex);
+        stream->ReadFloat(&e.Time);
+    }
+    Delete(stream);
+    return false;
+}
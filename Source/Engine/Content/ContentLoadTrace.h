@@ -0,0 +1,60 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// The assets load trace event.
+/// </summary>
+struct ContentLoadTraceEvent
+{
+    /// <summary>
+    /// The asset identifier.
+    /// </summary>
+    Guid AssetId;
+
+    /// <summary>
+    /// The asset data chunk index. Value -1 is used for the asset load start (header).
+    /// </summary>
+    int32 ChunkIndex;
+
+    /// <summary>
+    /// The time (in seconds) since the trace start.
+    /// </summary>
+    float Time;
+};
+
+/// <summary>
+/// The recorded assets load trace (assets and their data chunks in the order of the first use), eg. for the scene. Used by the game cooker to layout the content packages so the data used together is read sequentially.
+/// </summary>
+class FLAXENGINE_API ContentLoadTrace
+{
+public:
+    /// <summary>
+    /// The trace identifier (eg. the scene id).
+    /// </summary>
+    Guid Name;
+
+    /// <summary>
+    /// The recorded events (each asset chunk is included only once).
+    /// </summary>
+    Array<ContentLoadTraceEvent> Events;
+
+public:
+    /// <summary>
+    /// Saves the trace to the file.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Save(const StringView& path) const;
+
+    /// <summary>
+    /// Loads the trace from the file.
+    /// </summary>
+    /// <param name="path">The input file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Load(const StringView& path);
+};
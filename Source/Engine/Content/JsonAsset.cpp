@@ -171,6 +171,7 @@ Asset::LoadResult JsonAssetBase::loadAsset()
         return LoadResult::CannotLoadData;
     auto& data = chunk->Data;
 #endif
+    Content::TraceLoad(GetID(), 0);
 
     // Parse json document
     {
@@ -4,6 +4,7 @@
 
 #include "../ContentLoadTask.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Content/Content.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/BinaryAsset.h"
 #include "Engine/Content/WeakAssetReference.h"
@@ -78,6 +79,7 @@ class LoadAssetDataTask : public ContentLoadTask
                         LOG(Warning, "Cannot load asset \'{0}\' chunk {1}.", ref->ToString(), i);
                         return Result::LoadDataError;
                     }
+                    Content::TraceLoad(ref->GetID(), i);
                 }
             }
         }
@@ -5,6 +5,7 @@
 #include "FlaxPackage.h"
 #include "ContentStorageManager.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -778,7 +779,7 @@ FlaxChunk* FlaxStorage::AllocateChunk()
 
 #if USE_EDITOR
 
-bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int32 dataCount, bool silentMode, const CustomData* customData)
+bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int32 dataCount, bool silentMode, const CustomData* customData, const Array<FlaxChunk*>* chunksOrder)
 {
     LOG(Info, "Creating package at \'{0}\'. Silent Mode: {1}", path, silentMode);
 
@@ -791,7 +792,7 @@ bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int3
         return true;
 
     // Create package
-    bool result = Create(stream, data, dataCount, customData);
+    bool result = Create(stream, data, dataCount, customData, chunksOrder);
 
     // Close file
     Delete(stream);
@@ -805,7 +806,7 @@ bool FlaxStorage::Create(const StringView& path, const AssetInitData* data, int3
     return result;
 }
 
-bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData)
+bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData, const Array<FlaxChunk*>* chunksOrder)
 {
     // Validate inputs
     if (data == nullptr || dataCount <= 0)
@@ -823,6 +824,26 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     for (int32 i = 0; i < dataCount; i++)
         data[i].Header.GetLoadedChunks(chunks);
     int32 chunksCount = chunks.Count();
+    if (chunksOrder && chunksOrder->HasItems())
+    {
+        // Place the chunks data in the requested order (chunks mapping in asset headers uses indices so data location is independent)
+        HashSet<FlaxChunk*> allChunks, addedChunks;
+        for (FlaxChunk* chunk : chunks)
+            allChunks.Add(chunk);
+        Array<FlaxChunk*> orderedChunks;
+        orderedChunks.EnsureCapacity(chunksCount);
+        for (FlaxChunk* chunk : *chunksOrder)
+        {
+            if (allChunks.Contains(chunk) && addedChunks.Add(chunk))
+                orderedChunks.Add(chunk);
+        }
+        for (FlaxChunk* chunk : chunks)
+        {
+            if (addedChunks.Add(chunk))
+                orderedChunks.Add(chunk);
+        }
+        chunks.Swap(orderedChunks);
+    }
 
     // TODO: sort chunks by size? smaller ones first?
     // Calculate start address of the first asset header location
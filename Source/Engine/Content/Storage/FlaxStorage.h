@@ -453,10 +453,11 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <param name="data">The data to write.</param>
     /// <param name="silentMode">In silent mode don't reload opened storage container that is using target file.</param>
     /// <param name="customData">Custom options.</param>
+    /// <param name="chunksOrder">The custom order of the chunks data in the file (eg. the first use order). Chunks not included in the list are placed after them in the default order.</param>
     /// <returns>True if cannot create package, otherwise false</returns>
-    FORCE_INLINE static bool Create(const StringView& path, const Array<AssetInitData>& data, bool silentMode = false, const CustomData* customData = nullptr)
+    FORCE_INLINE static bool Create(const StringView& path, const Array<AssetInitData>& data, bool silentMode = false, const CustomData* customData = nullptr, const Array<FlaxChunk*>* chunksOrder = nullptr)
     {
-        return Create(path, data.Get(), data.Count(), silentMode, customData);
+        return Create(path, data.Get(), data.Count(), silentMode, customData, chunksOrder);
     }
 
     /// <summary>
@@ -467,8 +468,9 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <param name="dataCount">The data size.</param>
     /// <param name="silentMode">In silent mode don't reload opened storage container that is using target file.</param>
     /// <param name="customData">Custom options.</param>
+    /// <param name="chunksOrder">The custom order of the chunks data in the file (eg. the first use order). Chunks not included in the list are placed after them in the default order.</param>
     /// <returns>True if cannot create package, otherwise false</returns>
-    static bool Create(const StringView& path, const AssetInitData* data, int32 dataCount, bool silentMode = false, const CustomData* customData = nullptr);
+    static bool Create(const StringView& path, const AssetInitData* data, int32 dataCount, bool silentMode = false, const CustomData* customData = nullptr, const Array<FlaxChunk*>* chunksOrder = nullptr);
 
     /// <summary>
     /// Creates new FlaxFile using specified assets data.
@@ -477,8 +479,9 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <param name="data">The data to write.</param>
     /// <param name="dataCount">The data size.</param>
     /// <param name="customData">Custom options.</param>
+    /// <param name="chunksOrder">The custom order of the chunks data in the file (eg. the first use order). Chunks not included in the list are placed after them in the default order.</param>
     /// <returns>True if cannot create package, otherwise false</returns>
-    static bool Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData = nullptr);
+    static bool Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData = nullptr, const Array<FlaxChunk*>* chunksOrder = nullptr);
 
 #endif
 
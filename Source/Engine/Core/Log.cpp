@@ -8,6 +8,8 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Threading/ThreadSpawner.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Debug/Exceptions/Exceptions.h"
@@ -18,6 +20,12 @@
 
 #define LOG_ENABLE_FILE (!PLATFORM_SWITCH)
 
+// Capacity of the log messages queue (power of two). Logging threads wait for the writer thread when it gets full.
+#define LOG_QUEUE_SIZE 4096
+
+// Maximum interval between the log file flushes (in milliseconds). Errors and explicit flushes are written immediately.
+#define LOG_FLUSH_INTERVAL 200
+
 namespace
 {
     bool LogAfterInit = false, IsDuringLog = false;
@@ -25,6 +33,206 @@ namespace
     FileWriteStream* LogFile = nullptr;
     CriticalSection LogLocker;
     DateTime LogStartTime;
+
+    // Preformatted message in the log queue
+    struct LogEntry
+    {
+        int64 Sequence;
+        Char* Text;
+        int32 Length;
+    };
+
+    // Bounded multi-producer single-consumer ring of log messages (the order of messages from all threads is preserved by the enqueue position)
+    LogEntry LogQueue[LOG_QUEUE_SIZE];
+    int64 LogEnqueuePos = 0;
+    int64 LogDequeuePos = 0;
+
+    // Background writer thread that writes the queued messages in batches
+    Thread* LogWriter = nullptr;
+    uint64 LogWriterId = 0;
+    int64 LogWriterExit = 0;
+    int64 LogWriterSleeping = 0;
+    int64 LogFlushRequest = 0;
+    int64 LogFlushedPos = 0;
+    CriticalSection LogWriterLocker;
+    ConditionVariable LogWriterSignal;
+    ConditionVariable LogFlushSignal;
+
+    void WriteToOutputs(const Char* ptr, int32 length)
+    {
+        // Send message to standard process output
+        if (CommandLine::Options.Std)
+        {
+#if PLATFORM_TEXT_IS_CHAR16
+            StringAnsi ansi(ptr, length);
+            ansi += PLATFORM_LINE_TERMINATOR;
+            printf("%s", ansi.Get());
+#else
+            std::wcout.write(ptr, length);
+            std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+#endif
+        }
+
+        // Send message to platform logging
+        Platform::Log(StringView(ptr, length));
+
+        // Write message to log file
+        if (LogAfterInit)
+        {
+            LogFile->Write(ptr, length);
+            LogFile->Write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+        }
+    }
+
+    void InitQueue()
+    {
+        for (int64 i = 0; i < LOG_QUEUE_SIZE; i++)
+            LogQueue[i].Sequence = i;
+        LogEnqueuePos = LogDequeuePos = 0;
+        LogFlushRequest = LogFlushedPos = 0;
+    }
+
+    void Enqueue(const Char* ptr, int32 length)
+    {
+        Char* text = (Char*)Allocator::Allocate(length * sizeof(Char));
+        Platform::MemoryCopy(text, ptr, length * sizeof(Char));
+
+        // Reserve the queue slot
+        LogEntry* entry;
+        int64 pos = Platform::AtomicRead(&LogEnqueuePos);
+        while (true)
+        {
+            entry = &LogQueue[pos & (LOG_QUEUE_SIZE - 1)];
+            const int64 diff = Platform::AtomicRead(&entry->Sequence) - pos;
+            if (diff == 0)
+            {
+                if (Platform::InterlockedCompareExchange(&LogEnqueuePos, pos + 1, pos) == pos)
+                    break;
+                pos = Platform::AtomicRead(&LogEnqueuePos);
+            }
+            else if (diff < 0)
+            {
+                // Queue is full so wait for the writer
+                LogWriterSignal.NotifyOne();
+                Platform::Sleep(0);
+                pos = Platform::AtomicRead(&LogEnqueuePos);
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&LogEnqueuePos);
+            }
+        }
+
+        // Publish the message
+        entry->Text = text;
+        entry->Length = length;
+        Platform::AtomicStore(&entry->Sequence, pos + 1);
+        if (Platform::AtomicRead(&LogWriterSleeping))
+            LogWriterSignal.NotifyOne();
+    }
+
+    int32 Dequeue()
+    {
+        // Write all the published messages (can be called only by a single thread at once)
+        int32 count = 0;
+        while (true)
+        {
+            LogEntry& entry = LogQueue[LogDequeuePos & (LOG_QUEUE_SIZE - 1)];
+            if (Platform::AtomicRead(&entry.Sequence) != LogDequeuePos + 1)
+                break;
+            WriteToOutputs(entry.Text, entry.Length);
+            Allocator::Free(entry.Text);
+            entry.Text = nullptr;
+            Platform::AtomicStore(&entry.Sequence, LogDequeuePos + LOG_QUEUE_SIZE);
+            Platform::AtomicStore(&LogDequeuePos, LogDequeuePos + 1);
+            count++;
+        }
+        return count;
+    }
+
+    void NotifyFlushed()
+    {
+        LogWriterLocker.Lock();
+        Platform::AtomicStore(&LogFlushedPos, LogDequeuePos);
+        LogFlushSignal.NotifyAll();
+        LogWriterLocker.Unlock();
+    }
+
+    int32 WriterThread()
+    {
+        LogWriterId = Platform::GetCurrentThreadID();
+        double lastFlushTime = Platform::GetTimeSeconds();
+        bool hasUnflushed = false;
+        while (true)
+        {
+            const bool exit = Platform::AtomicRead(&LogWriterExit) != 0;
+            const int64 flushRequest = Platform::AtomicRead(&LogFlushRequest);
+
+            // Write the queued messages and flush the file in batches (logging from the outputs is ignored as in the synchronous mode)
+            LogLocker.Lock();
+            IsDuringLog = true;
+            if (Dequeue() != 0)
+                hasUnflushed = true;
+            const double time = Platform::GetTimeSeconds();
+            bool flush = flushRequest > Platform::AtomicRead(&LogFlushedPos);
+            if (hasUnflushed && (flush || exit || (time - lastFlushTime) * 1000.0 >= LOG_FLUSH_INTERVAL))
+            {
+                if (LogAfterInit)
+                    LogFile->Flush();
+                lastFlushTime = time;
+                hasUnflushed = false;
+                flush = true;
+            }
+            IsDuringLog = false;
+            LogLocker.Unlock();
+            if (flush && !hasUnflushed)
+                NotifyFlushed();
+
+            if (exit && Platform::AtomicRead(&LogEnqueuePos) == LogDequeuePos)
+                break;
+            if (exit || flushRequest > LogDequeuePos)
+            {
+                // Message slot is reserved but not yet published
+                Platform::Sleep(0);
+                continue;
+            }
+
+            // Wait for more messages (or until the next flush)
+            LogWriterLocker.Lock();
+            Platform::AtomicStore(&LogWriterSleeping, 1);
+            if (Platform::AtomicRead(&LogEnqueuePos) == LogDequeuePos && !Platform::AtomicRead(&LogWriterExit) && Platform::AtomicRead(&LogFlushRequest) <= Platform::AtomicRead(&LogFlushedPos))
+                LogWriterSignal.Wait(LogWriterLocker, LOG_FLUSH_INTERVAL);
+            Platform::AtomicStore(&LogWriterSleeping, 0);
+            LogWriterLocker.Unlock();
+        }
+        return 0;
+    }
+
+    void StartWriter()
+    {
+        InitQueue();
+        Platform::AtomicStore(&LogWriterExit, 0);
+        LogWriter = ThreadSpawner::Start(WriterThread, TEXT("Log Writer"), ThreadPriority::BelowNormal);
+    }
+
+    void StopWriter()
+    {
+        if (!LogWriter)
+            return;
+        LogWriterLocker.Lock();
+        Platform::AtomicStore(&LogWriterExit, 1);
+        LogWriterSignal.NotifyOne();
+        LogWriterLocker.Unlock();
+        LogWriter->Join();
+        Delete(LogWriter);
+        LogWriter = nullptr;
+        LogWriterId = 0;
+
+        // Write any messages queued after the writer exit
+        LogLocker.Lock();
+        Dequeue();
+        LogLocker.Unlock();
+    }
 }
 
 String Log::Logger::LogFilePath;
@@ -91,6 +299,9 @@ bool Log::Logger::Init()
     byte bom[] = { 0xFF, 0xFE };
     LogFile->Write(bom, 2);
 
+    // Write messages on a background thread so logging threads don't wait for the file I/O
+    StartWriter();
+
     // Write startup info
     WriteFloor();
     Write(String::Format(TEXT("           Start of the log, {0}"), LogStartTime.ToString()));
@@ -110,6 +321,13 @@ void Log::Logger::Write(const StringView& msg)
     if (length <= 0)
         return;
 
+    // Pass message to the writer thread
+    if (LogWriter && Platform::GetCurrentThreadID() != LogWriterId)
+    {
+        Enqueue(ptr, length);
+        return;
+    }
+
     LogLocker.Lock();
     if (IsDuringLog)
     {
@@ -118,31 +336,11 @@ void Log::Logger::Write(const StringView& msg)
     }
     IsDuringLog = true;
 
-    // Send message to standard process output
-    if (CommandLine::Options.Std)
-    {
-#if PLATFORM_TEXT_IS_CHAR16
-        StringAnsi ansi(msg);
-        ansi += PLATFORM_LINE_TERMINATOR;
-        printf("%s", ansi.Get());
-#else
-        std::wcout.write(ptr, length);
-        std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
-#endif
-    }
-
-    // Send message to platform logging
-    Platform::Log(msg);
-
-    // Write message to log file
-    if (LogAfterInit)
-    {
-        LogFile->Write(ptr, length);
-        LogFile->Write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+    WriteToOutputs(ptr, length);
 #if LOG_ENABLE_AUTO_FLUSH
+    if (LogAfterInit)
         LogFile->Flush();
 #endif
-    }
 
     IsDuringLog = false;
     LogLocker.Unlock();
@@ -155,14 +353,16 @@ void Log::Logger::Write(const Exception& exception)
 
 void Log::Logger::Dispose()
 {
-    LogLocker.Lock();
-
     // Write ending info
     WriteFloor();
     Write(String::Format(TEXT(" Total errors: {0}\n Closing file"), LogTotalErrorsCnt, DateTime::Now().ToString()));
     WriteFloor();
 
+    // Write all the queued messages
+    StopWriter();
+
     // Close
+    LogLocker.Lock();
     if (LogAfterInit)
     {
         LogAfterInit = false;
@@ -185,6 +385,21 @@ bool Log::Logger::IsLogEnabled()
 
 void Log::Logger::Flush()
 {
+    if (LogWriter && Platform::GetCurrentThreadID() != LogWriterId)
+    {
+        // Request the writer to flush all the messages queued so far and wait for it
+        const int64 target = Platform::AtomicRead(&LogEnqueuePos);
+        int64 request = Platform::AtomicRead(&LogFlushRequest);
+        while (request < target && Platform::InterlockedCompareExchange(&LogFlushRequest, target, request) != request)
+            request = Platform::AtomicRead(&LogFlushRequest);
+        LogWriterLocker.Lock();
+        LogWriterSignal.NotifyOne();
+        for (int32 i = 0; i < 50 && Platform::AtomicRead(&LogFlushedPos) < target; i++)
+            LogFlushSignal.Wait(LogWriterLocker, 100);
+        LogWriterLocker.Unlock();
+        return;
+    }
+
     LogLocker.Lock();
     if (LogFile)
         LogFile->Flush();
@@ -249,6 +464,10 @@ void Log::Logger::Write(LogType type, const StringView& msg)
     {
         LogTotalErrorsCnt++;
         OnError(type, msg);
+
+        // Ensure errors are written to the file (eg. in case of crash)
+        if (type != LogType::Fatal)
+            Flush();
     }
 
     // Check if need to show message box with that log message
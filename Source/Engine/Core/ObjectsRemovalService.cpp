@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ObjectsRemovalService.h"
+#include "Collections/Array.h"
 #include "Collections/Dictionary.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
@@ -11,13 +12,266 @@
 
 namespace ObjectsRemovalServiceImpl
 {
+    // Objects removal requests are pushed by any thread to the lock-free inbox (intrusive list) and consumed by the thread that holds the PoolLocker
+    struct InboxItem
+    {
+        InboxItem* Next;
+        Object* Obj;
+        float TimeToLive;
+        bool UseGameTime;
+    };
+
+    struct WheelItem
+    {
+        Object* Obj;
+        uint32 Stamp;
+    };
+
+    // Hierarchical timing wheel of the objects deadlines (10ms ticks). Slots of the higher levels cover the whole range of the lower level and their objects are moved (cascaded) down when time reaches them so flush touches only the expired slots.
+    struct TimingWheel
+    {
+        static constexpr double TicksPerSecond = 100.0;
+        static constexpr int32 Level0Bits = 8;
+        static constexpr int32 LevelBits = 6;
+        static constexpr int32 Level1Shift = Level0Bits;
+        static constexpr int32 Level2Shift = Level0Bits + LevelBits;
+        static constexpr int32 OverflowShift = Level0Bits + LevelBits * 2;
+        static constexpr uint64 Level0Mask = (1 << Level0Bits) - 1;
+        static constexpr uint64 LevelMask = (1 << LevelBits) - 1;
+
+        double Time = 0.0;
+        uint64 CurrentTick = 0;
+        uint64 MaxDeadline = 0;
+        int32 Count = 0;
+        Array<WheelItem> Level0[1 << Level0Bits];
+        Array<WheelItem> Level1[1 << LevelBits];
+        Array<WheelItem> Level2[1 << LevelBits];
+        Array<WheelItem> Overflow;
+        Array<WheelItem> Cascaded;
+
+        uint64 GetDeadline(float timeToLive) const
+        {
+            return (uint64)ceil((Time + timeToLive) * TicksPerSecond);
+        }
+
+        // Returns false if object already timed out
+        bool Add(const WheelItem& item, uint64 deadline)
+        {
+            if (deadline <= CurrentTick)
+                return false;
+            Insert(item, deadline);
+            MaxDeadline = Math::Max(MaxDeadline, deadline);
+            Count++;
+            return true;
+        }
+
+        void Insert(const WheelItem& item, uint64 deadline)
+        {
+            if (deadline - CurrentTick <= Level0Mask)
+                Level0[deadline & Level0Mask].Add(item);
+            else if ((deadline >> Level1Shift) - (CurrentTick >> Level1Shift) <= LevelMask)
+                Level1[(deadline >> Level1Shift) & LevelMask].Add(item);
+            else if ((deadline >> Level2Shift) - (CurrentTick >> Level2Shift) <= LevelMask)
+                Level2[(deadline >> Level2Shift) & LevelMask].Add(item);
+            else
+                Overflow.Add(item);
+        }
+
+        void Cascade(Array<WheelItem>& slot)
+        {
+            if (slot.IsEmpty())
+                return;
+            Cascaded.Swap(slot);
+            for (const WheelItem& item : Cascaded)
+            {
+                const uint64 deadline = GetDeadline(item);
+                if (deadline <= CurrentTick)
+                    Level0[CurrentTick & Level0Mask].Add(item);
+                else
+                    Insert(item, deadline);
+            }
+            Cascaded.Clear();
+        }
+
+        void ExpireAll(Array<WheelItem>& expired)
+        {
+            for (auto& slot : Level0)
+                ExpireSlot(slot, expired);
+            for (auto& slot : Level1)
+                ExpireSlot(slot, expired);
+            for (auto& slot : Level2)
+                ExpireSlot(slot, expired);
+            ExpireSlot(Overflow, expired);
+            Count = 0;
+        }
+
+        static void ExpireSlot(Array<WheelItem>& slot, Array<WheelItem>& expired)
+        {
+            if (slot.HasItems())
+            {
+                expired.Add(slot);
+                slot.Clear();
+            }
+        }
+
+        void Advance(float dt, Array<WheelItem>& expired);
+        uint64 GetDeadline(const WheelItem& item) const;
+    };
+
+    struct PoolEntry
+    {
+        uint32 Stamp;
+        uint64 Deadline;
+    };
+
     bool IsReady = false;
     CriticalSection PoolLocker;
-    CriticalSection NewItemsLocker;
     DateTime LastUpdate;
     float LastUpdateGameTime;
-    Dictionary<Object*, float> Pool(8192);
-    Dictionary<Object*, float> NewItemsPool(2048);
+    uint32 StampCounter = 0;
+    InboxItem* volatile Inbox = nullptr;
+    InboxItem* volatile FreeItems = nullptr;
+    THREADLOCAL InboxItem* LocalFreeItems = nullptr;
+    Dictionary<Object*, PoolEntry> Pool(8192);
+    TimingWheel RealTimeWheel;
+    TimingWheel GameTimeWheel;
+    Array<WheelItem> Expired;
+    Array<WheelItem> Deleting;
+
+    uint64 TimingWheel::GetDeadline(const WheelItem& item) const
+    {
+        const PoolEntry* entry = Pool.TryGet(item.Obj);
+        return entry && entry->Stamp == item.Stamp ? entry->Deadline : 0;
+    }
+
+    void TimingWheel::Advance(float dt, Array<WheelItem>& expired)
+    {
+        Time += dt;
+        const uint64 targetTick = (uint64)(Time * TicksPerSecond);
+        if (Count != 0 && targetTick >= MaxDeadline)
+        {
+            // All objects timed out so skip the ticks and cascading (eg. on ForceFlush)
+            ExpireAll(expired);
+        }
+        while (CurrentTick < targetTick && Count != 0)
+        {
+            const uint64 tick = ++CurrentTick;
+            if ((tick & Level0Mask) == 0)
+            {
+                // Move objects from the higher levels slots that reached the time range of the lower levels
+                if ((tick & ((1ull << Level2Shift) - 1)) == 0)
+                {
+                    if ((tick & ((1ull << OverflowShift) - 1)) == 0)
+                        Cascade(Overflow);
+                    Cascade(Level2[(tick >> Level2Shift) & LevelMask]);
+                }
+                Cascade(Level1[(tick >> Level1Shift) & LevelMask]);
+            }
+            auto& slot = Level0[tick & Level0Mask];
+            if (slot.HasItems())
+            {
+                expired.Add(slot);
+                Count -= slot.Count();
+                slot.Clear();
+            }
+        }
+        if (Count == 0)
+        {
+            CurrentTick = Math::Max(CurrentTick, targetTick);
+            MaxDeadline = 0;
+        }
+    }
+
+    // Atomically takes the whole intrusive list (pointer-sized compare-exchange works on both 32-bit and 64-bit platforms)
+    FORCE_INLINE InboxItem* TakeList(InboxItem* volatile& list)
+    {
+        intptr head;
+        do
+        {
+            head = Platform::AtomicRead((intptr volatile*)&list);
+        } while (head != 0 && Platform::InterlockedCompareExchange((intptr volatile*)&list, 0, head) != head);
+        return (InboxItem*)head;
+    }
+
+    FORCE_INLINE bool HasInboxItems()
+    {
+        return Platform::AtomicRead((intptr volatile*)&Inbox) != 0;
+    }
+
+    // Gets the inbox item from the pool. Producer threads take the whole shared free list at once into their local cache so items popping is free from ABA problem.
+    InboxItem* AllocInboxItem()
+    {
+        InboxItem* item = LocalFreeItems;
+        if (!item)
+        {
+            item = TakeList(FreeItems);
+            if (!item)
+                return New<InboxItem>();
+        }
+        LocalFreeItems = item->Next;
+        return item;
+    }
+
+    // Returns the list of the processed inbox items to the pool
+    void FreeInboxItems(InboxItem* first, InboxItem* last)
+    {
+        intptr head;
+        do
+        {
+            head = Platform::AtomicRead((intptr volatile*)&FreeItems);
+            last->Next = (InboxItem*)head;
+        } while (Platform::InterlockedCompareExchange((intptr volatile*)&FreeItems, (intptr)first, head) != head);
+    }
+
+    // Moves the new removal requests into the pool (has to be called under PoolLocker)
+    void ProcessInbox()
+    {
+        // Take the whole list and restore the order of requests (the last request for the object wins)
+        InboxItem* item = TakeList(Inbox);
+        if (!item)
+            return;
+        InboxItem* reversed = nullptr;
+        while (item)
+        {
+            InboxItem* next = item->Next;
+            item->Next = reversed;
+            reversed = item;
+            item = next;
+        }
+        item = reversed;
+        InboxItem* last = reversed;
+        while (item)
+        {
+            WheelItem wheelItem;
+            wheelItem.Obj = item->Obj;
+            wheelItem.Stamp = ++StampCounter;
+            TimingWheel& wheel = item->UseGameTime ? GameTimeWheel : RealTimeWheel;
+            PoolEntry& entry = Pool[item->Obj];
+            entry.Stamp = wheelItem.Stamp;
+            entry.Deadline = wheel.GetDeadline(item->TimeToLive);
+            if (item->TimeToLive <= ZeroTolerance || !wheel.Add(wheelItem, entry.Deadline))
+                Expired.Add(wheelItem);
+            last = item;
+            item = item->Next;
+        }
+        FreeInboxItems(reversed, last);
+    }
+
+    // Deletes the expired objects (has to be called under PoolLocker)
+    void DeleteExpired()
+    {
+        Deleting.Swap(Expired);
+        for (const WheelItem& item : Deleting)
+        {
+            // Skip objects that were removed from the pool or added again later (outdated wheel items are left in the slots)
+            const PoolEntry* entry = Pool.TryGet(item.Obj);
+            if (entry == nullptr || entry->Stamp != item.Stamp)
+                continue;
+            Pool.Remove(item.Obj);
+            item.Obj->OnDeleteObject();
+        }
+        Deleting.Clear();
+    }
 }
 
 using namespace ObjectsRemovalServiceImpl;
@@ -42,27 +296,14 @@ bool ObjectsRemovalService::IsInPool(Object* obj)
     if (!IsReady)
         return false;
 
-    {
-        ScopeLock lock(NewItemsLocker);
-        if (NewItemsPool.ContainsKey(obj))
-            return true;
-    }
-
-    {
-        ScopeLock lock(PoolLocker);
-        if (Pool.ContainsKey(obj))
-            return true;
-    }
-
-    return false;
+    ScopeLock lock(PoolLocker);
+    ProcessInbox();
+    return Pool.ContainsKey(obj);
 }
 
 bool ObjectsRemovalService::HasNewItemsForFlush()
 {
-    NewItemsLocker.Lock();
-    const bool result = NewItemsPool.HasItems();
-    NewItemsLocker.Unlock();
-    return result;
+    return HasInboxItems();
 }
 
 void ObjectsRemovalService::Dereference(Object* obj)
@@ -70,106 +311,51 @@ void ObjectsRemovalService::Dereference(Object* obj)
     if (!IsReady)
         return;
 
-    NewItemsLocker.Lock();
-    NewItemsPool.Remove(obj);
-    NewItemsLocker.Unlock();
-
-    PoolLocker.Lock();
+    ScopeLock lock(PoolLocker);
+    ProcessInbox();
     Pool.Remove(obj);
-    PoolLocker.Unlock();
 }
 
 void ObjectsRemovalService::Add(Object* obj, float timeToLive, bool useGameTime)
 {
-    ScopeLock lock(NewItemsLocker);
-
     obj->Flags |= ObjectFlags::WasMarkedToDelete;
     if (useGameTime)
         obj->Flags |= ObjectFlags::UseGameTimeForDelete;
     else
         obj->Flags &= ~ObjectFlags::UseGameTimeForDelete;
-    NewItemsPool[obj] = timeToLive;
+
+    // Push to the inbox
+    auto item = AllocInboxItem();
+    item->Obj = obj;
+    item->TimeToLive = timeToLive;
+    item->UseGameTime = useGameTime;
+    intptr head;
+    do
+    {
+        head = Platform::AtomicRead((intptr volatile*)&Inbox);
+        item->Next = (InboxItem*)head;
+    } while (Platform::InterlockedCompareExchange((intptr volatile*)&Inbox, (intptr)item, head) != head);
 }
 
 void ObjectsRemovalService::Flush(float dt, float gameDelta)
 {
     PROFILE_CPU();
+    ScopeLock lock(PoolLocker);
 
     // Add new items
-    {
-        ScopeLock lock(NewItemsLocker);
-
-        for (auto i = NewItemsPool.Begin(); i.IsNotEnd(); ++i)
-        {
-            Pool[i->Key] = i->Value;
-        }
-        NewItemsPool.Clear();
-    }
+    ProcessInbox();
 
     // Update timeouts and delete objects that timed out
-    {
-        ScopeLock lock(PoolLocker);
-
-        for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
-        {
-            auto obj = i->Key;
-            const float ttl = i->Value - (obj->Flags & ObjectFlags::UseGameTimeForDelete ? gameDelta : dt);
-            if (ttl <= ZeroTolerance)
-            {
-                Pool.Remove(i);
-
-#if BUILD_DEBUG || BUILD_DEVELOPMENT
-                if (NewItemsPool.ContainsKey(obj))
-                {
-                    const auto asScriptingObj = dynamic_cast<ScriptingObject*>(obj);
-                    if (asScriptingObj)
-                    {
-                        LOG(Warning, "Object {0} was marked to delete after delete timeout", asScriptingObj->GetID());
-                    }
-                }
-#endif
-                NewItemsPool.Remove(obj);
-                //ASSERT(!NewItemsPool.ContainsKey(obj));
-
-                obj->OnDeleteObject();
-            }
-            else
-            {
-                i->Value = ttl;
-            }
-        }
-    }
+    RealTimeWheel.Advance(dt, Expired);
+    GameTimeWheel.Advance(gameDelta, Expired);
+    DeleteExpired();
 
     // Perform removing in loop
     // Note: objects during OnDeleteObject call can register new objects to remove with timeout=0, for example Actors do that to remove children and scripts
-    while (HasNewItemsForFlush())
+    while (HasInboxItems())
     {
-        // Add new items
-        {
-            ScopeLock lock(NewItemsLocker);
-
-            for (auto i = NewItemsPool.Begin(); i.IsNotEnd(); ++i)
-            {
-                Pool[i->Key] = i->Value;
-            }
-            NewItemsPool.Clear();
-        }
-
-        // Delete objects that timed out
-        {
-            ScopeLock lock(PoolLocker);
-
-            for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
-            {
-                if (i->Value <= ZeroTolerance)
-                {
-                    auto obj = i->Key;
-                    Pool.Remove(i);
-                    ASSERT(!NewItemsPool.ContainsKey(obj));
-                    obj->OnDeleteObject();
-                }
-            }
-        }
+        ProcessInbox();
+        DeleteExpired();
     }
 }
 
@@ -209,6 +395,17 @@ void ObjectsRemoval::Dispose()
             obj->OnDeleteObject();
         }
         Pool.Clear();
+        RealTimeWheel = TimingWheel();
+        GameTimeWheel = TimingWheel();
+
+        // Release the pooled inbox items (items cached by the other threads are left)
+        InboxItem* item = TakeList(FreeItems);
+        while (item)
+        {
+            InboxItem* next = item->Next;
+            Delete(item);
+            item = next;
+        }
     }
 
     IsReady = false;
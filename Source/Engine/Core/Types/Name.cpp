@@ -0,0 +1,281 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Name.h"
+#include "String.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/Threading.h"
+
+// Names are stored in the fixed-size chunks that never move so reading the name text doesn't need to lock the table
+// Lookups of the existing names don't lock the table too, only adding a new name does
+#define NAMES_CHUNK_SIZE 4096
+#define NAMES_MAX_CHUNKS 1024
+
+namespace
+{
+    struct NameEntry
+    {
+        const Char* Text;
+        int32 Length;
+        uint32 Hash;
+        uint32 HashIgnoreCase;
+        int32 IndexIgnoreCase;
+        int32 NextIgnoreCase;
+    };
+
+    // Case-sensitive lookup buckets read without locking. The new name is linked after setting its chain link so the readers always see the valid chains. Rehashing creates the new buckets (old ones are kept for the readers that still use them).
+    struct NameBuckets
+    {
+        int32 Size;
+        int32 volatile* Heads;
+        int32* Next;
+    };
+
+    struct NameTable
+    {
+        CriticalSection Locker;
+        NameEntry* Chunks[NAMES_MAX_CHUNKS] = {};
+        volatile int64 Count = 0;
+        NameBuckets* volatile Buckets = nullptr;
+        int32* BucketsIgnoreCase = nullptr;
+        int32 BucketsCount = 0;
+
+        NameTable()
+        {
+            // Index 0 is the empty name
+            NameEntry& entry = Add();
+            entry.Text = TEXT("");
+            entry.Length = 0;
+            entry.Hash = entry.HashIgnoreCase = 0;
+            entry.IndexIgnoreCase = 0;
+            Platform::AtomicStore(&Count, 1);
+        }
+
+        FORCE_INLINE NameEntry& Get(int32 index)
+        {
+            return Chunks[index / NAMES_CHUNK_SIZE][index % NAMES_CHUNK_SIZE];
+        }
+
+        FORCE_INLINE NameBuckets* GetBuckets()
+        {
+            return (NameBuckets*)Platform::AtomicRead((intptr volatile*)&Buckets);
+        }
+
+        NameEntry& Add()
+        {
+            const int32 index = (int32)Count;
+            const int32 chunkIndex = index / NAMES_CHUNK_SIZE;
+            if (Chunks[chunkIndex] == nullptr)
+                Chunks[chunkIndex] = (NameEntry*)Platform::Allocate(NAMES_CHUNK_SIZE * sizeof(NameEntry), 16);
+            NameEntry& entry = Chunks[chunkIndex][index % NAMES_CHUNK_SIZE];
+            entry.NextIgnoreCase = 0;
+            return entry;
+        }
+
+        void Rehash(int32 bucketsCount)
+        {
+            // Load factor is kept below 0.5 so the chain links are needed only for the first half of the names
+            auto buckets = (NameBuckets*)Platform::Allocate(sizeof(NameBuckets) + (bucketsCount + bucketsCount / 2) * sizeof(int32), 16);
+            buckets->Size = bucketsCount;
+            buckets->Heads = (int32*)(buckets + 1);
+            buckets->Next = (int32*)buckets->Heads + bucketsCount;
+            Platform::MemoryClear((void*)buckets->Heads, bucketsCount * sizeof(int32));
+            Platform::Free(BucketsIgnoreCase);
+            BucketsCount = bucketsCount;
+            BucketsIgnoreCase = (int32*)Platform::Allocate(bucketsCount * sizeof(int32), 16);
+            Platform::MemoryClear(BucketsIgnoreCase, bucketsCount * sizeof(int32));
+            const int32 count = (int32)Count;
+            for (int32 i = 1; i < count; i++)
+                Link(buckets, i);
+
+            // Publish the new buckets
+            Platform::AtomicStore((intptr volatile*)&Buckets, (intptr)buckets);
+        }
+
+        void Link(NameBuckets* buckets, int32 index)
+        {
+            NameEntry& entry = Get(index);
+            const int32 bucket = entry.Hash & (buckets->Size - 1);
+            buckets->Next[index] = buckets->Heads[bucket];
+            Platform::AtomicStore(&buckets->Heads[bucket], index);
+            const int32 bucketIgnoreCase = entry.HashIgnoreCase & (BucketsCount - 1);
+            entry.NextIgnoreCase = BucketsIgnoreCase[bucketIgnoreCase];
+            BucketsIgnoreCase[bucketIgnoreCase] = index;
+        }
+    };
+
+    NameTable& GetTable()
+    {
+        static NameTable table;
+        return table;
+    }
+
+    // Both ANSI and UTF-16 texts are hashed and compared by the same character codes so lookups don't need to convert the text
+    template<typename CharType>
+    FORCE_INLINE Char ToChar(CharType c)
+    {
+        return (Char)c;
+    }
+
+    template<>
+    FORCE_INLINE Char ToChar(char c)
+    {
+        return (Char)(byte)c;
+    }
+
+    template<typename CharType>
+    void GetHashes(const CharType* text, int32 length, uint32& hash, uint32& hashIgnoreCase)
+    {
+        hash = hashIgnoreCase = 5381;
+        for (int32 i = 0; i < length; i++)
+        {
+            const Char c = ToChar(text[i]);
+            hash = ((hash << 5) + hash) + (uint32)c;
+            hashIgnoreCase = ((hashIgnoreCase << 5) + hashIgnoreCase) + (uint32)StringUtils::ToLower(c);
+        }
+    }
+
+    template<typename CharType>
+    bool Equals(const NameEntry& entry, const CharType* text, int32 length, bool ignoreCase)
+    {
+        if (entry.Length != length)
+            return false;
+        for (int32 i = 0; i < length; i++)
+        {
+            const Char a = entry.Text[i];
+            const Char b = ToChar(text[i]);
+            if (a != b && (!ignoreCase || StringUtils::ToLower(a) != StringUtils::ToLower(b)))
+                return false;
+        }
+        return true;
+    }
+
+    template<typename CharType>
+    int32 FindName(NameTable& table, const CharType* text, int32 length, uint32 hash)
+    {
+        const NameBuckets* buckets = table.GetBuckets();
+        if (buckets == nullptr)
+            return 0;
+        for (int32 index = Platform::AtomicRead(&buckets->Heads[hash & (buckets->Size - 1)]); index != 0;)
+        {
+            const NameEntry& entry = table.Get(index);
+            if (entry.Hash == hash && Equals(entry, text, length, false))
+                return index;
+            index = buckets->Next[index];
+        }
+        return 0;
+    }
+
+    template<typename CharType>
+    int32 FindOrAddName(const CharType* text, int32 length)
+    {
+        if (length <= 0)
+            return 0;
+        uint32 hash, hashIgnoreCase;
+        GetHashes(text, length, hash, hashIgnoreCase);
+        NameTable& table = GetTable();
+        int32 index = FindName(table, text, length, hash);
+        if (index != 0)
+            return index;
+        ScopeLock lock(table.Locker);
+
+        // Check again in case other thread added the name
+        index = FindName(table, text, length, hash);
+        if (index != 0)
+            return index;
+
+        // Find the first name that differs only by the characters case
+        int32 indexIgnoreCase = (int32)table.Count;
+        if (table.BucketsCount != 0)
+        {
+            for (int32 i = table.BucketsIgnoreCase[hashIgnoreCase & (table.BucketsCount - 1)]; i != 0;)
+            {
+                const NameEntry& e = table.Get(i);
+                if (e.HashIgnoreCase == hashIgnoreCase && Equals(e, text, length, true))
+                {
+                    indexIgnoreCase = e.IndexIgnoreCase;
+                    break;
+                }
+                i = e.NextIgnoreCase;
+            }
+        }
+
+        // Add a new name
+        index = (int32)table.Count;
+        if (index == NAMES_CHUNK_SIZE * NAMES_MAX_CHUNKS)
+        {
+            LOG(Fatal, "Names table is full.");
+            return 0;
+        }
+        NameEntry& entry = table.Add();
+        Char* entryText = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+        for (int32 i = 0; i < length; i++)
+            entryText[i] = ToChar(text[i]);
+        entryText[length] = 0;
+        entry.Text = entryText;
+        entry.Length = length;
+        entry.Hash = hash;
+        entry.HashIgnoreCase = hashIgnoreCase;
+        entry.IndexIgnoreCase = indexIgnoreCase;
+        Platform::AtomicStore(&table.Count, index + 1);
+
+        // Keep the load factor below 0.5
+        if (index * 2 >= table.BucketsCount)
+            table.Rehash(Math::Max(table.BucketsCount * 2, 1024));
+        else
+            table.Link(table.Buckets, index);
+        return index;
+    }
+
+    template<typename CharType>
+    int32 FindExistingName(const CharType* text, int32 length)
+    {
+        uint32 hash, hashIgnoreCase;
+        GetHashes(text, length, hash, hashIgnoreCase);
+        return FindName(GetTable(), text, length, hash);
+    }
+}
+
+Name::Name(const StringView& text)
+    : _index(FindOrAddName(text.Get(), text.Length()))
+{
+}
+
+Name::Name(const StringAnsiView& text)
+    : _index(FindOrAddName(text.Get(), text.Length()))
+{
+}
+
+bool Name::Find(const StringView& text, Name& result)
+{
+    result._index = text.Length() > 0 ? FindExistingName(text.Get(), text.Length()) : 0;
+    return result._index != 0 || text.Length() <= 0;
+}
+
+bool Name::Find(const StringAnsiView& text, Name& result)
+{
+    result._index = text.Length() > 0 ? FindExistingName(text.Get(), text.Length()) : 0;
+    return result._index != 0 || text.Length() <= 0;
+}
+
+int32 Name::GetCount()
+{
+    return (int32)Platform::AtomicRead(&GetTable().Count);
+}
+
+int32 Name::GetIndexIgnoreCase() const
+{
+    return GetTable().Get(_index).IndexIgnoreCase;
+}
+
+StringView Name::ToStringView() const
+{
+    const NameEntry& entry = GetTable().Get(_index);
+    return StringView(entry.Text, entry.Length);
+}
+
+String Name::ToString() const
+{
+    return String(ToStringView());
+}
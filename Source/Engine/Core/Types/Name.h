@@ -0,0 +1,183 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "StringView.h"
+#include "Engine/Core/Templates.h"
+
+/// <summary>
+/// Represents the interned text identifier (eg. node, parameter or type name). The text is stored once in the global names table and the name is only an index into it, so comparing, hashing and copying names doesn't touch the characters nor allocate memory. Names are case-sensitive (see EqualsIgnoreCase and NameIgnoreCase).
+/// </summary>
+class FLAXENGINE_API Name
+{
+private:
+    int32 _index = 0;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="Name"/> class (empty name).
+    /// </summary>
+    Name() = default;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="Name"/> class. Adds the text to the names table if it's missing.
+    /// </summary>
+    /// <param name="text">The name text.</param>
+    explicit Name(const StringView& text);
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="Name"/> class. Adds the text to the names table if it's missing.
+    /// </summary>
+    /// <param name="text">The name text.</param>
+    explicit Name(const StringAnsiView& text);
+
+public:
+    /// <summary>
+    /// Finds the name in the names table without adding it (eg. for lookups with the user-provided text).
+    /// </summary>
+    /// <param name="text">The name text.</param>
+    /// <param name="result">The result name.</param>
+    /// <returns>True if name has been found, otherwise false.</returns>
+    static bool Find(const StringView& text, Name& result);
+
+    /// <summary>
+    /// Finds the name in the names table without adding it (eg. for lookups with the user-provided text).
+    /// </summary>
+    /// <param name="text">The name text.</param>
+    /// <param name="result">The result name.</param>
+    /// <returns>True if name has been found, otherwise false.</returns>
+    static bool Find(const StringAnsiView& text, Name& result);
+
+    /// <summary>
+    /// Gets the amount of the names in the names table.
+    /// </summary>
+    static int32 GetCount();
+
+public:
+    /// <summary>
+    /// Returns true if name is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _index == 0;
+    }
+
+    /// <summary>
+    /// Returns true if name isn't empty.
+    /// </summary>
+    FORCE_INLINE bool HasChars() const
+    {
+        return _index != 0;
+    }
+
+    /// <summary>
+    /// Gets the index of the name in the names table.
+    /// </summary>
+    FORCE_INLINE int32 GetIndex() const
+    {
+        return _index;
+    }
+
+    /// <summary>
+    /// Gets the index of the first name in the names table that matches this name when ignoring the characters case. The same for all names that differ only by the case.
+    /// </summary>
+    int32 GetIndexIgnoreCase() const;
+
+    /// <summary>
+    /// Checks if both names are equal when ignoring the characters case.
+    /// </summary>
+    /// <param name="other">The other name.</param>
+    /// <returns>True if names are equal, otherwise false.</returns>
+    FORCE_INLINE bool EqualsIgnoreCase(const Name& other) const
+    {
+        return _index == other._index || GetIndexIgnoreCase() == other.GetIndexIgnoreCase();
+    }
+
+    /// <summary>
+    /// Gets the name text. Returned view is valid for the whole engine lifetime and it's null-terminated.
+    /// </summary>
+    StringView ToStringView() const;
+
+    /// <summary>
+    /// Gets the name text.
+    /// </summary>
+    String ToString() const;
+
+public:
+    FORCE_INLINE bool operator==(const Name& other) const
+    {
+        return _index == other._index;
+    }
+
+    FORCE_INLINE bool operator!=(const Name& other) const
+    {
+        return _index != other._index;
+    }
+};
+
+/// <summary>
+/// The case-insensitive name wrapper for the hash-based collections (eg. Dictionary key).
+/// </summary>
+struct FLAXENGINE_API NameIgnoreCase
+{
+    Name Value;
+
+    NameIgnoreCase() = default;
+
+    NameIgnoreCase(const Name& value)
+        : Value(value)
+    {
+    }
+
+    FORCE_INLINE bool operator==(const NameIgnoreCase& other) const
+    {
+        return Value.EqualsIgnoreCase(other.Value);
+    }
+
+    FORCE_INLINE bool operator!=(const NameIgnoreCase& other) const
+    {
+        return !Value.EqualsIgnoreCase(other.Value);
+    }
+};
+
+inline uint32 GetHash(const Name& key)
+{
+    return (uint32)key.GetIndex();
+}
+
+inline uint32 GetHash(const NameIgnoreCase& key)
+{
+    return (uint32)key.Value.GetIndexIgnoreCase();
+}
+
+template<>
+struct TIsPODType<Name>
+{
+    enum { Value = true };
+};
+
+template<>
+struct TIsPODType<NameIgnoreCase>
+{
+    enum { Value = true };
+};
+
+namespace fmt
+{
+    template<>
+    struct formatter<Name, Char>
+    {
+        template<typename ParseContext>
+        auto parse(ParseContext& ctx)
+        {
+            return ctx.begin();
+        }
+
+        template<typename FormatContext>
+        auto format(const Name& v, FormatContext& ctx) -> decltype(ctx.out())
+        {
+            const StringView text = v.ToStringView();
+            return fmt::internal::copy(text.Get(), text.Get() + text.Length(), ctx.out());
+        }
+    };
+}
@@ -25,12 +25,15 @@
 #include "Engine/Debug/DebugLog.h"
 #include "Engine/Render2D/Render2D.h"
 #include "Engine/Render2D/FontAsset.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 
 // Debug draw service configuration
 #define DEBUG_DRAW_INITIAL_VB_CAPACITY (4 * 1024)
+#define DEBUG_DRAW_PACKED_VERTEX_PRECISION 0.1f // The maximum quantization step (in world units) for the packed vertices (larger draw lists use full precision vertices)
 //
 #define DEBUG_DRAW_SPHERE_LOD0_RESOLUTION 64
 #define DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE 0.2f
@@ -125,9 +128,17 @@ PACK_STRUCT(struct Vertex {
     Color32 Color;
     });
 
+// Vertex with position quantized to 16-bit within the draw call bounds (see DEBUG_DRAW_PACKED_VERTEX_PRECISION)
+PACK_STRUCT(struct PackedVertex {
+    uint16 Position[4];
+    Color32 Color;
+    });
+
 PACK_STRUCT(struct Data {
     Matrix ViewProjection;
-    Float3 Padding;
+    Float3 PositionOffset;
+    float Padding;
+    Float3 PositionScale;
     bool EnableDepthTest;
     });
 
@@ -177,6 +188,66 @@ struct PsData
     }
 };
 
+struct PsSet
+{
+    PsData LinesDefault;
+    PsData LinesDepthTest;
+    PsData WireTrianglesDefault;
+    PsData WireTrianglesDepthTest;
+    PsData TrianglesDefault;
+    PsData TrianglesDepthTest;
+
+    bool Create(GPUShader* shader, const StringAnsiView& vs)
+    {
+        bool failed = false;
+        GPUPipelineState::Description desc = GPUPipelineState::Description::Default;
+        desc.BlendMode = BlendingMode::AlphaBlend;
+        desc.CullMode = CullMode::TwoSided;
+        desc.VS = shader->GetVS(vs);
+
+        // Default
+        desc.PS = shader->GetPS("PS");
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
+        failed |= LinesDefault.Create(desc);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
+        failed |= TrianglesDefault.Create(desc);
+        desc.Wireframe = true;
+        failed |= WireTrianglesDefault.Create(desc);
+
+        // Depth Test
+        desc.Wireframe = false;
+        desc.PS = shader->GetPS("PS_DepthTest");
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
+        failed |= LinesDepthTest.Create(desc);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
+        failed |= TrianglesDepthTest.Create(desc);
+        desc.Wireframe = true;
+        failed |= WireTrianglesDepthTest.Create(desc);
+
+        return failed;
+    }
+
+    void Release()
+    {
+        LinesDefault.Release();
+        LinesDepthTest.Release();
+        WireTrianglesDefault.Release();
+        WireTrianglesDepthTest.Release();
+        TrianglesDefault.Release();
+        TrianglesDepthTest.Release();
+    }
+};
+
+template<typename T>
+void MergeList(Array<T>& dst, Array<T>& src)
+{
+    if (src.HasItems())
+    {
+        dst.Add(src);
+        src.Clear();
+    }
+}
+
 template<typename T>
 void UpdateList(float dt, Array<T>& list)
 {
@@ -290,6 +361,20 @@ struct DebugDrawData
         OneFrameText3D.Clear();
     }
 
+    void Merge(DebugDrawData& other)
+    {
+        MergeList(DefaultLines, other.DefaultLines);
+        MergeList(OneFrameLines, other.OneFrameLines);
+        MergeList(DefaultTriangles, other.DefaultTriangles);
+        MergeList(OneFrameTriangles, other.OneFrameTriangles);
+        MergeList(DefaultWireTriangles, other.DefaultWireTriangles);
+        MergeList(OneFrameWireTriangles, other.OneFrameWireTriangles);
+        MergeList(DefaultText2D, other.DefaultText2D);
+        MergeList(OneFrameText2D, other.OneFrameText2D);
+        MergeList(DefaultText3D, other.DefaultText3D);
+        MergeList(OneFrameText3D, other.OneFrameText3D);
+    }
+
     void Teleport(const Float3& delta)
     {
         TeleportList(delta, DefaultLines);
@@ -340,19 +425,25 @@ struct DebugDrawContext
     Matrix LastViewProj = Matrix::Identity;
 };
 
+// Debug drawing context of the non-main thread (eg. job). Double-buffered to let the owning thread draw without locking while the other buffer is merged into the global context before rendering.
+struct DebugDrawThreadContext
+{
+    DebugDrawContext Contexts[2];
+    int64 WriteIndex = 0;
+    int64 WritersCount[2] = {};
+};
+
 namespace
 {
     DebugDrawContext GlobalContext;
     DebugDrawContext* Context;
+    ThreadLocalObject<DebugDrawThreadContext> ThreadContexts;
     AssetReference<Shader> DebugDrawShader;
     AssetReference<FontAsset> DebugDrawFont;
-    PsData DebugDrawPsLinesDefault;
-    PsData DebugDrawPsLinesDepthTest;
-    PsData DebugDrawPsWireTrianglesDefault;
-    PsData DebugDrawPsWireTrianglesDepthTest;
-    PsData DebugDrawPsTrianglesDefault;
-    PsData DebugDrawPsTrianglesDepthTest;
+    PsSet DebugDrawPs;
+    PsSet DebugDrawPsPacked;
     DynamicVertexBuffer* DebugDrawVB = nullptr;
+    DynamicVertexBuffer* DebugDrawPackedVB = nullptr;
     Float3 CircleCache[DEBUG_DRAW_CIRCLE_VERTICES];
     Array<Float3> SphereTriangleCache;
     DebugSphereCache SphereCache[3];
@@ -378,73 +469,203 @@ int32 BoxLineIndicesCache[] =
     // @formatter:on
 };
 
+// Gets the debug drawing context for the current thread. Main thread draws directly into the current context, other threads draw into their own contexts.
+struct DebugDrawScope
+{
+    DebugDrawContext* Context;
+    DebugDrawThreadContext* ThreadContext = nullptr;
+    int64 Index = 0;
+
+    DebugDrawScope()
+    {
+        if (IsInMainThread())
+        {
+            Context = ::Context;
+            return;
+        }
+        DebugDrawThreadContext*& threadContext = ThreadContexts.Get();
+        if (!threadContext)
+            threadContext = New<DebugDrawThreadContext>();
+        ThreadContext = threadContext;
+
+        // Register as a writer of the current buffer (recheck after the registration in case the buffers were swapped meanwhile)
+        while (true)
+        {
+            Index = Platform::AtomicRead(&threadContext->WriteIndex);
+            Platform::InterlockedIncrement(&threadContext->WritersCount[Index]);
+            if (Platform::AtomicRead(&threadContext->WriteIndex) == Index)
+                break;
+            Platform::InterlockedDecrement(&threadContext->WritersCount[Index]);
+        }
+        Context = &threadContext->Contexts[Index];
+        if (Context->Origin != GlobalContext.Origin)
+        {
+            const Float3 delta = Context->Origin - GlobalContext.Origin;
+            Context->DebugDrawDefault.Teleport(delta);
+            Context->DebugDrawDepthTest.Teleport(delta);
+            Context->Origin = GlobalContext.Origin;
+        }
+        Context->LastViewPos = GlobalContext.LastViewPos;
+        Context->LastViewProj = GlobalContext.LastViewProj;
+    }
+
+    ~DebugDrawScope()
+    {
+        if (ThreadContext)
+            Platform::InterlockedDecrement(&ThreadContext->WritersCount[Index]);
+    }
+
+    FORCE_INLINE DebugDrawContext* operator->() const
+    {
+        return Context;
+    }
+};
+
+void MergeThreadContexts()
+{
+    Array<DebugDrawThreadContext*, InlinedAllocation<64>> threadContexts;
+    ThreadContexts.GetNotNullValues(threadContexts);
+    for (DebugDrawThreadContext* threadContext : threadContexts)
+    {
+        // Swap the buffers and wait for the pending draws into the previous one to end
+        const int64 index = Platform::AtomicRead(&threadContext->WriteIndex);
+        Platform::AtomicStore(&threadContext->WriteIndex, 1 - index);
+        while (Platform::AtomicRead(&threadContext->WritersCount[index]) != 0)
+            Platform::Yield();
+
+        // Merge into the global context
+        DebugDrawContext& context = threadContext->Contexts[index];
+        if (context.DebugDrawDefault.Count() + context.DebugDrawDepthTest.Count() == 0)
+            continue;
+        if (context.Origin != GlobalContext.Origin)
+        {
+            const Float3 delta = context.Origin - GlobalContext.Origin;
+            context.DebugDrawDefault.Teleport(delta);
+            context.DebugDrawDepthTest.Teleport(delta);
+        }
+        GlobalContext.DebugDrawDefault.Merge(context.DebugDrawDefault);
+        GlobalContext.DebugDrawDepthTest.Merge(context.DebugDrawDepthTest);
+    }
+}
+
 struct DebugDrawCall
 {
     int32 StartVertex;
     int32 VertexCount;
+    bool Packed;
+    Float3 PositionOffset;
+    Float3 PositionScale;
 };
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
+template<typename Visitor>
+FORCE_INLINE void VisitVertices(const Array<Vertex>& list, Visitor& visitor)
 {
-    DebugDrawCall drawCall;
-    drawCall.StartVertex = vertexCounter;
-    drawCall.VertexCount = list.Count();
-    DebugDrawVB->Write(list.Get(), sizeof(Vertex) * drawCall.VertexCount);
-    vertexCounter += drawCall.VertexCount;
-    return drawCall;
+    for (const Vertex& v : list)
+        visitor(v.Position, v.Color);
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
+template<typename Visitor>
+FORCE_INLINE void VisitVertices(const Array<DebugLine>& list, Visitor& visitor)
 {
-    DebugDrawCall drawCall;
-    drawCall.StartVertex = vertexCounter;
-    drawCall.VertexCount = list.Count() * 2;
-    vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount);
-    for (int32 i = 0, j = 0; i < list.Count(); i++)
+    for (const DebugLine& l : list)
     {
-        const DebugLine& l = list[i];
-        dst[j++] = { l.Start, l.Color };
-        dst[j++] = { l.End, l.Color };
+        visitor(l.Start, l.Color);
+        visitor(l.End, l.Color);
     }
-    return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
+template<typename Visitor>
+FORCE_INLINE void VisitVertices(const Array<DebugTriangle>& list, Visitor& visitor)
 {
-    DebugDrawCall drawCall;
-    drawCall.StartVertex = vertexCounter;
-    drawCall.VertexCount = list.Count() * 3;
-    vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount);
-    for (int32 i = 0, j = 0; i < list.Count(); i++)
+    for (const DebugTriangle& t : list)
     {
-        const DebugTriangle& l = list[i];
-        dst[j++] = { l.V0, l.Color };
-        dst[j++] = { l.V1, l.Color };
-        dst[j++] = { l.V2, l.Color };
+        visitor(t.V0, t.Color);
+        visitor(t.V1, t.Color);
+        visitor(t.V2, t.Color);
     }
-    return drawCall;
+}
+
+FORCE_INLINE int32 GetVerticesCount(const Array<Vertex>& list)
+{
+    return list.Count();
+}
+
+FORCE_INLINE int32 GetVerticesCount(const Array<DebugLine>& list)
+{
+    return list.Count() * 2;
+}
+
+FORCE_INLINE int32 GetVerticesCount(const Array<DebugTriangle>& list)
+{
+    return list.Count() * 3;
 }
 
 template<typename T, typename U>
-DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
+DebugDrawCall WriteLists(int32& vertexCounter, int32& packedVertexCounter, const Array<T>& listA, const Array<U>& listB)
 {
-    const DebugDrawCall drawCallA = WriteList(vertexCounter, listA);
-    const DebugDrawCall drawCallB = WriteList(vertexCounter, listB);
     DebugDrawCall drawCall;
-    drawCall.StartVertex = drawCallA.StartVertex;
-    drawCall.VertexCount = drawCallA.VertexCount + drawCallB.VertexCount;
+    drawCall.VertexCount = GetVerticesCount(listA) + GetVerticesCount(listB);
+    drawCall.Packed = false;
+    if (drawCall.VertexCount == 0)
+    {
+        drawCall.StartVertex = 0;
+        return drawCall;
+    }
+
+    // Use the 16-bit quantized positions if the draw call bounds are small enough to keep the precision
+    Float3 min = Float3::Maximum, max = Float3::Minimum;
+    auto bounds = [&min, &max](const Float3& position, const Color32& color)
+    {
+        min = Float3::Min(min, position);
+        max = Float3::Max(max, position);
+    };
+    VisitVertices(listA, bounds);
+    VisitVertices(listB, bounds);
+    const Float3 size = max - min;
+    if (size.MaxValue() <= DEBUG_DRAW_PACKED_VERTEX_PRECISION * MAX_uint16)
+    {
+        drawCall.Packed = true;
+        drawCall.StartVertex = packedVertexCounter;
+        drawCall.PositionOffset = min;
+        drawCall.PositionScale = Float3::Max(size, Float3(ZeroTolerance));
+        packedVertexCounter += drawCall.VertexCount;
+        PackedVertex* dst = DebugDrawPackedVB->WriteReserve<PackedVertex>(drawCall.VertexCount);
+        const Float3 quantizeScale = (float)MAX_uint16 / drawCall.PositionScale;
+        auto write = [&dst, &min, &quantizeScale](const Float3& position, const Color32& color)
+        {
+            const Float3 p = (position - min) * quantizeScale + 0.5f;
+            dst->Position[0] = (uint16)p.X;
+            dst->Position[1] = (uint16)p.Y;
+            dst->Position[2] = (uint16)p.Z;
+            dst->Position[3] = 0;
+            dst->Color = color;
+            dst++;
+        };
+        VisitVertices(listA, write);
+        VisitVertices(listB, write);
+    }
+    else
+    {
+        drawCall.StartVertex = vertexCounter;
+        vertexCounter += drawCall.VertexCount;
+        Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount);
+        auto write = [&dst](const Float3& position, const Color32& color)
+        {
+            *dst++ = { position, color };
+        };
+        VisitVertices(listA, write);
+        VisitVertices(listB, write);
+    }
     return drawCall;
 }
 
-FORCE_INLINE DebugTriangle* AppendTriangles(int32 count, float duration, bool depthTest)
+FORCE_INLINE DebugTriangle* AppendTriangles(DebugDrawContext* context, int32 count, float duration, bool depthTest)
 {
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     const int32 startIndex = list->Count();
     list->AddUninitialized(count);
     return list->Get() + startIndex;
@@ -594,6 +815,7 @@ void DebugDrawService::Update()
     // Special case for Null renderer
     if (GPUDevice::Instance->GetRendererType() == RendererType::Null)
     {
+        MergeThreadContexts();
         GlobalContext.DebugDrawDefault.Clear();
         GlobalContext.DebugDrawDepthTest.Clear();
         return;
@@ -626,29 +848,8 @@ void DebugDrawService::Update()
         const auto shader = DebugDrawShader->GetShader();
 
         // Create pipeline states
-        GPUPipelineState::Description desc = GPUPipelineState::Description::Default;
-        desc.BlendMode = BlendingMode::AlphaBlend;
-        desc.CullMode = CullMode::TwoSided;
-        desc.VS = shader->GetVS("VS");
-
-        // Default
-        desc.PS = shader->GetPS("PS");
-        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
-        failed |= DebugDrawPsLinesDefault.Create(desc);
-        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
-        failed |= DebugDrawPsTrianglesDefault.Create(desc);
-        desc.Wireframe = true;
-        failed |= DebugDrawPsWireTrianglesDefault.Create(desc);
-
-        // Depth Test
-        desc.Wireframe = false;
-        desc.PS = shader->GetPS("PS_DepthTest");
-        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
-        failed |= DebugDrawPsLinesDepthTest.Create(desc);
-        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
-        failed |= DebugDrawPsTrianglesDepthTest.Create(desc);
-        desc.Wireframe = true;
-        failed |= DebugDrawPsWireTrianglesDepthTest.Create(desc);
+        failed |= DebugDrawPs.Create(shader, "VS");
+        failed |= DebugDrawPsPacked.Create(shader, "VS_Packed");
 
         if (failed)
         {
@@ -657,6 +858,7 @@ void DebugDrawService::Update()
 
         // Vertex buffer
         DebugDrawVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.VB"));
+        DebugDrawPackedVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(PackedVertex)), (uint32)sizeof(PackedVertex), TEXT("DebugDraw.PackedVB"));
     }
 }
 
@@ -665,16 +867,14 @@ void DebugDrawService::Dispose()
     // Clear lists
     GlobalContext.DebugDrawDefault.Release();
     GlobalContext.DebugDrawDepthTest.Release();
+    ThreadContexts.DeleteAll();
 
     // Release resources
     SphereTriangleCache.Resize(0);
-    DebugDrawPsLinesDefault.Release();
-    DebugDrawPsLinesDepthTest.Release();
-    DebugDrawPsWireTrianglesDefault.Release();
-    DebugDrawPsWireTrianglesDepthTest.Release();
-    DebugDrawPsTrianglesDefault.Release();
-    DebugDrawPsTrianglesDepthTest.Release();
+    DebugDrawPs.Release();
+    DebugDrawPsPacked.Release();
     SAFE_DELETE(DebugDrawVB);
+    SAFE_DELETE(DebugDrawPackedVB);
     DebugDrawShader = nullptr;
 }
 
@@ -710,6 +910,9 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
 {
     PROFILE_GPU_CPU("Debug Draw");
 
+    // Collect the debug shapes drawn from the other threads
+    MergeThreadContexts();
+
     // Ensure to have shader loaded and any lines to render
     const int32 debugDrawDepthTestCount = Context->DebugDrawDepthTest.Count();
     const int32 debugDrawDefaultCount = Context->DebugDrawDefault.Count();
@@ -738,16 +941,20 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     {
         PROFILE_CPU_NAMED("Update Buffer");
         DebugDrawVB->Clear();
-        int32 vertexCounter = 0;
-        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
-        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
-        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
-        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
-        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
-        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        DebugDrawPackedVB->Clear();
+        int32 vertexCounter = 0, packedVertexCounter = 0;
+        depthTestLines = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
+        defaultLines = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
+        depthTestTriangles = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
+        defaultTriangles = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
+        depthTestWireTriangles = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
+        defaultWireTriangles = WriteLists(vertexCounter, packedVertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
         {
             PROFILE_CPU_NAMED("Flush");
-            DebugDrawVB->Flush(context);
+            if (vertexCounter)
+                DebugDrawVB->Flush(context);
+            if (packedVertexCounter)
+                DebugDrawPackedVB->Flush(context);
         }
     }
 
@@ -757,10 +964,28 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     Matrix vp;
     Matrix::Multiply(renderContext.View.View, renderContext.View.NonJitteredProjection, vp);
     Matrix::Transpose(vp, data.ViewProjection);
+    data.PositionOffset = Float3::Zero;
+    data.Padding = 0.0f;
+    data.PositionScale = Float3::One;
     data.EnableDepthTest = enableDepthTest;
     context->UpdateCB(cb, &data);
     context->BindCB(0, cb);
-    auto vb = DebugDrawVB->GetBuffer();
+    GPUBuffer* vb = DebugDrawVB->GetBuffer();
+    GPUBuffer* packedVB = DebugDrawPackedVB->GetBuffer();
+    auto drawList = [&](const DebugDrawCall& drawCall, PsData PsSet::*ps, bool depthWrite, bool depthTest)
+    {
+        if (drawCall.Packed)
+        {
+            // Dequantize positions within the draw call bounds
+            data.PositionOffset = drawCall.PositionOffset;
+            data.PositionScale = drawCall.PositionScale;
+            context->UpdateCB(cb, &data);
+        }
+        PsSet& psSet = drawCall.Packed ? DebugDrawPsPacked : DebugDrawPs;
+        context->SetState((psSet.*ps).Get(depthWrite, depthTest));
+        context->BindVB(ToSpan(drawCall.Packed ? &packedVB : &vb, 1));
+        context->Draw(drawCall.StartVertex, drawCall.VertexCount);
+    };
 
     // Draw with depth test
     if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount > 0)
@@ -773,30 +998,15 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
 
         // Lines
         if (depthTestLines.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestLines.StartVertex, depthTestLines.VertexCount);
-        }
+            drawList(depthTestLines, data.EnableDepthTest ? &PsSet::LinesDepthTest : &PsSet::LinesDefault, enableDepthWrite, true);
 
         // Wire Triangles
         if (depthTestWireTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestWireTriangles.StartVertex, depthTestWireTriangles.VertexCount);
-        }
+            drawList(depthTestWireTriangles, data.EnableDepthTest ? &PsSet::WireTrianglesDepthTest : &PsSet::WireTrianglesDefault, enableDepthWrite, true);
 
         // Triangles
         if (depthTestTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestTriangles.StartVertex, depthTestTriangles.VertexCount);
-        }
+            drawList(depthTestTriangles, data.EnableDepthTest ? &PsSet::TrianglesDepthTest : &PsSet::TrianglesDefault, enableDepthWrite, true);
 
         if (data.EnableDepthTest)
             context->UnBindSR(0);
@@ -809,27 +1019,15 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
 
         // Lines
         if (defaultLines.VertexCount)
-        {
-            context->SetState(DebugDrawPsLinesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultLines.StartVertex, defaultLines.VertexCount);
-        }
+            drawList(defaultLines, &PsSet::LinesDefault, false, false);
 
         // Wire Triangles
         if (defaultWireTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsWireTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultWireTriangles.StartVertex, defaultWireTriangles.VertexCount);
-        }
+            drawList(defaultWireTriangles, &PsSet::WireTrianglesDefault, false, false);
 
         // Triangles
         if (defaultTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultTriangles.StartVertex, defaultTriangles.VertexCount);
-        }
+            drawList(defaultTriangles, &PsSet::TrianglesDefault, false, false);
     }
 
     // Text
@@ -914,8 +1112,9 @@ void DebugDraw::DrawActors(Actor** selectedActors, int32 selectedActorsCount, bo
 
 void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color& color, float duration, bool depthTest)
 {
-    const Float3 startF = start - Context->Origin, endF = end - Context->Origin;
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    const DebugDrawScope context;
+    const Float3 startF = start - context->Origin, endF = end - context->Origin;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { startF, endF, Color32(color), duration };
@@ -932,6 +1131,7 @@ void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color&
 
 void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     if (lines.Length() == 0)
         return;
     if (lines.Length() % 2 != 0)
@@ -942,8 +1142,8 @@ void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, co
 
     // Draw lines
     const Float3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -976,6 +1176,7 @@ void DebugDraw::DrawLines(const Array<Float3>& lines, const Matrix& transform, c
 
 void DebugDraw::DrawLines(const Span<Double3>& lines, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     if (lines.Length() == 0)
         return;
     if (lines.Length() % 2 != 0)
@@ -986,8 +1187,8 @@ void DebugDraw::DrawLines(const Span<Double3>& lines, const Matrix& transform, c
 
     // Draw lines
     const Double3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1020,7 +1221,8 @@ void DebugDraw::DrawLines(const Array<Double3, HeapAllocation>& lines, const Mat
 
 void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3& p3, const Vector3& p4, const Color& color, float duration, bool depthTest)
 {
-    const Float3 p1F = p1 - Context->Origin, p2F = p2 - Context->Origin, p3F = p3 - Context->Origin, p4F = p4 - Context->Origin;
+    const DebugDrawScope context;
+    const Float3 p1F = p1 - context->Origin, p2F = p2 - context->Origin, p3F = p3 - context->Origin, p4F = p4 - context->Origin;
 
     // Find amount of segments to use
     const Float3 d1 = p2F - p1F;
@@ -1031,7 +1233,7 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
     const float segmentCountInv = 1.0f / (float)segmentCount;
 
     // Draw segmented curve from lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { p1F, Float3::Zero, Color32(color), duration };
@@ -1064,14 +1266,15 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
 
 void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1098,14 +1301,15 @@ void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float du
 
 void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Get corners
     Vector3 corners[8];
     frustum.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1132,14 +1336,15 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
 
 void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1166,11 +1371,12 @@ void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color,
 
 void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Select LOD
     int32 index;
-    const Float3 centerF = sphere.Center - Context->Origin;
+    const Float3 centerF = sphere.Center - context->Origin;
     const float radiusF = (float)sphere.Radius;
-    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(centerF, radiusF, Context->LastViewPos, Context->LastViewProj);
+    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(centerF, radiusF, context->LastViewPos, context->LastViewProj);
     if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * 0.25f)
         index = 0;
     else if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * 0.25f)
@@ -1180,7 +1386,7 @@ void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color,
     auto& cache = SphereCache[index];
 
     // Draw lines of the unit sphere after linear transform
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1206,18 +1412,19 @@ void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color,
 
 void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
 
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + SphereTriangleCache.Count());
 
-    const Float3 centerF = sphere.Center - Context->Origin;
+    const Float3 centerF = sphere.Center - context->Origin;
     const float radiusF = (float)sphere.Radius;
     for (int32 i = 0; i < SphereTriangleCache.Count();)
     {
@@ -1230,6 +1437,7 @@ void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, flo
 
 void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float radius, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Create matrix transform for unit circle points
     Matrix world, scale, matrix;
     Float3 right, up;
@@ -1241,13 +1449,13 @@ void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float
         Float3::Cross(normal, Float3::Up, right);
     Float3::Cross(right, normal, up);
     Matrix::Scaling(radius, scale);
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     Matrix::CreateWorld(positionF, normal, up, world);
     Matrix::Multiply(scale, world, matrix);
 
     // Draw lines of the unit circle after linear transform
     Float3 prev = Float3::Transform(CircleCache[0], matrix);
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     for (int32 i = 1; i < DEBUG_DRAW_CIRCLE_VERTICES;)
     {
         Float3 cur = Float3::Transform(CircleCache[i++], matrix);
@@ -1276,26 +1484,28 @@ void DebugDraw::DrawWireTriangle(const Vector3& v0, const Vector3& v1, const Vec
 
 void DebugDraw::DrawTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    t.V0 = v0 - Context->Origin;
-    t.V1 = v1 - Context->Origin;
-    t.V2 = v2 - Context->Origin;
+    t.V0 = v0 - context->Origin;
+    t.V1 = v1 - context->Origin;
+    t.V2 = v2 - context->Origin;
     if (depthTest)
-        Context->DebugDrawDepthTest.Add(t);
+        context->DebugDrawDepthTest.Add(t);
     else
-        Context->DebugDrawDefault.Add(t);
+        context->DebugDrawDefault.Add(t);
 }
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1307,12 +1517,13 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color,
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
         Float3::Transform(vertices.Get()[i++], transformF, t.V0);
@@ -1334,12 +1545,13 @@ void DebugDraw::DrawTriangles(const Array<Float3>& vertices, const Matrix& trans
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1351,12 +1563,13 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& i
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
         Float3::Transform(vertices[indices.Get()[i++]], transformF, t.V0);
@@ -1378,12 +1591,13 @@ void DebugDraw::DrawTriangles(const Array<Float3>& vertices, const Array<int32,
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1395,12 +1609,13 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Color& color,
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
         Float3::Transform(vertices.Get()[i++], transformF, t.V0);
@@ -1422,12 +1637,13 @@ void DebugDraw::DrawTriangles(const Array<Double3>& vertices, const Matrix& tran
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1439,12 +1655,13 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>&
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
         Float3::Transform(vertices[indices.Get()[i++]], transformF, t.V0);
@@ -1466,12 +1683,13 @@ void DebugDraw::DrawTriangles(const Array<Double3>& vertices, const Array<int32,
 
 void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1488,12 +1706,13 @@ void DebugDraw::DrawWireTriangles(const Array<Float3>& vertices, const Color& co
 
 void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1510,12 +1729,13 @@ void DebugDraw::DrawWireTriangles(const Array<Float3>& vertices, const Array<int
 
 void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, vertices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1532,12 +1752,13 @@ void DebugDraw::DrawWireTriangles(const Array<Double3>& vertices, const Color& c
 
 void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context.Context, indices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1573,6 +1794,7 @@ void DebugDraw::DrawTube(const Vector3& position, const Quaternion& orientation,
 
 void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientation, float radius, float length, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Check if has no length (just sphere)
     if (length < ZeroTolerance)
     {
@@ -1588,12 +1810,12 @@ void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientat
         const float halfLength = length / 2.0f;
         Matrix rotation, translation, world;
         Matrix::RotationQuaternion(orientation, rotation);
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         Matrix::Translation(positionF, translation);
         Matrix::Multiply(rotation, translation, world);
 
         // Write vertices
-        auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+        auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
         Color32 color32(color);
         if (duration > 0)
         {
@@ -1684,7 +1906,7 @@ void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientat
 
 namespace
 {
-    void DrawCylinder(Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration)
+    void DrawCylinder(const DebugDrawContext* context, Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration)
     {
         // Setup cache
         Float3 CylinderCache[DEBUG_DRAW_CYLINDER_VERTICES];
@@ -1713,7 +1935,7 @@ namespace
         DebugTriangle t;
         t.Color = Color32(color);
         t.TimeLeft = duration;
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
 
         // Write triangles
@@ -1756,7 +1978,7 @@ namespace
         }
     }
 
-    void DrawCone(Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration)
+    void DrawCone(const DebugDrawContext* context, Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration)
     {
         const float tolerance = 0.001f;
         const float angle1 = Math::Clamp(angleXY, tolerance, PI - tolerance);
@@ -1770,7 +1992,7 @@ namespace
         DebugTriangle t;
         t.Color = Color32(color);
         t.TimeLeft = duration;
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
         t.V0 = world.GetTranslation();
 
@@ -1805,58 +2027,63 @@ namespace
 
 void DebugDraw::DrawCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    ::DrawCylinder(list, position, orientation, radius, height, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
+    ::DrawCylinder(context.Context, list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawWireCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultWireTriangles : &context->DebugDrawDepthTest.OneFrameWireTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
-    ::DrawCylinder(list, position, orientation, radius, height, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultWireTriangles : &context->DebugDrawDefault.OneFrameWireTriangles;
+    ::DrawCylinder(context.Context, list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
+    ::DrawCone(context.Context, list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
 void DebugDraw::DrawWireCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultWireTriangles : &context->DebugDrawDepthTest.OneFrameWireTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
-    ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultWireTriangles : &context->DebugDrawDefault.OneFrameWireTriangles;
+    ::DrawCone(context.Context, list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
 void DebugDraw::DrawArc(const Vector3& position, const Quaternion& orientation, float radius, float angle, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     if (angle <= 0)
         return;
     if (angle > TWO_PI)
         angle = TWO_PI;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     const int32 resolution = Math::CeilToInt((float)DEBUG_DRAW_CONE_RESOLUTION / TWO_PI * angle);
     const float angleStep = angle / (float)resolution;
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
     float currentAngle = 0.0f;
     DebugTriangle t;
@@ -1877,13 +2104,14 @@ void DebugDraw::DrawArc(const Vector3& position, const Quaternion& orientation,
 
 void DebugDraw::DrawWireArc(const Vector3& position, const Quaternion& orientation, float radius, float angle, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     if (angle <= 0)
         return;
     if (angle > TWO_PI)
         angle = TWO_PI;
     const int32 resolution = Math::CeilToInt((float)DEBUG_DRAW_CONE_RESOLUTION / TWO_PI * angle);
     const float angleStep = angle / (float)resolution;
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
     float currentAngle = 0.0f;
     Float3 prevPos(world.GetTranslation());
@@ -1923,11 +2151,12 @@ void DebugDraw::DrawWireArrow(const Vector3& position, const Quaternion& orienta
 
 void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw triangles
     DebugTriangle t;
@@ -1935,9 +2164,9 @@ void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float durati
     t.TimeLeft = duration;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + 36);
     for (int i0 = 0; i0 < 36;)
     {
@@ -1951,11 +2180,12 @@ void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float durati
 
 void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    const DebugDrawScope context;
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw triangles
     DebugTriangle t;
@@ -1963,9 +2193,9 @@ void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, floa
     t.TimeLeft = duration;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + 36);
     for (int i0 = 0; i0 < 36;)
     {
@@ -1979,9 +2209,10 @@ void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, floa
 
 void DebugDraw::DrawText(const StringView& text, const Float2& position, const Color& color, int32 size, float duration)
 {
+    const DebugDrawScope context;
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText2D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText2D : &Context->DebugDrawDefault.OneFrameText2D;
+    Array<DebugText2D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText2D : &context->DebugDrawDefault.OneFrameText2D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
@@ -1994,14 +2225,15 @@ void DebugDraw::DrawText(const StringView& text, const Float2& position, const C
 
 void DebugDraw::DrawText(const StringView& text, const Vector3& position, const Color& color, int32 size, float duration)
 {
+    const DebugDrawScope context;
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    Array<DebugText3D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText3D : &context->DebugDrawDefault.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
     t.Text[text.Length()] = 0;
-    t.Transform = position - Context->Origin;
+    t.Transform = position - context->Origin;
     t.FaceCamera = true;
     t.Size = size;
     t.Color = color;
@@ -2010,15 +2242,16 @@ void DebugDraw::DrawText(const StringView& text, const Vector3& position, const
 
 void DebugDraw::DrawText(const StringView& text, const Transform& transform, const Color& color, int32 size, float duration)
 {
+    const DebugDrawScope context;
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    Array<DebugText3D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText3D : &context->DebugDrawDefault.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
     t.Text[text.Length()] = 0;
     t.Transform = transform;
-    t.Transform.Translation -= Context->Origin;
+    t.Transform.Translation -= context->Origin;
     t.FaceCamera = false;
     t.Size = size;
     t.Color = color;
@@ -17,7 +17,7 @@ class Actor;
 struct Transform;
 
 /// <summary>
-/// The debug shapes rendering service. Not available in final game. For use only in the editor.
+/// The debug shapes rendering service. Not available in final game. For use only in the editor. Shapes can be drawn from any thread (eg. from jobs), the ones drawn outside the main thread are collected before rendering the frame.
 /// </summary>
 API_CLASS(Static) class FLAXENGINE_API DebugDraw
 {
@@ -141,9 +141,17 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-nvidia ", NVIDIA);
     PARSE_BOOL_SWITCH("-amd ", AMD);
     PARSE_BOOL_SWITCH("-intel ", Intel);
+    PARSE_BOOL_SWITCH("-asyncpipelines ", AsyncPipelines);
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
+    PARSE_BOOL_SWITCH("-softwareaudio ", SoftwareAudio);
+    PARSE_ARG_SWITCH("-audiocapture ", AudioCapture);
+    PARSE_BOOL_SWITCH("-loadtrace ", LoadTrace);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+#if COMPILE_WITH_PROFILER
+    PARSE_ARG_SWITCH("-trace ", Trace);
+    PARSE_BOOL_SWITCH("-profilememory ", ProfileMemory);
+#endif
 
 #if USE_EDITOR
 
@@ -112,6 +112,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Intel;
 
+        /// <summary>
+        /// -asyncpipelines (compiles the missing graphics pipelines in the background and skips the draws that use them until they are ready, Vulkan only)
+        /// </summary>
+        Nullable<bool> AsyncPipelines;
+
         /// <summary>
         /// -monolog (enables advanced debugging for Mono runtime)
         /// </summary>
@@ -122,11 +127,36 @@ class CommandLine
         /// </summary>
         Nullable<bool> Mute;
 
+        /// <summary>
+        /// -softwareaudio (uses Software Audio Backend that mixes audio on CPU without the output device)
+        /// </summary>
+        Nullable<bool> SoftwareAudio;
+
+        /// <summary>
+        /// -audiocapture !path! (captures the mixed audio into the WAV file, uses Software Audio Backend if available)
+        /// </summary>
+        Nullable<String> AudioCapture;
+
+        /// <summary>
+        /// -loadtrace (records the assets load trace for every loaded scene, used by the game cooker to optimize the content packages layout)
+        /// </summary>
+        Nullable<bool> LoadTrace;
+
         /// <summary>
         /// -lowdpi (disables High DPI awareness support)
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -trace !path! (captures the CPU profiler events into the trace file, can be used with headless builds)
+        /// </summary>
+        Nullable<String> Trace;
+
+        /// <summary>
+        /// -profilememory (enables the native memory allocations tracking per engine subsystem, see ProfilerMemory)
+        /// </summary>
+        Nullable<bool> ProfileMemory;
+
 #if USE_EDITOR
 
         /// <summary>
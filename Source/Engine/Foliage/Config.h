@@ -24,3 +24,9 @@ struct FoliageInstance;
 
 // Size of the cluster container for instances
 #define FOLIAGE_CLUSTER_CAPACITY (64)
+
+// Depth of the foliage type clusters quad-tree at which drawing is split into jobs executed in parallel (up to 4^depth jobs per foliage type)
+#define FOLIAGE_DRAW_JOBS_CLUSTER_DEPTH (2)
+
+// Minimum amount of foliage instances to cull and draw them using JobSystem (smaller foliage is drawn on the calling thread)
+#define FOLIAGE_DRAW_JOBS_MIN_INSTANCES (4096)
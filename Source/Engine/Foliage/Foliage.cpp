@@ -11,6 +11,9 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Platform/CriticalSection.h"
 #endif
 #include "Engine/Level/SceneQuery.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -23,6 +26,16 @@ Foliage::Foliage(const SpawnParams& params)
     : Actor(params)
 {
     _disableFoliageTypeEvents = false;
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    _drawData = New<DrawData>();
+#endif
+}
+
+Foliage::~Foliage()
+{
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    Delete(_drawData);
+#endif
 }
 
 void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_SIZE>& clusters, FoliageCluster* cluster, FoliageInstance& instance)
@@ -83,12 +96,99 @@ void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_S
 
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
 
-void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instance, FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
+struct Foliage::DrawJob
 {
+    struct Batch
+    {
+        DrawKey Key;
+        Array<InstanceData> Instances;
+    };
+
+    RenderContext* Context;
+    FoliageType* Type;
+    FoliageCluster* Cluster;
+    DrawCallsList* DrawCallsLists;
+    Array<Batch> Batches;
+    int32 BatchesCount;
+    int32 LastBatch;
+
+    InstanceData& AddInstance(const DrawKey& key)
+    {
+        // Linear search (there are only a few meshes, LODs and lightmaps per foliage type)
+        if (LastBatch < BatchesCount && Batches[LastBatch].Key == key)
+            return Batches[LastBatch].Instances.AddOne();
+        for (int32 i = 0; i < BatchesCount; i++)
+        {
+            if (Batches[i].Key == key)
+            {
+                LastBatch = i;
+                return Batches[i].Instances.AddOne();
+            }
+        }
+
+        // Reuse batches from the previous draws (keeps the allocated instances memory)
+        if (BatchesCount == Batches.Count())
+            Batches.AddOne();
+        LastBatch = BatchesCount++;
+        auto& batch = Batches[LastBatch];
+        batch.Key = key;
+        batch.Instances.Clear();
+        return batch.Instances.AddOne();
+    }
+};
+
+// Draw calls and jobs data reused between the foliage actor draws
+struct Foliage::DrawData
+{
+    CriticalSection Locker;
+    Array<DrawCallsList> TypesDrawCallsLists;
+    Array<DrawJob> Jobs;
+};
+
+namespace
+{
+    // Tests the total bounds of the 4 cluster children against the frustum at once. Returns the bit mask of the visible children.
+    int32 CullClusterChildren(const BoundingFrustum& frustum, const FoliageCluster* cluster, const Vector3& viewOrigin)
+    {
+        float bounds[6][4];
+        for (int32 i = 0; i < 4; i++)
+        {
+            const BoundingBox& box = cluster->Children[i]->TotalBounds;
+            bounds[0][i] = (float)(box.Minimum.X - viewOrigin.X);
+            bounds[1][i] = (float)(box.Minimum.Y - viewOrigin.Y);
+            bounds[2][i] = (float)(box.Minimum.Z - viewOrigin.Z);
+            bounds[3][i] = (float)(box.Maximum.X - viewOrigin.X);
+            bounds[4][i] = (float)(box.Maximum.Y - viewOrigin.Y);
+            bounds[5][i] = (float)(box.Maximum.Z - viewOrigin.Z);
+        }
+        SimdVector4 minMax[6];
+        for (int32 i = 0; i < 6; i++)
+            minMax[i] = SIMD::Load(bounds[i][0], bounds[i][1], bounds[i][2], bounds[i][3]);
+        int32 outside = 0;
+        for (int32 i = 0; i < 6; i++)
+        {
+            // Box is outside if the corner the furthest along the plane normal is behind the plane
+            const Plane plane = frustum.GetPlane(i);
+            const SimdVector4 x = plane.Normal.X >= 0 ? minMax[3] : minMax[0];
+            const SimdVector4 y = plane.Normal.Y >= 0 ? minMax[4] : minMax[1];
+            const SimdVector4 z = plane.Normal.Z >= 0 ? minMax[5] : minMax[2];
+            SimdVector4 distance = SIMD::Add(SIMD::Mul(x, SIMD::Splat((float)plane.Normal.X)), SIMD::Mul(y, SIMD::Splat((float)plane.Normal.Y)));
+            distance = SIMD::Add(distance, SIMD::Add(SIMD::Mul(z, SIMD::Splat((float)plane.Normal.Z)), SIMD::Splat((float)plane.D)));
+            outside |= SIMD::MoveMask(distance);
+        }
+        return ~outside & 0xf;
+    }
+}
+
+void Foliage::DrawInstance(DrawJob& job, FoliageInstance& instance, Model* model, int32 lod, float lodDitherFactor) const
+{
+    Matrix world;
+    const Transform transform = _transform.LocalToWorld(instance.Transform);
+    job.Context->View.GetWorldMatrix(transform, world);
     const auto& meshes = model->LODs[lod].Meshes;
     for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
     {
-        auto& drawCall = drawCallsLists[lod][meshIndex];
+        auto& drawCall = job.DrawCallsLists[lod][meshIndex];
         if (!drawCall.DrawCall.Material)
             continue;
 
@@ -96,19 +196,9 @@ void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instan
         key.Mat = drawCall.DrawCall.Material;
         key.Geo = &meshes[meshIndex];
         key.Lightmap = instance.Lightmap.TextureIndex;
-        auto* e = result.TryGet(key);
-        if (!e)
-        {
-            e = &result[key];
-            e->DrawCall.Material = key.Mat;
-            e->DrawCall.Surface.Lightmap = _staticFlags & StaticFlags::Lightmap ? _scene->LightmapsData.GetReadyLightmap(key.Lightmap) : nullptr;
-        }
 
         // Add instance to the draw batch
-        auto& instanceData = e->Instances.AddOne();
-        Matrix world;
-        const Transform transform = _transform.LocalToWorld(instance.Transform);
-        renderContext.View.GetWorldMatrix(transform, world);
+        auto& instanceData = job.AddInstance(key);
         instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
         instanceData.PerInstanceRandom = instance.Random;
         instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
@@ -119,8 +209,40 @@ void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instan
     }
 }
 
-void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
+void Foliage::GatherDrawJobs(RenderContext& renderContext, FoliageCluster* cluster, FoliageType& type, DrawCallsList* drawCallsLists, int32 depth, Array<DrawJob>& jobs, int32& jobsCount) const
+{
+    // Skip clusters that around too far from view
+    const Vector3 viewOrigin = renderContext.View.Origin;
+    if (Float3::Distance(renderContext.View.Position, cluster->TotalBoundsSphere.Center - viewOrigin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
+        return;
+
+    if (depth == 0 || !cluster->Children[0])
+    {
+        // Draw this cluster in a separate job
+        if (jobsCount == jobs.Count())
+            jobs.AddOne();
+        auto& job = jobs[jobsCount++];
+        job.Context = &renderContext;
+        job.Type = &type;
+        job.Cluster = cluster;
+        job.DrawCallsLists = drawCallsLists;
+        job.BatchesCount = 0;
+        job.LastBatch = 0;
+        return;
+    }
+
+    const int32 visibleChildren = CullClusterChildren(renderContext.View.CullingFrustum, cluster, viewOrigin);
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (visibleChildren & (1 << i))
+            GatherDrawJobs(renderContext, cluster->Children[i], type, drawCallsLists, depth - 1, jobs, jobsCount);
+    }
+}
+
+void Foliage::DrawCluster(DrawJob& job, FoliageCluster* cluster) const
 {
+    const RenderContext& renderContext = *job.Context;
+
     // Skip clusters that around too far from view
     const Vector3 viewOrigin = renderContext.View.Origin;
     if (Float3::Distance(renderContext.View.Position, cluster->TotalBoundsSphere.Center - viewOrigin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
@@ -134,24 +256,18 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Don't store instances in non-leaf nodes
         ASSERT_LOW_LAYER(cluster->Instances.IsEmpty());
 
-        BoundingBox box;
-#define DRAW_CLUSTER(idx) \
-        box = cluster->Children[idx]->TotalBounds; \
-        box.Minimum -= viewOrigin; \
-        box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
-        DRAW_CLUSTER(0);
-        DRAW_CLUSTER(1);
-        DRAW_CLUSTER(2);
-        DRAW_CLUSTER(3);
-#undef 	DRAW_CLUSTER
+        const int32 visibleChildren = CullClusterChildren(renderContext.View.CullingFrustum, cluster, viewOrigin);
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (visibleChildren & (1 << i))
+                DrawCluster(job, cluster->Children[i]);
+        }
     }
     else
     {
         // Draw visible instances
         const auto frame = Engine::FrameCount;
-        const auto model = type.Model.Get();
+        const auto model = job.Type->Model.Get();
         for (int32 i = 0; i < cluster->Instances.Count(); i++)
         {
             auto& instance = *cluster->Instances[i];
@@ -186,13 +302,14 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                         {
                             const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
                             const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                            DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
+                            DrawInstance(job, instance, model, prevLOD, normalizedProgress);
                         }
                     }
                     instance.DrawState.PrevFrame = frame;
                     continue;
                 }
                 lodIndex += renderContext.View.ModelLODBias;
+                model->RequestLOD(lodIndex);
                 lodIndex = model->ClampLODIndex(lodIndex);
 
                 // Check if it's the new frame and could update the drawing state (note: model instance could be rendered many times per frame to different viewports)
@@ -223,19 +340,19 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                 // Draw
                 if (instance.DrawState.PrevLOD == lodIndex)
                 {
-                    DrawInstance(renderContext, instance, type, model, lodIndex, 0.0f, drawCallsLists, result);
+                    DrawInstance(job, instance, model, lodIndex, 0.0f);
                 }
                 else if (instance.DrawState.PrevLOD == -1)
                 {
                     const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                    DrawInstance(renderContext, instance, type, model, lodIndex, 1.0f - normalizedProgress, drawCallsLists, result);
+                    DrawInstance(job, instance, model, lodIndex, 1.0f - normalizedProgress);
                 }
                 else
                 {
                     const auto prevLOD = model->ClampLODIndex(instance.DrawState.PrevLOD);
                     const float normalizedProgress = static_cast<float>(instance.DrawState.LODTransition) * (1.0f / 255.0f);
-                    DrawInstance(renderContext, instance, type, model, prevLOD, normalizedProgress, drawCallsLists, result);
-                    DrawInstance(renderContext, instance, type, model, lodIndex, normalizedProgress - 1.0f, drawCallsLists, result);
+                    DrawInstance(job, instance, model, prevLOD, normalizedProgress);
+                    DrawInstance(job, instance, model, lodIndex, normalizedProgress - 1.0f);
                 }
 
                 //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
@@ -1041,142 +1158,196 @@ void Foliage::Draw(RenderContext& renderContext)
     draw.LODBias = 0;
     draw.ForcedLOD = -1;
     draw.VertexColors = nullptr;
-#else
-    DrawCallsList drawCallsLists[MODEL_MAX_LODS];
 #endif
 #if FOLIAGE_USE_SINGLE_QUAD_TREE
     if (Root)
         DrawCluster(renderContext, Root, draw);
-#else
-    for (auto& type : FoliageTypes)
+#elif FOLIAGE_USE_DRAW_CALLS_BATCHING
+    // Draw calls and jobs data reused between draws (locked in case of the actor being drawn for multiple render contexts at once)
+    ScopeLock drawLock(_drawData->Locker);
+    auto& typesDrawCallsLists = _drawData->TypesDrawCallsLists;
+    auto& jobs = _drawData->Jobs;
+    typesDrawCallsLists.Resize(FoliageTypes.Count() * MODEL_MAX_LODS);
+    int32 jobsCount = 0;
+    for (int32 typeIndex = 0; typeIndex < FoliageTypes.Count(); typeIndex++)
     {
-        if (type.Root && type._canDraw && type.Model->CanBeRendered())
+        auto& type = FoliageTypes[typeIndex];
+        if (!type.Root || !type._canDraw || !type.Model->CanBeRendered())
+            continue;
+        DrawCallsList* drawCallsLists = &typesDrawCallsLists[typeIndex * MODEL_MAX_LODS];
+
+        // Initialize draw calls for foliage type all LODs meshes
+        for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
         {
-#if FOLIAGE_USE_DRAW_CALLS_BATCHING
-            // Initialize draw calls for foliage type all LODs meshes
-            for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
+            auto& modelLod = type.Model->LODs[lod];
+            DrawCallsList& drawCallsList = drawCallsLists[lod];
+            const auto& meshes = modelLod.Meshes;
+            drawCallsList.Resize(meshes.Count());
+            for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
             {
-                auto& modelLod = type.Model->LODs[lod];
-                DrawCallsList& drawCallsList = drawCallsLists[lod];
-                const auto& meshes = modelLod.Meshes;
-                drawCallsList.Resize(meshes.Count());
-                for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
-                {
-                    const auto& mesh = meshes[meshIndex];
-                    auto& drawCall = drawCallsList[meshIndex];
-                    drawCall.DrawCall.Material = nullptr;
-
-                    // Check entry visibility
-                    const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
-                    if (!entry.Visible || !mesh.IsInitialized())
-                        continue;
-                    const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
-
-                    // Select material
-                    MaterialBase* material;
-                    if (entry.Material && entry.Material->IsLoaded())
-                        material = entry.Material;
-                    else if (slot.Material && slot.Material->IsLoaded())
-                        material = slot.Material;
-                    else
-                        material = GPUDevice::Instance->GetDefaultMaterial();
-                    if (!material || !material->IsSurface())
-                        continue;
-
-                    // Select draw modes
-                    const auto shadowsMode = static_cast<ShadowsCastingMode>(entry.ShadowsMode & slot.ShadowsMode);
-                    const auto drawModes = static_cast<DrawPass>(type._drawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode)) & material->GetDrawModes();
-                    if (drawModes == 0)
-                        continue;
-
-                    drawCall.DrawCall.Material = material;
-                }
+                const auto& mesh = meshes[meshIndex];
+                auto& drawCall = drawCallsList[meshIndex];
+                drawCall.DrawCall.Material = nullptr;
+
+                // Check entry visibility
+                const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+                if (!entry.Visible || !mesh.IsInitialized())
+                    continue;
+                const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+
+                // Select material
+                MaterialBase* material;
+                if (entry.Material && entry.Material->IsLoaded())
+                    material = entry.Material;
+                else if (slot.Material && slot.Material->IsLoaded())
+                    material = slot.Material;
+                else
+                    material = GPUDevice::Instance->GetDefaultMaterial();
+                if (!material || !material->IsSurface())
+                    continue;
+
+                // Select draw modes
+                const auto shadowsMode = static_cast<ShadowsCastingMode>(entry.ShadowsMode & slot.ShadowsMode);
+                const auto drawModes = static_cast<DrawPass>(type._drawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode)) & material->GetDrawModes();
+                if (drawModes == 0)
+                    continue;
+
+                // Instanced foliage doesn't compute the on-screen UVs density so don't limit the textures
+                if (drawModes & (DrawPass::GBuffer | DrawPass::Forward))
+                    material->Params.RequestTexturesFullQuality();
+
+                drawCall.DrawCall.Material = material;
             }
+        }
+
+        // Split visible clusters of the foliage type into jobs
+        GatherDrawJobs(renderContext, type.Root, type, drawCallsLists, FOLIAGE_DRAW_JOBS_CLUSTER_DEPTH, jobs, jobsCount);
+    }
 
-            // Draw instances of the foliage type
-            BatchedDrawCalls result;
-            DrawCluster(renderContext, type.Root, type, drawCallsLists, result);
+    // Cull clusters and generate instances data (in parallel for large foliage)
+    if (jobsCount > 1 && Instances.Count() >= FOLIAGE_DRAW_JOBS_MIN_INSTANCES)
+    {
+        PROFILE_CPU_NAMED("Draw Jobs");
+        Function<void(int32)> drawJob = [this, &jobs](int32 jobIndex)
+        {
+            PROFILE_CPU_NAMED("Foliage Draw Job");
+            DrawJob& job = jobs[jobIndex];
+            DrawCluster(job, job.Cluster);
+        };
+        JobSystem::Execute(drawJob, jobsCount);
+    }
+    else
+    {
+        for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+            DrawCluster(jobs[jobIndex], jobs[jobIndex].Cluster);
+    }
 
-            // Submit draw calls with valid instances added
-            for (auto& e : result)
+    // Merge instances from all jobs of the foliage type and submit draw calls
+    for (int32 jobIndex = 0; jobIndex < jobsCount;)
+    {
+        auto& type = *jobs[jobIndex].Type;
+        BatchedDrawCalls result;
+        for (; jobIndex < jobsCount && jobs[jobIndex].Type == &type; jobIndex++)
+        {
+            const DrawJob& job = jobs[jobIndex];
+            for (int32 i = 0; i < job.BatchesCount; i++)
             {
-                auto& batch = e.Value;
-                if (batch.Instances.IsEmpty())
+                const auto& jobBatch = job.Batches[i];
+                if (jobBatch.Instances.IsEmpty())
                     continue;
-                const auto& mesh = *e.Key.Geo;
-                const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
-                const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
-                const auto shadowsMode = static_cast<ShadowsCastingMode>(entry.ShadowsMode & slot.ShadowsMode);
-                const auto drawModes = (DrawPass)(static_cast<DrawPass>(type._drawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode)) & batch.DrawCall.Material->GetDrawModes());
-
-                // Setup draw call
-                mesh.GetDrawCallGeometry(batch.DrawCall);
-                batch.DrawCall.InstanceCount = 1;
-                auto& firstInstance = batch.Instances[0];
-                batch.DrawCall.ObjectPosition = firstInstance.InstanceOrigin;
-                batch.DrawCall.PerInstanceRandom = firstInstance.PerInstanceRandom;
-                auto lightmapArea = firstInstance.InstanceLightmapArea.ToFloat4();
-                batch.DrawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
-                batch.DrawCall.Surface.LODDitherFactor = firstInstance.LODDitherFactor;
-                batch.DrawCall.World.SetRow1(Float4(firstInstance.InstanceTransform1, 0.0f));
-                batch.DrawCall.World.SetRow2(Float4(firstInstance.InstanceTransform2, 0.0f));
-                batch.DrawCall.World.SetRow3(Float4(firstInstance.InstanceTransform3, 0.0f));
-                batch.DrawCall.World.SetRow4(Float4(firstInstance.InstanceOrigin, 1.0f));
-                batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
-                batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
-                batch.DrawCall.Surface.Skinning = nullptr;
-                batch.DrawCall.WorldDeterminantSign = 1;
-
-                const int32 batchIndex = renderContext.List->BatchedDrawCalls.Count();
-                renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
-
-                // Add draw call to proper draw lists
-                if (drawModes & DrawPass::Depth)
-                {
-                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
-                }
-                if (drawModes & DrawPass::GBuffer)
-                {
-                    if (entry.ReceiveDecals)
-                        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
-                    else
-                        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
-                }
-                if (drawModes & DrawPass::Distortion)
-                {
-                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Distortion].PreBatchedDrawCalls.Add(batchIndex);
-                }
-                if (drawModes & DrawPass::MotionVectors && (_staticFlags & StaticFlags::Transform) == 0)
+                auto* e = result.TryGet(jobBatch.Key);
+                if (!e)
                 {
-                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::MotionVectors].PreBatchedDrawCalls.Add(batchIndex);
+                    e = &result[jobBatch.Key];
+                    e->DrawCall.Material = jobBatch.Key.Mat;
+                    e->DrawCall.Surface.Lightmap = _staticFlags & StaticFlags::Lightmap ? _scene->LightmapsData.GetReadyLightmap(jobBatch.Key.Lightmap) : nullptr;
                 }
-                if (drawModes & DrawPass::Forward)
+                e->Instances.Add(jobBatch.Instances.Get(), jobBatch.Instances.Count());
+            }
+        }
+
+        // Submit draw calls with valid instances added
+        for (auto& e : result)
+        {
+            auto& batch = e.Value;
+            if (batch.Instances.IsEmpty())
+                continue;
+            const auto& mesh = *e.Key.Geo;
+            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+            const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+            const auto shadowsMode = static_cast<ShadowsCastingMode>(entry.ShadowsMode & slot.ShadowsMode);
+            const auto drawModes = (DrawPass)(static_cast<DrawPass>(type._drawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode)) & batch.DrawCall.Material->GetDrawModes());
+
+            // Setup draw call
+            mesh.GetDrawCallGeometry(batch.DrawCall);
+            batch.DrawCall.InstanceCount = 1;
+            auto& firstInstance = batch.Instances[0];
+            batch.DrawCall.ObjectPosition = firstInstance.InstanceOrigin;
+            batch.DrawCall.PerInstanceRandom = firstInstance.PerInstanceRandom;
+            auto lightmapArea = firstInstance.InstanceLightmapArea.ToFloat4();
+            batch.DrawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+            batch.DrawCall.Surface.LODDitherFactor = firstInstance.LODDitherFactor;
+            batch.DrawCall.World.SetRow1(Float4(firstInstance.InstanceTransform1, 0.0f));
+            batch.DrawCall.World.SetRow2(Float4(firstInstance.InstanceTransform2, 0.0f));
+            batch.DrawCall.World.SetRow3(Float4(firstInstance.InstanceTransform3, 0.0f));
+            batch.DrawCall.World.SetRow4(Float4(firstInstance.InstanceOrigin, 1.0f));
+            batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
+            batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+            batch.DrawCall.Surface.Skinning = nullptr;
+            batch.DrawCall.WorldDeterminantSign = 1;
+
+            const int32 batchIndex = renderContext.List->BatchedDrawCalls.Count();
+            renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+
+            // Add draw call to proper draw lists
+            if (drawModes & DrawPass::Depth)
+            {
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (drawModes & DrawPass::GBuffer)
+            {
+                if (entry.ReceiveDecals)
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+                else
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (drawModes & DrawPass::Distortion)
+            {
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Distortion].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (drawModes & DrawPass::MotionVectors && (_staticFlags & StaticFlags::Transform) == 0)
+            {
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::MotionVectors].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (drawModes & DrawPass::Forward)
+            {
+                // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
+                batch = renderContext.List->BatchedDrawCalls[batchIndex];
+                DrawCall drawCall = batch.DrawCall;
+                for (int32 j = 0; j < batch.Instances.Count(); j++)
                 {
-                    // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
-                    batch = renderContext.List->BatchedDrawCalls[batchIndex];
-                    DrawCall drawCall = batch.DrawCall;
-                    for (int32 j = 0; j < batch.Instances.Count(); j++)
-                    {
-                        auto& instance = batch.Instances[j];
-                        drawCall.ObjectPosition = instance.InstanceOrigin;
-                        drawCall.PerInstanceRandom = instance.PerInstanceRandom;
-                        lightmapArea = instance.InstanceLightmapArea.ToFloat4();
-                        drawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
-                        drawCall.Surface.LODDitherFactor = instance.LODDitherFactor;
-                        drawCall.World.SetRow1(Float4(instance.InstanceTransform1, 0.0f));
-                        drawCall.World.SetRow2(Float4(instance.InstanceTransform2, 0.0f));
-                        drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
-                        drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
-                        const int32 drawCallIndex = renderContext.List->DrawCalls.Count();
-                        renderContext.List->DrawCalls.Add(drawCall);
-                        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
-                    }
+                    auto& instance = batch.Instances[j];
+                    drawCall.ObjectPosition = instance.InstanceOrigin;
+                    drawCall.PerInstanceRandom = instance.PerInstanceRandom;
+                    lightmapArea = instance.InstanceLightmapArea.ToFloat4();
+                    drawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+                    drawCall.Surface.LODDitherFactor = instance.LODDitherFactor;
+                    drawCall.World.SetRow1(Float4(instance.InstanceTransform1, 0.0f));
+                    drawCall.World.SetRow2(Float4(instance.InstanceTransform2, 0.0f));
+                    drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
+                    drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
+                    const int32 drawCallIndex = renderContext.List->DrawCalls.Count();
+                    renderContext.List->DrawCalls.Add(drawCall);
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
                 }
             }
+        }
+    }
 #else
+    for (auto& type : FoliageTypes)
+    {
+        if (type.Root && type._canDraw && type.Model->CanBeRendered())
             DrawCluster(renderContext, type.Root, draw);
-#endif
-        }
     }
 #endif
 }
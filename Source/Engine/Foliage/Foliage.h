@@ -18,6 +18,16 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 private:
     bool _disableFoliageTypeEvents;
     int32 _sceneRenderingKey = -1;
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    struct DrawData;
+    DrawData* _drawData;
+#endif
+
+public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="Foliage"/> class.
+    /// </summary>
+    ~Foliage();
 
 public:
     /// <summary>
@@ -170,8 +180,10 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 
     typedef Array<struct BatchedDrawCall, InlinedAllocation<8>> DrawCallsList;
     typedef Dictionary<DrawKey, struct BatchedDrawCall, class RenderListAllocation> BatchedDrawCalls;
-    void DrawInstance(RenderContext& renderContext, FoliageInstance& instance, FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
-    void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    struct DrawJob;
+    void DrawInstance(DrawJob& job, FoliageInstance& instance, Model* model, int32 lod, float lodDitherFactor) const;
+    void DrawCluster(DrawJob& job, FoliageCluster* cluster) const;
+    void GatherDrawJobs(RenderContext& renderContext, FoliageCluster* cluster, FoliageType& type, DrawCallsList* drawCallsLists, int32 depth, Array<DrawJob>& jobs, int32& jobsCount) const;
 #else
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw);
 #endif
@@ -65,10 +65,18 @@ class GPUUploadTextureMipTask : public GPUTask
             return Result::MissingResources;
         ASSERT(texture->IsAllocated());
 
-        // Update all array slices
+        // Write all array slices into the upload memory at once (if supported) to skip the separate staging copy for each slice
         const byte* dataSource = _data.Get();
         const int32 arraySize = texture->ArraySize();
         ASSERT(_data.Length() >= _slicePitch * arraySize);
+        void* uploadMemory = context->GPU->AllocateUploadMemory(_slicePitch * arraySize);
+        if (uploadMemory)
+        {
+            Platform::MemoryCopy(uploadMemory, dataSource, _slicePitch * arraySize);
+            dataSource = (const byte*)uploadMemory;
+        }
+
+        // Update all array slices
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
             context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch);
@@ -217,6 +217,16 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     virtual void ClearUA(GPUTexture* texture, const Float4& value) = 0;
 
 public:
+    /// <summary>
+    /// Allocates the temporary upload memory for the data passed later to UpdateBuffer or UpdateTexture (within the current frame). Allows to write the data directly into the staging memory to skip the additional copy.
+    /// </summary>
+    /// <param name="size">The allocation size (in bytes).</param>
+    /// <returns>The CPU-writable upload memory or null if not supported by the backend (or the upload memory is full). Then use the regular memory for the data.</returns>
+    virtual void* AllocateUploadMemory(uint32 size)
+    {
+        return nullptr;
+    }
+
     /// <summary>
     /// Updates the buffer data.
     /// </summary>
@@ -76,6 +76,10 @@ bool GPUPipelineState::Init(const Description& desc)
     return false;
 }
 
+void GPUPipelineState::Prewarm()
+{
+}
+
 GPUResource::ResourceType GPUPipelineState::GetResourceType() const
 {
     return ResourceType::PipelineState;
@@ -158,6 +158,11 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUPipelineState : public GPUResource
     /// <returns>True if cannot create state, otherwise false</returns>
     API_FUNCTION() virtual bool Init(API_PARAM(Ref) const Description& desc);
 
+    /// <summary>
+    /// Starts the background compilation of the pipeline state for the render targets layouts already used by the graphics device (if supported by the rendering backend). Can be used to prevent hitches on the first draw with this state.
+    /// </summary>
+    API_FUNCTION() virtual void Prewarm();
+
 public:
     // [GPUResource]
     ResourceType GetResourceType() const final override;
@@ -157,6 +157,15 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     context->SetState(state);
 }
 
+void DeferredMaterialShader::Prewarm()
+{
+    // Pipelines used by the opaque geometry (skinned and motion vectors variants are left to be created on use)
+    _cache.Default.Prewarm(_info.CullMode);
+    _cache.Depth.Prewarm(CullMode::TwoSided);
+    _cacheInstanced.Default.Prewarm(_info.CullMode);
+    _cacheInstanced.Depth.Prewarm(CullMode::TwoSided);
+}
+
 void DeferredMaterialShader::Unload()
 {
     // Base
@@ -77,6 +77,7 @@ class DeferredMaterialShader : public MaterialShader
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
+    void Prewarm() override;
     void Bind(BindParameters& params) override;
     void Unload() override;
 
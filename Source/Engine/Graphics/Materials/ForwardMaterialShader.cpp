@@ -149,6 +149,15 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     context->SetState(state);
 }
 
+void ForwardMaterialShader::Prewarm()
+{
+    // Pipelines used by the transparent geometry (skinned variants are left to be created on use)
+    _cache.Default.Prewarm(_info.CullMode);
+    _cache.Depth.Prewarm(CullMode::TwoSided);
+    _cacheInstanced.Default.Prewarm(_info.CullMode);
+    _cacheInstanced.Depth.Prewarm(CullMode::TwoSided);
+}
+
 void ForwardMaterialShader::Unload()
 {
     // Base
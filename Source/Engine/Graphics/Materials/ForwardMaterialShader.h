@@ -72,6 +72,7 @@ class ForwardMaterialShader : public MaterialShader
     // [MaterialShader]
     DrawPass GetDrawModes() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
+    void Prewarm() override;
     void Bind(BindParameters& params) override;
     void Unload() override;
 
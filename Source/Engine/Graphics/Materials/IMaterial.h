@@ -132,6 +132,13 @@ class FLAXENGINE_API IMaterial
         return false;
     }
 
+    /// <summary>
+    /// Starts the background compilation of the pipeline states commonly used to draw this material (if supported by the rendering backend). Can be called for the materials used by the scene to prevent hitches on the first draw.
+    /// </summary>
+    virtual void Prewarm()
+    {
+    }
+
 public:
     /// <summary>
     /// Settings for the material binding to the graphics pipeline.
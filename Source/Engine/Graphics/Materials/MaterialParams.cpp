@@ -560,6 +560,7 @@ void MaterialParameter::clone(const MaterialParameter* param)
     _registerIndex = param->_registerIndex;
     _offset = param->_offset;
     _name = param->_name;
+    _nameId = param->_nameId;
     _paramId = param->_paramId;
 
     // Clone value
@@ -623,11 +624,19 @@ MaterialParameter* MaterialParams::Get(const Guid& id)
 }
 
 MaterialParameter* MaterialParams::Get(const StringView& name)
+{
+    Name nameId;
+    if (!Name::Find(name, nameId))
+        return nullptr;
+    return Get(nameId);
+}
+
+MaterialParameter* MaterialParams::Get(const Name& name)
 {
     MaterialParameter* result = nullptr;
     for (int32 i = 0; i < Count(); i++)
     {
-        if (At(i).GetName() == name)
+        if (At(i).GetNameId() == name)
         {
             result = &At(i);
             break;
@@ -651,11 +660,19 @@ int32 MaterialParams::Find(const Guid& id)
 }
 
 int32 MaterialParams::Find(const StringView& name)
+{
+    Name nameId;
+    if (!Name::Find(name, nameId))
+        return -1;
+    return Find(nameId);
+}
+
+int32 MaterialParams::Find(const Name& name)
 {
     int32 result = -1;
     for (int32 i = 0; i < Count(); i++)
     {
-        if (At(i).GetName() == name)
+        if (At(i).GetNameId() == name)
         {
             result = i;
             break;
@@ -738,6 +755,7 @@ bool MaterialParams::Load(ReadStream* stream)
                 param->_isPublic = stream->ReadBool();
                 param->_override = param->_isPublic;
                 stream->ReadString(&param->_name, 10421);
+                param->_nameId = Name(param->_name);
                 param->_registerIndex = stream->ReadByte();
                 stream->ReadUint16(&param->_offset);
 
@@ -813,6 +831,7 @@ bool MaterialParams::Load(ReadStream* stream)
                 param->_isPublic = stream->ReadBool();
                 param->_override = param->_isPublic;
                 stream->ReadString(&param->_name, 10421);
+                param->_nameId = Name(param->_name);
                 param->_registerIndex = stream->ReadByte();
                 stream->ReadUint16(&param->_offset);
 
@@ -887,6 +906,7 @@ bool MaterialParams::Load(ReadStream* stream)
                 param->_isPublic = stream->ReadBool();
                 param->_override = stream->ReadBool();
                 stream->ReadString(&param->_name, 10421);
+                param->_nameId = Name(param->_name);
                 param->_registerIndex = stream->ReadByte();
                 stream->ReadUint16(&param->_offset);
 
@@ -1128,6 +1148,34 @@ void MaterialParams::GetReferences(Array<Guid>& output) const
 
 #endif
 
+void MaterialParams::RequestTexturesMips(float uvScreenDensity) const
+{
+    for (int32 i = 0; i < Count(); i++)
+    {
+        const MaterialParameter& param = At(i);
+        if ((param._type == MaterialParameterType::Texture || param._type == MaterialParameterType::NormalMap) && param._asAsset)
+        {
+            const auto texture = (TextureBase*)param._asAsset.Get();
+            if (texture->IsLoaded())
+                texture->StreamingTexture()->RequestUVScreenDensity(uvScreenDensity);
+        }
+    }
+}
+
+void MaterialParams::RequestTexturesFullQuality() const
+{
+    for (int32 i = 0; i < Count(); i++)
+    {
+        const MaterialParameter& param = At(i);
+        if ((param._type == MaterialParameterType::Texture || param._type == MaterialParameterType::NormalMap) && param._asAsset)
+        {
+            const auto texture = (TextureBase*)param._asAsset.Get();
+            if (texture->IsLoaded())
+                texture->StreamingTexture()->RequestMip(0);
+        }
+    }
+}
+
 bool MaterialParams::HasContentLoaded() const
 {
     bool result = true;
@@ -5,7 +5,7 @@
 #include "Engine/Core/Math/Color.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
-#include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Types/Name.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Content/Assets/Texture.h"
@@ -199,6 +199,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     AssetReference<Asset> _asAsset;
     ScriptingObjectReference<GPUTexture> _asGPUTexture;
     String _name;
+    Name _nameId;
 
 public:
     MaterialParameter(const MaterialParameter& other)
@@ -242,6 +243,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
         return _name;
     }
 
+    /// <summary>
+    /// Gets the parameter name (interned for fast lookups).
+    /// </summary>
+    FORCE_INLINE const Name& GetNameId() const
+    {
+        return _nameId;
+    }
+
     /// <summary>
     /// Returns true is parameter is public visible.
     /// </summary>
@@ -362,8 +371,10 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
 public:
     MaterialParameter* Get(const Guid& id);
     MaterialParameter* Get(const StringView& name);
+    MaterialParameter* Get(const Name& name);
     int32 Find(const Guid& id);
     int32 Find(const StringView& name);
+    int32 Find(const Name& name);
 
 public:
     /// <summary>
@@ -417,6 +428,17 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
     /// <param name="params">The array of parameters.</param>
     static void Save(BytesContainer& data, const Array<SerializedMaterialParam>* params);
 
+    /// <summary>
+    /// Requests the streaming mip levels of the textures used by the parameters to draw them with the given on-screen UVs density. Thread-safe.
+    /// </summary>
+    /// <param name="uvScreenDensity">The amount of screen pixels per unit of the UVs space (see RenderTools::ComputeUVScreenDensity).</param>
+    void RequestTexturesMips(float uvScreenDensity) const;
+
+    /// <summary>
+    /// Requests the full quality of the streaming textures used by the parameters. Used by the draws that cannot compute their on-screen UVs density (eg. skinned meshes, terrain, decals or UI) so the textures shared with the other meshes are not limited. Thread-safe.
+    /// </summary>
+    void RequestTexturesFullQuality() const;
+
 public:
 #if USE_EDITOR
 
@@ -49,6 +49,15 @@ class MaterialShader : public IMaterial
 
         GPUPipelineState* InitPS(CullMode mode, bool wireframe);
 
+        void Prewarm(CullMode mode)
+        {
+            if (Desc.VS == nullptr)
+                return;
+            auto ps = GetPS(mode, false);
+            if (ps)
+                ps->Prewarm();
+        }
+
         void Release()
         {
             SAFE_DELETE_GPU_RESOURCES(PS);
@@ -8,6 +8,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Serialization/MemoryReadStream.h"
@@ -214,6 +215,7 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _materialSlotIndex = materialSlotIndex;
     _use16BitIndexBuffer = false;
     _hasLightmapUVs = hasLightmapUVs;
+    _uvDensity = 0.0f;
     _box = box;
     _sphere = sphere;
     _vertices = 0;
@@ -403,10 +405,31 @@ void Mesh::Render(GPUContext* context) const
     context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, 0);
 }
 
+void Mesh::RequestTexturesMips(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, DrawPass drawModes) const
+{
+    // Request textures mips required by the on-screen size of the mesh (skip shadow passes)
+    if ((drawModes & (DrawPass::GBuffer | DrawPass::Forward)) == 0)
+        return;
+    if (_uvDensity > 0.0f)
+    {
+        BoundingSphere sphere;
+        BoundingSphere::Transform(_sphere, world, sphere);
+        const float scale = _sphere.Radius > ZeroTolerance ? (float)(sphere.Radius / _sphere.Radius) : 1.0f;
+        const float uvScreenDensity = RenderTools::ComputeUVScreenDensity(renderContext.View, sphere.Center, (float)sphere.Radius, _uvDensity / scale);
+        material->Params.RequestTexturesMips(uvScreenDensity);
+    }
+    else
+    {
+        // Mesh has no UVs density (eg. model imported before it was computed) so don't limit the textures
+        material->Params.RequestTexturesFullQuality();
+    }
+}
+
 void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, StaticFlags flags, bool receiveDecals, DrawPass drawModes, float perInstanceRandom) const
 {
     if (!material || !material->IsSurface() || !IsInitialized())
         return;
+    RequestTexturesMips(renderContext, material, world, drawModes);
 
     // Submit draw call
     DrawCall drawCall;
@@ -459,6 +482,8 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
     if (!material || !material->IsSurface())
         return;
 
+    RequestTexturesMips(renderContext, material, *info.World, drawModes);
+
     // Submit draw call
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
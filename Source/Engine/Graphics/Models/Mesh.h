@@ -23,6 +23,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(Mesh, MeshBase);
 protected:
     bool _hasLightmapUVs;
+    float _uvDensity = 0.0f;
     GPUBuffer* _vertexBuffers[3] = {};
     GPUBuffer* _indexBuffer = nullptr;
 #if USE_PRECISE_MESH_INTERSECTS
@@ -94,6 +95,22 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
         return _hasLightmapUVs;
     }
 
+    /// <summary>
+    /// Gets the density of the mesh texture coordinates (amount of UVs space units per world unit of the mesh surface). Used by the textures streaming to estimate the mip levels required to draw the mesh. Zero if unknown.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetUVDensity() const
+    {
+        return _uvDensity;
+    }
+
+    /// <summary>
+    /// Sets the density of the mesh texture coordinates (amount of UVs space units per world unit of the mesh surface). Used by the textures streaming to estimate the mip levels required to draw the mesh. Zero if unknown.
+    /// </summary>
+    API_PROPERTY() void SetUVDensity(float value)
+    {
+        _uvDensity = value;
+    }
+
 #if USE_PRECISE_MESH_INTERSECTS
 
     /// <summary>
@@ -374,6 +391,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     bool DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& count) const override;
 
 private:
+    void RequestTexturesMips(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, DrawPass drawModes) const;
+
     // Internal bindings
     API_FUNCTION(NoProxy) ScriptingObject* GetParentModel();
 #if !COMPILE_WITHOUT_CSHARP
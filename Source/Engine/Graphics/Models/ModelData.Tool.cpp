@@ -883,4 +883,22 @@ float MeshData::CalculateTrianglesArea() const
     return sum;
 }
 
+float MeshData::CalculateUVDensity() const
+{
+    if (UVs.Count() != Positions.Count())
+        return 0.0f;
+    float surfaceArea = 0.0f, uvArea = 0.0f;
+    for (int32 i = 0; i + 2 < Indices.Count(); i += 3)
+    {
+        const uint32 i0 = Indices[i + 0], i1 = Indices[i + 1], i2 = Indices[i + 2];
+        surfaceArea += Float3::TriangleArea(Positions[i0], Positions[i1], Positions[i2]);
+        const Float2 uv1 = UVs[i1] - UVs[i0];
+        const Float2 uv2 = UVs[i2] - UVs[i0];
+        uvArea += Math::Abs(uv1.X * uv2.Y - uv1.Y * uv2.X) * 0.5f;
+    }
+    if (surfaceArea <= ZeroTolerance || uvArea <= ZeroTolerance)
+        return 0.0f;
+    return Math::Sqrt(uvArea / surfaceArea);
+}
+
 #endif
@@ -754,6 +754,13 @@ bool ModelData::Pack2ModelHeader(WriteStream* stream) const
         }
     }
 
+    // UVs density (optional, missing in models saved before)
+    for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+    {
+        for (const MeshData* mesh : LODs[lodIndex].Meshes)
+            stream->WriteFloat(mesh->UVDensity);
+    }
+
     return false;
 }
 
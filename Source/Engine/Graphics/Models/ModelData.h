@@ -90,6 +90,11 @@ class FLAXENGINE_API MeshData
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// The density of the texture coordinates (amount of UVs space units per world unit of the mesh surface). Used by the textures streaming to estimate the mip levels required to draw the mesh. Zero if unknown.
+    /// </summary>
+    float UVDensity = 0.0f;
+
 public:
     /// <summary>
     /// Determines whether this instance has any mesh data.
@@ -254,6 +259,12 @@ class FLAXENGINE_API MeshData
     /// <returns>The area sum of all mesh triangles.</returns>
     float CalculateTrianglesArea() const;
 
+    /// <summary>
+    /// Calculates the density of the texture coordinates (square root of the UVs space area per mesh surface area).
+    /// </summary>
+    /// <returns>The amount of UVs space units per world unit of the mesh surface, or zero if mesh has no valid texture coordinates.</returns>
+    float CalculateUVDensity() const;
+
 #endif
 
     /// <summary>
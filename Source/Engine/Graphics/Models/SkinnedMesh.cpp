@@ -175,6 +175,10 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     if (!material || !material->IsSurface())
         return;
 
+    // Skinned meshes don't compute the on-screen UVs density (deformation makes the bind-pose density unreliable) so don't limit the textures
+    if (drawModes & (DrawPass::GBuffer | DrawPass::Forward))
+        material->Params.RequestTexturesFullQuality();
+
     // Submit draw call
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
@@ -5,6 +5,7 @@
 #include "Engine/Animations/Config.h"
 #include "Engine/Core/Math/Matrix.h"
 #include "Engine/Core/Math/Matrix3x4.h"
+#include "Engine/Profiler/RenderStats.h"
 
 SkinnedMeshDrawData::SkinnedMeshDrawData()
 {
@@ -33,6 +34,8 @@ void SkinnedMeshDrawData::Setup(int32 bonesCount)
     BonesCount = bonesCount;
     _hasValidData = false;
     _isDirty = false;
+    _isPrevPoseSame = false;
+    _isPoseChanged = false;
     Data.Resize(BoneMatrices->GetSize());
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
 }
@@ -49,19 +52,41 @@ void SkinnedMeshDrawData::SetData(const Matrix* bones, bool dropHistory)
     const Matrix* input = bones;
     const auto output = (Matrix3x4*)Data.Get();
     ASSERT(Data.Count() == count * sizeof(Matrix3x4));
+    bool poseChanged = false;
     for (int32 i = 0; i < count; i++)
     {
         Matrix3x4* bone = output + i;
         Platform::Prefetch(bone + preFetchStride);
         Platform::Prefetch((byte*)(bone + preFetchStride) + PLATFORM_CACHE_LINE_SIZE);
-        bone->SetMatrixTranspose(input[i]);
+        poseChanged |= SetBone(*bone, input[i]);
     }
 
-    OnDataChanged(dropHistory);
+    OnDataChanged(dropHistory, poseChanged);
 }
 
-void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
+void SkinnedMeshDrawData::OnDataChanged(bool dropHistory, bool poseChanged)
 {
+    if (dropHistory)
+    {
+        SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+        _isPrevPoseSame = false;
+    }
+
+    // Merge with the previous update if it was not flushed yet (GPU buffers still contain the older poses)
+    if (_isDirty)
+    {
+        _isPoseChanged |= poseChanged;
+        RENDER_STAT_SKINNING_SKIP();
+        return;
+    }
+
+    // Skip the update if the GPU buffers already contain the current pose
+    if (_hasValidData && !poseChanged && (dropHistory || _isPrevPoseSame))
+    {
+        RENDER_STAT_SKINNING_SKIP();
+        return;
+    }
+
     // Setup previous frame bone matrices if needed
     if (_hasValidData && !dropHistory)
     {
@@ -81,6 +106,9 @@ void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
         SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
     }
 
+    // History matches the current pose only once it gets flushed
+    _isPrevPoseSame = false;
+    _isPoseChanged = poseChanged;
     _isDirty = true;
     _hasValidData = true;
 }
@@ -90,6 +118,18 @@ void SkinnedMeshDrawData::Flush(GPUContext* context)
     if (_isDirty)
     {
         _isDirty = false;
+        _isPrevPoseSame = PrevBoneMatrices != nullptr && !_isPoseChanged;
         context->UpdateBuffer(BoneMatrices, Data.Get(), Data.Count());
+        RENDER_STAT_SKINNING_UPLOAD(Data.Count());
     }
 }
+
+bool SkinnedMeshDrawData::SetBone(Matrix3x4& output, const Matrix& matrix)
+{
+    Matrix3x4 bone;
+    bone.SetMatrixTranspose(matrix);
+    if (Platform::MemoryCompare(&output, &bone, sizeof(Matrix3x4)) == 0)
+        return false;
+    output = bone;
+    return true;
+}
@@ -5,6 +5,8 @@
 #include "Engine/Core/Common.h"
 #include "Engine/Graphics/GPUBuffer.h"
 
+struct Matrix3x4;
+
 /// <summary>
 /// Data storage for the skinned meshes rendering
 /// </summary>
@@ -13,6 +15,8 @@ class FLAXENGINE_API SkinnedMeshDrawData
 private:
     bool _hasValidData = false;
     bool _isDirty = false;
+    bool _isPrevPoseSame = false;
+    bool _isPoseChanged = false;
 
 public:
     /// <summary>
@@ -55,6 +59,22 @@ class FLAXENGINE_API SkinnedMeshDrawData
         return BoneMatrices != nullptr && BoneMatrices->IsAllocated();
     }
 
+    /// <summary>
+    /// Determines whether the bones data has been modified and needs to be flushed with the GPU.
+    /// </summary>
+    FORCE_INLINE bool IsDirty() const
+    {
+        return _isDirty;
+    }
+
+    /// <summary>
+    /// Determines whether the previous update bones used for motion blur contain the same pose as the current bones (both flushed with the GPU).
+    /// </summary>
+    FORCE_INLINE bool IsPrevPoseSame() const
+    {
+        return _isPrevPoseSame;
+    }
+
     /// <summary>
     /// Setups the data container for the specified bones amount.
     /// </summary>
@@ -71,8 +91,20 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// <summary>
     /// After bones Data has been modified externally. Updates the bone matrices data for the GPU buffer. Ensure to call Flush before rendering.
     /// </summary>
+    /// <remarks>
+    /// When the pose didn't change the GPU upload is skipped (once the previous update bones used for motion blur match the current pose). Multiple updates before the Flush are merged into a single upload.
+    /// </remarks>
     /// <param name="dropHistory">True if drop previous update bones used for motion blur, otherwise will keep them and do the update.</param>
-    void OnDataChanged(bool dropHistory);
+    /// <param name="poseChanged">True if any bone transformation has been modified since the last update, otherwise false.</param>
+    void OnDataChanged(bool dropHistory, bool poseChanged = true);
+
+    /// <summary>
+    /// Sets the bone transformation in the Data buffer (stored as transposed 4x3 matrix).
+    /// </summary>
+    /// <param name="output">The output bone data.</param>
+    /// <param name="matrix">The bone transformation.</param>
+    /// <returns>True if the bone data has been modified, otherwise false.</returns>
+    static bool SetBone(Matrix3x4& output, const Matrix& matrix);
 
     /// <summary>
     /// Flushes the bones data buffer with the GPU by sending the data fro the CPU.
@@ -489,6 +489,26 @@ int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float
     return 0;
 }
 
+float RenderTools::ComputeUVScreenDensity(const RenderView& view, const Float3& origin, float radius, float uvDensity)
+{
+    if (uvDensity <= ZeroTolerance)
+        return 0.0f;
+    float pixelsPerUnit = 0.5f * view.ScreenSize.Y * view.Projection.Values[1][1];
+    if (!view.IsOrthographicProjection())
+    {
+        const float distance = Math::Max(Float3::Distance(origin, view.Position) - radius, view.Near);
+        pixelsPerUnit /= distance;
+    }
+    return pixelsPerUnit / uvDensity;
+}
+
+int32 RenderTools::ComputeTextureMip(int32 textureSize, float uvScreenDensity)
+{
+    // Each mip halves the texels count so pick the last one that still has at least one texel per screen pixel
+    const float texelsPerPixel = (float)textureSize / Math::Max(uvScreenDensity, ZeroTolerance);
+    return texelsPerPixel > 1.0f ? Math::FloorToInt(Math::Log2(texelsPerPixel)) : 0;
+}
+
 int32 MipLevelsCount(int32 width, bool useMipLevels)
 {
     if (!useMipLevels)
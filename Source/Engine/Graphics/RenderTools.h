@@ -99,6 +99,24 @@ API_CLASS(Static) class FLAXENGINE_API RenderTools
     /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
     API_FUNCTION() static int32 ComputeSkinnedModelLOD(const SkinnedModel* model, API_PARAM(Ref) const Float3& origin, float radius, API_PARAM(Ref) const RenderContext& renderContext);
 
+    /// <summary>
+    /// Computes the on-screen density of the mesh texture coordinates (amount of screen pixels per unit of the UVs space). Uses the nearest point of the bounds so it's conservative for large meshes.
+    /// </summary>
+    /// <param name="view">The render view.</param>
+    /// <param name="origin">The bounds origin.</param>
+    /// <param name="radius">The bounds radius.</param>
+    /// <param name="uvDensity">The mesh UVs density (amount of UVs space units per world unit, including the object scale).</param>
+    /// <returns>The amount of screen pixels per unit of the UVs space.</returns>
+    static float ComputeUVScreenDensity(const RenderView& view, const Float3& origin, float radius, float uvDensity);
+
+    /// <summary>
+    /// Computes the most detailed texture mip level required to sample the texture at the given on-screen UVs density without visible blur.
+    /// </summary>
+    /// <param name="textureSize">The texture size (the largest dimension of the top mip, in texels).</param>
+    /// <param name="uvScreenDensity">The amount of screen pixels per unit of the UVs space (see ComputeUVScreenDensity).</param>
+    /// <returns>The zero-based mip level index (0 is the most detailed mip).</returns>
+    static int32 ComputeTextureMip(int32 textureSize, float uvScreenDensity);
+
     /// <summary>
     /// Computes the sorting key for depth value (quantized)
     /// Reference: http://aras-p.info/blog/2014/01/16/rough-sorting-by-depth/
@@ -46,6 +46,9 @@ StreamingTexture::StreamingTexture(ITextureOwner* parent, const String& name)
     , _owner(parent)
     , _texture(nullptr)
     , _isBlockCompressed(false)
+    , _requestedMip(MAX_int32)
+    , _lastRequestedMip(MAX_int32)
+    , _lastRequestedMipTime(0.0)
 {
     ASSERT(_owner != nullptr);
 
@@ -81,6 +84,37 @@ int32 StreamingTexture::TotalIndexToTextureMipIndex(int32 mipIndex) const
     return mipIndex - missingMips;
 }
 
+void StreamingTexture::RequestMip(int32 mipIndex) const
+{
+    // Atomic min (most of the requests don't change the value so skip the write then)
+    int32 current = Platform::AtomicRead(&_requestedMip);
+    while (mipIndex < current)
+    {
+        const int32 prev = Platform::InterlockedCompareExchange(&_requestedMip, mipIndex, current);
+        if (prev == current)
+            break;
+        current = prev;
+    }
+}
+
+void StreamingTexture::RequestUVScreenDensity(float uvScreenDensity) const
+{
+    RequestMip(RenderTools::ComputeTextureMip(Math::Max(_header.Width, _header.Height), uvScreenDensity));
+}
+
+int32 StreamingTexture::FlushRequestedMip() const
+{
+    int32 current = Platform::AtomicRead(&_requestedMip);
+    while (current != MAX_int32)
+    {
+        const int32 prev = Platform::InterlockedCompareExchange(&_requestedMip, MAX_int32, current);
+        if (prev == current)
+            break;
+        current = prev;
+    }
+    return current;
+}
+
 bool StreamingTexture::Create(const TextureHeader& header)
 {
     // Validate header (further validation is performed by the Texture.Init)
@@ -372,8 +406,16 @@ class StreamTextureMipTask : public GPUUploadTextureMipTask
         _data.Link(data);
         ASSERT(data.Length() >= (int32)slicePitch * arraySize);
 
-        // Update all array slices
+        // Write all array slices into the upload memory at once (if supported) to skip the separate staging copy for each slice
         const byte* dataSource = data.Get();
+        void* uploadMemory = context->GPU->AllocateUploadMemory(slicePitch * arraySize);
+        if (uploadMemory)
+        {
+            Platform::MemoryCopy(uploadMemory, dataSource, slicePitch * arraySize);
+            dataSource = (const byte*)uploadMemory;
+        }
+
+        // Update all array slices
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
             context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, rowPitch, slicePitch);
@@ -21,6 +21,9 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     TextureHeader _header;
     int32 _minMipCountBlockCompressed;
     bool _isBlockCompressed;
+    mutable volatile int32 _requestedMip;
+    int32 _lastRequestedMip;
+    double _lastRequestedMipTime;
     Array<Task*, FixedAllocation<16>> _streamingTasks;
 
 public:
@@ -136,6 +139,24 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     /// <returns>The index of the mip map.</returns>
     int32 TotalIndexToTextureMipIndex(int32 mipIndex) const;
 
+public:
+    /// <summary>
+    /// Requests the mip level required by the rendering (eg. computed from the on-screen size of the mesh that uses this texture). The most detailed mip requested since the last streaming update limits the texture quality. Thread-safe and lock-free.
+    /// </summary>
+    /// <param name="mipIndex">The absolute index of the mip map (0 is the most detailed mip).</param>
+    void RequestMip(int32 mipIndex) const;
+
+    /// <summary>
+    /// Requests the mip level required to draw this texture with the given on-screen UVs density. Thread-safe and lock-free.
+    /// </summary>
+    /// <param name="uvScreenDensity">The amount of screen pixels per unit of the UVs space (see RenderTools::ComputeUVScreenDensity).</param>
+    void RequestUVScreenDensity(float uvScreenDensity) const;
+
+    /// <summary>
+    /// Gets the most detailed mip level requested since the last call and resets the requests. Returns MAX_int32 if none was requested.
+    /// </summary>
+    int32 FlushRequestedMip() const;
+
 public:
     /// <summary>
     /// Creates new texture
@@ -679,6 +679,7 @@ void GPUContextDX11::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 si
 {
     ASSERT(data);
     ASSERT(buffer && buffer->GetSize() >= size);
+    RENDER_STAT_UPLOAD(size);
 
     auto bufferDX11 = (GPUBufferDX11*)buffer;
 
@@ -730,6 +731,7 @@ void GPUContextDX11::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32
     ASSERT(texture && texture->IsAllocated() && data);
 
     auto textureDX11 = static_cast<GPUTextureDX11*>(texture);
+    RENDER_STAT_UPLOAD(slicePitch);
 
     const int32 subresourceIndex = RenderToolsDX::CalcSubresourceIndex(mipIndex, arrayIndex, texture->MipLevels());
     uint32 depthPitch = slicePitch;
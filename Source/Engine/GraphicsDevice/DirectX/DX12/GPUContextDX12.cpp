@@ -1206,6 +1206,7 @@ void GPUContextDX12::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 si
     SetResourceState(bufferDX12, D3D12_RESOURCE_STATE_COPY_DEST);
     flushRBs();
 
+    RENDER_STAT_UPLOAD(size);
     _device->UploadBuffer->UploadBuffer(this, bufferDX12->GetResource(), offset, data, size);
 }
 
@@ -1232,6 +1233,7 @@ void GPUContextDX12::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32
     SetResourceState(textureDX12, D3D12_RESOURCE_STATE_COPY_DEST);
     flushRBs();
 
+    RENDER_STAT_UPLOAD(slicePitch);
     _device->UploadBuffer->UploadTexture(this, textureDX12->GetResource(), data, rowPitch, slicePitch, mipIndex, arrayIndex);
 }
 
@@ -25,11 +25,24 @@
 /// </summary>
 #define VULKAN_RESOURCE_DELETE_SAFE_FRAMES_COUNT 10
 
+// Size of the persistently mapped staging ring buffer used for the data uploads (per single frame, the total size includes all frames in flight)
+#ifndef VULKAN_UPLOAD_RING_BUFFER_FRAME_SIZE
+#define VULKAN_UPLOAD_RING_BUFFER_FRAME_SIZE (8 * 1024 * 1024)
+#endif
+
+// Alignment of the upload ring buffer allocations (multiple of all texel block sizes: 1, 2, 4, 8, 12 and 16 bytes)
+#define VULKAN_UPLOAD_ALIGNMENT 48
+
 #define VULKAN_ENABLE_API_DUMP 0
 #define VULKAN_RESET_QUERY_POOLS 0
 #define VULKAN_HASH_POOLS_WITH_TYPES_USAGE_ID 1
 #define VULKAN_USE_DEBUG_LAYER GPU_ENABLE_DIAGNOSTICS
 
+// Enables graphics pipelines compilation on the thread pool (used by pipelines pre-warming and by the draws skipping while pipeline is pending)
+#ifndef VULKAN_ASYNC_PIPELINES
+#define VULKAN_ASYNC_PIPELINES 1
+#endif
+
 #ifndef VULKAN_USE_QUERIES
 #define VULKAN_USE_QUERIES 1
 #endif
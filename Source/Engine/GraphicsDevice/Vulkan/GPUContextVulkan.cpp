@@ -643,23 +643,28 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
     }
 }
 
-void GPUContextVulkan::BindPipeline()
+bool GPUContextVulkan::BindPipeline()
 {
     if (_psDirtyFlag && _currentState && (_rtDepth || _rtCount))
     {
+        // Get state (null if it's still being compiled)
+        const auto pipeline = _currentState->GetState(_renderPass);
+        if (pipeline == VK_NULL_HANDLE)
+            return false;
+
         // Clear flag
         _psDirtyFlag = false;
 
         // Change state
         const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-        const auto pipeline = _currentState->GetState(_renderPass);
         vkCmdBindPipeline(cmdBuffer->GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 
         RENDER_STAT_PS_STATE_CHANGE();
     }
+    return true;
 }
 
-void GPUContextVulkan::OnDrawCall()
+bool GPUContextVulkan::OnDrawCall()
 {
     GPUPipelineStateVulkan* pipelineState = _currentState;
     ASSERT(pipelineState && pipelineState->IsValid());
@@ -698,7 +703,12 @@ void GPUContextVulkan::OnDrawCall()
         BeginRenderPass();
     }
 
-    BindPipeline();
+    if (!BindPipeline())
+    {
+        // Skip draw until pipeline is ready
+        _rtDirtyFlag = false;
+        return false;
+    }
 
     //UpdateDynamicStates();
 
@@ -714,6 +724,7 @@ void GPUContextVulkan::OnDrawCall()
 #if VK_ENABLE_BARRIERS_DEBUG
     LOG(Warning, "Draw");
 #endif
+    return true;
 }
 
 void GPUContextVulkan::FrameBegin()
@@ -1200,7 +1211,8 @@ void GPUContextVulkan::ResolveMultisample(GPUTexture* sourceMultisampleTexture,
 void GPUContextVulkan::DrawInstanced(uint32 verticesCount, uint32 instanceCount, int32 startInstance, int32 startVertex)
 {
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (!OnDrawCall())
+        return;
     vkCmdDraw(cmdBuffer->GetHandle(), verticesCount, instanceCount, startVertex, startInstance);
     RENDER_STAT_DRAW_CALL(verticesCount * instanceCount, verticesCount * instanceCount / 3);
 }
@@ -1208,7 +1220,8 @@ void GPUContextVulkan::DrawInstanced(uint32 verticesCount, uint32 instanceCount,
 void GPUContextVulkan::DrawIndexedInstanced(uint32 indicesCount, uint32 instanceCount, int32 startInstance, int32 startVertex, int32 startIndex)
 {
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (!OnDrawCall())
+        return;
     vkCmdDrawIndexed(cmdBuffer->GetHandle(), indicesCount, instanceCount, startIndex, startVertex, startInstance);
     RENDER_STAT_DRAW_CALL(0, indicesCount / 3 * instanceCount);
 }
@@ -1219,7 +1232,8 @@ void GPUContextVulkan::DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 of
 
     auto bufferForArgsVK = (GPUBufferVulkan*)bufferForArgs;
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (!OnDrawCall())
+        return;
     vkCmdDrawIndirect(cmdBuffer->GetHandle(), bufferForArgsVK->GetHandle(), (VkDeviceSize)offsetForArgs, 1, sizeof(VkDrawIndirectCommand));
     RENDER_STAT_DRAW_CALL(0, 0);
 }
@@ -1230,7 +1244,8 @@ void GPUContextVulkan::DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, ui
 
     auto bufferForArgsVK = (GPUBufferVulkan*)bufferForArgs;
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (!OnDrawCall())
+        return;
     vkCmdDrawIndexedIndirect(cmdBuffer->GetHandle(), bufferForArgsVK->GetHandle(), (VkDeviceSize)offsetForArgs, 1, sizeof(VkDrawIndexedIndirectCommand));
     RENDER_STAT_DRAW_CALL(0, 0);
 }
@@ -1298,6 +1313,35 @@ void GPUContextVulkan::Flush()
     ASSERT(_cmdBufferManager->HasPendingActiveCmdBuffer() && _cmdBufferManager->GetActiveCmdBuffer()->GetState() == CmdBufferVulkan::State::IsInsideBegin);
 }
 
+bool GPUContextVulkan::UploadStaging(const void* data, uint32 size, CmdBufferVulkan* cmdBuffer, StagingManagerVulkan::UploadAllocation& result)
+{
+    RENDER_STAT_UPLOAD(size);
+
+    // Skip copy if data has been already written into the upload memory
+    if (_device->StagingManager.FindUpload(data, size, cmdBuffer, result))
+        return false;
+
+    if (_device->StagingManager.AllocateUpload(size, VULKAN_UPLOAD_ALIGNMENT, cmdBuffer, result))
+    {
+        // Count the uploads that don't fit into the full ring buffer separately from the ones done without the ring buffer
+        if (!_device->StagingManager.HasUploadRing())
+            RENDER_STAT_UPLOAD_FALLBACK();
+        else if (size <= VULKAN_UPLOAD_RING_BUFFER_FRAME_SIZE)
+            RENDER_STAT_UPLOAD_STALL();
+        return true;
+    }
+    Platform::MemoryCopy(result.CPUAddress, data, size);
+    return false;
+}
+
+void* GPUContextVulkan::AllocateUploadMemory(uint32 size)
+{
+    StagingManagerVulkan::UploadAllocation allocation;
+    if (_device->StagingManager.AllocateUpload(size, VULKAN_UPLOAD_ALIGNMENT, _cmdBufferManager->GetCmdBuffer(), allocation))
+        return nullptr;
+    return allocation.CPUAddress;
+}
+
 void GPUContextVulkan::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
 {
     ASSERT(data);
@@ -1315,14 +1359,24 @@ void GPUContextVulkan::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32
     vkCmdPipelineBarrier(cmdBuffer->GetHandle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrierBefore, 0, nullptr, 0, nullptr);
 
     // Use direct update for small buffers
-    if (size <= 16 * 1024)
+    StagingManagerVulkan::UploadAllocation upload;
+    if (size <= 16 * 1024 && !_device->StagingManager.FindUpload(data, size, cmdBuffer, upload))
     {
         //AddBufferBarrier(bufferVulkan, VK_ACCESS_TRANSFER_WRITE_BIT);
         //FlushBarriers();
 
+        RENDER_STAT_UPLOAD(size);
         size = Math::AlignUp<uint32>(size, 4);
         vkCmdUpdateBuffer(cmdBuffer->GetHandle(), bufferVulkan->GetHandle(), offset, size, data);
     }
+    else if (!UploadStaging(data, size, cmdBuffer, upload))
+    {
+        VkBufferCopy region;
+        region.size = size;
+        region.srcOffset = upload.Offset;
+        region.dstOffset = offset;
+        vkCmdCopyBuffer(cmdBuffer->GetHandle(), upload.Buffer, bufferVulkan->GetHandle(), 1, &region);
+    }
     else
     {
         auto staging = _device->StagingManager.AcquireBuffer(size, GPUResourceUsage::StagingUpload);
@@ -1380,14 +1434,23 @@ void GPUContextVulkan::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int3
     AddImageBarrier(textureVulkan, mipIndex, arrayIndex, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
     FlushBarriers();
 
-    auto buffer = _device->StagingManager.AcquireBuffer(slicePitch, GPUResourceUsage::StagingUpload);
-    buffer->SetData(data, slicePitch);
+    // Write data to the upload ring buffer (or use the pooled staging buffer as a fallback)
+    StagingManagerVulkan::UploadAllocation upload;
+    GPUBuffer* buffer = nullptr;
+    if (UploadStaging(data, slicePitch, cmdBuffer, upload))
+    {
+        buffer = _device->StagingManager.AcquireBuffer(slicePitch, GPUResourceUsage::StagingUpload);
+        buffer->SetData(data, slicePitch);
+        upload.Buffer = ((GPUBufferVulkan*)buffer)->GetHandle();
+        upload.Offset = 0;
+    }
 
     // Setup buffer copy region
     int32 mipWidth, mipHeight, mipDepth;
     texture->GetMipSize(mipIndex, mipWidth, mipHeight, mipDepth);
     VkBufferImageCopy bufferCopyRegion;
     Platform::MemoryClear(&bufferCopyRegion, sizeof(bufferCopyRegion));
+    bufferCopyRegion.bufferOffset = upload.Offset;
     bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     bufferCopyRegion.imageSubresource.mipLevel = mipIndex;
     bufferCopyRegion.imageSubresource.baseArrayLayer = arrayIndex;
@@ -1397,9 +1460,11 @@ void GPUContextVulkan::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int3
     bufferCopyRegion.imageExtent.depth = static_cast<uint32_t>(mipDepth);
 
     // Copy mip level from staging buffer
-    vkCmdCopyBufferToImage(cmdBuffer->GetHandle(), ((GPUBufferVulkan*)buffer)->GetHandle(), textureVulkan->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &bufferCopyRegion);
+    // Note: copies are recorded at once rather than batched per frame because the texture can be used by the following commands within the same command buffer (eg. streamed mip gets bound right after the upload task) so the copy has to stay ordered with the layout transitions
+    vkCmdCopyBufferToImage(cmdBuffer->GetHandle(), upload.Buffer, textureVulkan->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &bufferCopyRegion);
 
-    _device->StagingManager.ReleaseBuffer(cmdBuffer, buffer);
+    if (buffer)
+        _device->StagingManager.ReleaseBuffer(cmdBuffer, buffer);
 }
 
 void GPUContextVulkan::CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource)
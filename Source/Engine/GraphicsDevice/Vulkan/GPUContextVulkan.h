@@ -160,8 +160,9 @@ class GPUContextVulkan : public GPUContext
     void UpdateDescriptorSets(const struct SpirvShaderDescriptorInfo& descriptorInfo, class DescriptorSetWriterVulkan& dsWriter, bool& needsWrite);
     void UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineState);
     void UpdateDescriptorSets(ComputePipelineStateVulkan* pipelineState);
-    void BindPipeline();
-    void OnDrawCall();
+    bool BindPipeline();
+    bool OnDrawCall();
+    bool UploadStaging(const void* data, uint32 size, CmdBufferVulkan* cmdBuffer, StagingManagerVulkan::UploadAllocation& result);
 
 public:
 
@@ -208,6 +209,7 @@ class GPUContextVulkan : public GPUContext
     void ClearState() override;
     void FlushState() override;
     void Flush() override;
+    void* AllocateUploadMemory(uint32 size) override;
     void UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset) override;
     void CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset) override;
     void UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch) override;
@@ -902,6 +902,31 @@ StagingManagerVulkan::StagingManagerVulkan(GPUDeviceVulkan* device)
 {
 }
 
+bool StagingManagerVulkan::Init()
+{
+    // Setup ring buffer for uploads from all frames in flight
+    _ringSize = (uint64)VULKAN_UPLOAD_RING_BUFFER_FRAME_SIZE * (VULKAN_BACK_BUFFERS_COUNT + 1);
+    VkBufferCreateInfo bufferInfo;
+    RenderToolsVulkan::ZeroStruct(bufferInfo, VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO);
+    bufferInfo.size = _ringSize;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+    // Create buffer
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+    VkResult result = vmaCreateBuffer(_device->Allocator, &bufferInfo, &allocInfo, &_ringBuffer, &_ringAllocation, nullptr);
+    LOG_VULKAN_RESULT_WITH_RETURN(result);
+#if GPU_ENABLE_RESOURCE_NAMING
+    VK_SET_DEBUG_NAME(_device, _ringBuffer, VK_OBJECT_TYPE_BUFFER, "Upload Ring Buffer");
+#endif
+
+    // Map buffer (persistently)
+    result = vmaMapMemory(_device->Allocator, _ringAllocation, (void**)&_ringMapped);
+    LOG_VULKAN_RESULT_WITH_RETURN(result);
+
+    return false;
+}
+
 GPUBuffer* StagingManagerVulkan::AcquireBuffer(uint32 size, GPUResourceUsage usage)
 {
     // Try reuse free buffer
@@ -965,10 +990,78 @@ void StagingManagerVulkan::ReleaseBuffer(CmdBufferVulkan* cmdBuffer, GPUBuffer*&
     buffer = nullptr;
 }
 
+bool StagingManagerVulkan::AllocateUpload(uint32 size, uint32 alignment, CmdBufferVulkan* cmdBuffer, UploadAllocation& result)
+{
+    if (_ringMapped == nullptr || size > VULKAN_UPLOAD_RING_BUFFER_FRAME_SIZE)
+        return true;
+    ScopeLock lock(_locker);
+
+    // Align the allocation start (alignment doesn't need to be power of two, eg. for 12-byte texel formats)
+    uint64 head = _ringHead;
+    uint64 offset = head % _ringSize;
+    const uint64 alignedOffset = (offset + alignment - 1) / alignment * alignment;
+    head += alignedOffset - offset;
+    offset = alignedOffset;
+
+    // Skip the space left at the end of the buffer to keep the allocation continuous
+    if (offset + size > _ringSize)
+    {
+        head += _ringSize - offset;
+        offset = 0;
+    }
+
+    // Check if there is enough free space (memory from the frames that have been already executed by the GPU can be reused)
+    if (head + size - _ringTail > _ringSize)
+    {
+        while (_ringFrames.HasItems() && _ringFrames[0].FenceCounter < _ringFrames[0].CmdBuffer->GetFenceSignaledCounter())
+        {
+            _ringTail = _ringFrames[0].End;
+            _ringFrames.RemoveAtKeepOrder(0);
+        }
+        if (head + size - _ringTail > _ringSize)
+            return true;
+    }
+
+    _ringHead = head + size;
+    _ringCmdBuffer = cmdBuffer;
+    _ringFenceCounter = cmdBuffer->GetFenceSignaledCounter();
+    result.Buffer = _ringBuffer;
+    result.Offset = offset;
+    result.CPUAddress = _ringMapped + offset;
+    return false;
+}
+
+bool StagingManagerVulkan::FindUpload(const void* data, uint32 size, CmdBufferVulkan* cmdBuffer, UploadAllocation& result)
+{
+    if (_ringMapped == nullptr || (const byte*)data < _ringMapped || (const byte*)data + size > _ringMapped + _ringSize)
+        return false;
+    ScopeLock lock(_locker);
+
+    // Memory needs to be kept until the last command buffer that uses it gets executed (eg. after context flush since allocation)
+    _ringCmdBuffer = cmdBuffer;
+    _ringFenceCounter = cmdBuffer->GetFenceSignaledCounter();
+    result.Buffer = _ringBuffer;
+    result.Offset = (uint64)((const byte*)data - _ringMapped);
+    result.CPUAddress = (byte*)data;
+    return true;
+}
+
 void StagingManagerVulkan::ProcessPendingFree()
 {
     ScopeLock lock(_locker);
 
+    // End the ring buffer memory range used by the last frame
+    if (_ringCmdBuffer && (_ringFrames.IsEmpty() || _ringFrames.Last().End != _ringHead))
+        _ringFrames.Add({ _ringHead, _ringCmdBuffer, _ringFenceCounter });
+    _ringCmdBuffer = nullptr;
+
+    // Release ring buffer memory used by the frames that have been processed by the GPU
+    while (_ringFrames.HasItems() && _ringFrames[0].FenceCounter < _ringFrames[0].CmdBuffer->GetFenceSignaledCounter())
+    {
+        _ringTail = _ringFrames[0].End;
+        _ringFrames.RemoveAtKeepOrder(0);
+    }
+
     // Find staging buffers that has been processed by the GPU and can be reused
     for (int32 i = _pendingBuffers.Count() - 1; i >= 0; i--)
     {
@@ -1023,6 +1116,21 @@ void StagingManagerVulkan::Dispose()
     }
     _allBuffers.Resize(0);
     _pendingBuffers.Resize(0);
+
+    // Release ring buffer
+    if (_ringAllocation != VK_NULL_HANDLE)
+    {
+        if (_ringMapped)
+        {
+            vmaUnmapMemory(_device->Allocator, _ringAllocation);
+            _ringMapped = nullptr;
+        }
+        vmaDestroyBuffer(_device->Allocator, _ringBuffer, _ringAllocation);
+        _ringBuffer = VK_NULL_HANDLE;
+        _ringAllocation = VK_NULL_HANDLE;
+    }
+    _ringFrames.Resize(0);
+    _ringCmdBuffer = nullptr;
 }
 
 GPUDeviceVulkan::GPUDeviceVulkan(ShaderProfile shaderProfile, GPUAdapterVulkan* adapter)
@@ -1853,6 +1961,8 @@ bool GPUDeviceVulkan::Init()
     // Prepare stuff
     FenceManager.Init(this);
     UniformBufferUploader = New<UniformBufferUploaderVulkan>(this);
+    if (StagingManager.Init())
+        LOG(Warning, "Failed to create Vulkan upload ring buffer. Pooled staging buffers will be used instead.");
     DescriptorPoolsManager = New<DescriptorPoolsManagerVulkan>(this);
     MainContext = New<GPUContextVulkan>(this, GraphicsQueue);
     if (vkCreatePipelineCache)
@@ -1872,6 +1982,9 @@ bool GPUDeviceVulkan::Init()
         const VkResult result = vkCreatePipelineCache(Device, &pipelineCacheCreateInfo, nullptr, &PipelineCache);
         LOG_VULKAN_RESULT(result);
     }
+#if VULKAN_ASYNC_PIPELINES
+    AsyncPipelines = CommandLine::Options.AsyncPipelines.IsTrue();
+#endif
 #if VK_EXT_validation_cache
     if (OptionalDeviceExtensions.HasEXTValidationCache && vkCreateValidationCacheEXT && vkDestroyValidationCacheEXT)
     {
@@ -1946,6 +2059,7 @@ void GPUDeviceVulkan::Dispose()
 
     // Pre dispose
     preDispose();
+    LOG(Info, "Vulkan pipelines: {0} hits, {1} misses, {2} compiled in {3} ms, {4} skipped draws", PipelineStats.Hits, PipelineStats.Misses, PipelineStats.Compiled, PipelineStats.CompileTime / 1000, PipelineStats.SkippedDraws);
 
     // Clear stuff
     _framebuffers.ClearDelete();
@@ -23,6 +23,7 @@ class GPUTextureVulkan;
 class GPUBufferVulkan;
 class GPUTimerQueryVulkan;
 class RenderPassVulkan;
+class GPUPipelineStateVulkan;
 class FenceManagerVulkan;
 class GPUDeviceVulkan;
 class UniformBufferUploaderVulkan;
@@ -247,6 +248,21 @@ class RenderTargetLayoutVulkan
     {
         return Platform::MemoryCompare(this, &other, sizeof(RenderTargetLayoutVulkan)) == 0;
     }
+
+    /// <summary>
+    /// Checks if render passes created for both layouts are compatible (attachments formats and samples count match). Graphics pipeline can be used with any render pass compatible with the one it was created for.
+    /// </summary>
+    bool IsCompatible(const RenderTargetLayoutVulkan& other) const
+    {
+        if (RTsCount != other.RTsCount || MSAA != other.MSAA || DepthFormat != other.DepthFormat)
+            return false;
+        for (int32 i = 0; i < RTsCount; i++)
+        {
+            if (RTVsFormats[i] != other.RTVsFormats[i])
+                return false;
+        }
+        return true;
+    }
 };
 
 uint32 GetHash(const RenderTargetLayoutVulkan& key);
@@ -407,12 +423,39 @@ class HelperResourcesVulkan
 };
 
 /// <summary>
-/// Vulkan staging buffers manager.
+/// Vulkan staging buffers manager. Uses a persistently mapped ring buffer for the per-frame uploads and the pooled staging buffers for the large ones (or when ring buffer is full).
 /// </summary>
 class StagingManagerVulkan
 {
+public:
+
+    struct UploadAllocation
+    {
+        /// <summary>
+        /// The staging buffer.
+        /// </summary>
+        VkBuffer Buffer;
+
+        /// <summary>
+        /// The allocation offset from the staging buffer begin (in bytes).
+        /// </summary>
+        uint64 Offset;
+
+        /// <summary>
+        /// The CPU memory address to the mapped staging buffer data.
+        /// </summary>
+        byte* CPUAddress;
+    };
+
 private:
 
+    struct RingFrame
+    {
+        uint64 End;
+        CmdBufferVulkan* CmdBuffer;
+        uint64 FenceCounter;
+    };
+
     struct PendingEntry
     {
         GPUBuffer* Buffer;
@@ -431,6 +474,15 @@ class StagingManagerVulkan
     Array<GPUBuffer*> _allBuffers;
     Array<FreeEntry> _freeBuffers;
     Array<PendingEntry> _pendingBuffers;
+    VkBuffer _ringBuffer = VK_NULL_HANDLE;
+    VmaAllocation _ringAllocation = VK_NULL_HANDLE;
+    byte* _ringMapped = nullptr;
+    uint64 _ringSize = 0;
+    uint64 _ringHead = 0;
+    uint64 _ringTail = 0;
+    CmdBufferVulkan* _ringCmdBuffer = nullptr;
+    uint64 _ringFenceCounter = 0;
+    Array<RingFrame> _ringFrames;
 #if !BUILD_RELEASE
     uint64 _allBuffersTotalSize = 0;
     uint64 _allBuffersPeekSize = 0;
@@ -441,8 +493,38 @@ class StagingManagerVulkan
 public:
 
     StagingManagerVulkan(GPUDeviceVulkan* device);
+    bool Init();
     GPUBuffer* AcquireBuffer(uint32 size, GPUResourceUsage usage);
     void ReleaseBuffer(CmdBufferVulkan* cmdBuffer, GPUBuffer*& buffer);
+
+    /// <summary>
+    /// Returns true if the staging ring buffer has been created and can be used for the uploads.
+    /// </summary>
+    FORCE_INLINE bool HasUploadRing() const
+    {
+        return _ringMapped != nullptr;
+    }
+
+    /// <summary>
+    /// Allocates the upload memory from the staging ring buffer. Allocation is valid until the given command buffer gets executed by the GPU.
+    /// </summary>
+    /// <param name="size">The allocation size (in bytes).</param>
+    /// <param name="alignment">The allocation offset alignment (in bytes).</param>
+    /// <param name="cmdBuffer">The command buffer that will use the allocated memory.</param>
+    /// <param name="result">The result allocation.</param>
+    /// <returns>True if failed to allocate memory (ring buffer is full or allocation is too big), otherwise false.</returns>
+    bool AllocateUpload(uint32 size, uint32 alignment, CmdBufferVulkan* cmdBuffer, UploadAllocation& result);
+
+    /// <summary>
+    /// Checks if the given memory range is located within the staging ring buffer (eg. data was written directly into the memory returned by AllocateUpload within the current frame).
+    /// </summary>
+    /// <param name="data">The data pointer.</param>
+    /// <param name="size">The data size (in bytes).</param>
+    /// <param name="cmdBuffer">The command buffer that will use the memory.</param>
+    /// <param name="result">The result allocation that contains the data.</param>
+    /// <returns>True if the data is located within the staging ring buffer, otherwise false.</returns>
+    bool FindUpload(const void* data, uint32 size, CmdBufferVulkan* cmdBuffer, UploadAllocation& result);
+
     void ProcessPendingFree();
     void Dispose();
 };
@@ -455,6 +537,7 @@ class GPUDeviceVulkan : public GPUDevice
     friend GPUContextVulkan;
     friend GPUSwapChainVulkan;
     friend FenceManagerVulkan;
+    friend GPUPipelineStateVulkan;
 
 private:
 
@@ -588,6 +671,28 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     VkPipelineCache PipelineCache = VK_NULL_HANDLE;
 
+    /// <summary>
+    /// The graphics pipelines usage statistics.
+    /// </summary>
+    struct PipelineStatsData
+    {
+        // The amount of pipelines found in cache.
+        int64 Hits = 0;
+        // The amount of pipelines not found in cache (compiled in place or in the background).
+        int64 Misses = 0;
+        // The amount of compiled pipelines.
+        int64 Compiled = 0;
+        // The total time spent on pipelines compilation (in microseconds, including the background compilation).
+        int64 CompileTime = 0;
+        // The amount of draws skipped because of the pipeline being compiled in the background.
+        int64 SkippedDraws = 0;
+    } PipelineStats;
+
+    /// <summary>
+    /// If true, the missing graphics pipelines are compiled in the background and draws that use them are skipped until they are ready. Otherwise, the missing pipeline is compiled in place (or waited for if already compiling in the background).
+    /// </summary>
+    bool AsyncPipelines = false;
+
 #if VK_EXT_validation_cache
 
     /// <summary>
@@ -5,9 +5,75 @@
 #include "GPUPipelineStateVulkan.h"
 #include "RenderToolsVulkan.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/ThreadPoolTask.h"
 #include "DescriptorSetVulkan.h"
 #include "GPUShaderProgramVulkan.h"
 
+#if VULKAN_ASYNC_PIPELINES
+
+struct GPUPipelineStateVulkan::PendingPipeline
+{
+    RenderPassVulkan* RenderPass;
+    Task* volatile CompileTask;
+    VkPipeline Pipeline = VK_NULL_HANDLE;
+    int64 IsDone = 0;
+
+    // Copy of the state description (pipeline-specific parts are modified per render pass)
+    VkGraphicsPipelineCreateInfo Desc;
+    VkPipelineMultisampleStateCreateInfo DescMultisample;
+    VkPipelineColorBlendStateCreateInfo DescColorBlend;
+
+    bool IsReady()
+    {
+        return Platform::AtomicRead(&IsDone) != 0;
+    }
+
+    VkPipeline WaitForPipeline()
+    {
+        if (!IsReady())
+        {
+            // Task is cleared when it completes (it's being deleted by the tasks system after a while)
+            Task* task = (Task*)Platform::AtomicRead((intptr volatile*)&CompileTask);
+            if (task)
+            {
+                PROFILE_CPU_NAMED("Wait For Pipeline");
+                task->Wait();
+            }
+        }
+        return IsReady() ? Pipeline : VK_NULL_HANDLE;
+    }
+};
+
+class PipelineCompileTaskVulkan : public ThreadPoolTask
+{
+private:
+
+    const GPUPipelineStateVulkan* _state;
+    GPUPipelineStateVulkan::PendingPipeline* _pending;
+
+public:
+
+    PipelineCompileTaskVulkan(const GPUPipelineStateVulkan* state, GPUPipelineStateVulkan::PendingPipeline* pending)
+        : _state(state)
+        , _pending(pending)
+    {
+    }
+
+protected:
+
+    // [ThreadPoolTask]
+    bool Run() override
+    {
+        // Pending pipeline is owned by the state which waits for this task before releasing it
+        _pending->Pipeline = _state->CreatePipeline(_pending->Desc);
+        Platform::AtomicStore(&_pending->IsDone, 1);
+        Platform::AtomicStore((intptr volatile*)&_pending->CompileTask, 0);
+        return false;
+    }
+};
+
+#endif
+
 GPUShaderProgramCSVulkan::~GPUShaderProgramCSVulkan()
 {
     if (_pipelineState)
@@ -131,26 +197,51 @@ PipelineLayoutVulkan* GPUPipelineStateVulkan::GetLayout()
 VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
 {
     ASSERT(renderPass);
+    auto& stats = _device->PipelineStats;
 
     // Try reuse cached version
     VkPipeline pipeline = VK_NULL_HANDLE;
     if (_pipelines.TryGet(renderPass, pipeline))
     {
-#if BUILD_DEBUG
-        // Verify
-        RenderPassVulkan* refKey = nullptr;
-        _pipelines.KeyOf(pipeline, &refKey);
-        ASSERT(refKey == renderPass);
-#endif
+        stats.Hits++;
         return pipeline;
     }
 
-    PROFILE_CPU_NAMED("Create Pipeline");
+    // Try reuse pipeline created for a compatible render pass (eg. the same formats but different size of the render targets)
+    for (auto i = _pipelines.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Key->Layout.IsCompatible(renderPass->Layout))
+        {
+            pipeline = i->Value;
+            _pipelines.Add(renderPass, pipeline);
+            stats.Hits++;
+            return pipeline;
+        }
+    }
 
-    // Update description to match the pipeline
-    _descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
-    _descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
-    _desc.renderPass = renderPass->GetHandle();
+#if VULKAN_ASYNC_PIPELINES
+    // Check if pipeline is being compiled in the background
+    for (int32 i = 0; i < _pendingPipelines.Count(); i++)
+    {
+        PendingPipeline* pending = _pendingPipelines[i];
+        if (!pending->RenderPass->Layout.IsCompatible(renderPass->Layout))
+            continue;
+        if (!pending->IsReady() && _device->AsyncPipelines)
+        {
+            stats.SkippedDraws++;
+            return VK_NULL_HANDLE;
+        }
+        pipeline = pending->WaitForPipeline();
+        _pendingPipelines.RemoveAtKeepOrder(i);
+        Delete(pending);
+        stats.Hits++;
+        if (pipeline != VK_NULL_HANDLE)
+            _pipelines.Add(renderPass, pipeline);
+        return pipeline;
+    }
+#endif
+
+    stats.Misses++;
 
     // Check if has missing layout
     if (_desc.layout == VK_NULL_HANDLE)
@@ -158,8 +249,40 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
         _desc.layout = GetLayout()->GetHandle();
     }
 
+#if VULKAN_ASYNC_PIPELINES
+    if (_device->AsyncPipelines)
+    {
+        // Compile pipeline in the background and skip the draw
+        CompileAsync(renderPass);
+        stats.SkippedDraws++;
+        return VK_NULL_HANDLE;
+    }
+#endif
+
+    // Update description to match the pipeline
+    _descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
+    _descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
+    _desc.renderPass = renderPass->GetHandle();
+
     // Create object
-    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &_desc, nullptr, &pipeline);
+    pipeline = CreatePipeline(_desc);
+    if (pipeline == VK_NULL_HANDLE)
+        return VK_NULL_HANDLE;
+
+    // Cache it
+    _pipelines.Add(renderPass, pipeline);
+
+    return pipeline;
+}
+
+VkPipeline GPUPipelineStateVulkan::CreatePipeline(const VkGraphicsPipelineCreateInfo& desc) const
+{
+    PROFILE_CPU_NAMED("Create Pipeline");
+    const double startTime = Platform::GetTimeSeconds();
+
+    // Create object (pipeline cache is internally synchronized so it can be used from many threads)
+    VkPipeline pipeline;
+    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &desc, nullptr, &pipeline);
     LOG_VULKAN_RESULT(result);
     if (result != VK_SUCCESS)
     {
@@ -171,12 +294,34 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
         return VK_NULL_HANDLE;
     }
 
-    // Cache it
-    _pipelines.Add(renderPass, pipeline);
-
+    auto& stats = _device->PipelineStats;
+    Platform::InterlockedIncrement(&stats.Compiled);
+    Platform::InterlockedAdd(&stats.CompileTime, (int64)((Platform::GetTimeSeconds() - startTime) * 1000000.0));
     return pipeline;
 }
 
+#if VULKAN_ASYNC_PIPELINES
+
+void GPUPipelineStateVulkan::CompileAsync(RenderPassVulkan* renderPass)
+{
+    auto pending = New<PendingPipeline>();
+    pending->RenderPass = renderPass;
+    pending->Desc = _desc;
+    pending->DescMultisample = _descMultisample;
+    pending->DescColorBlend = _descColorBlend;
+    pending->DescColorBlend.attachmentCount = renderPass->Layout.RTsCount;
+    pending->DescMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
+    pending->Desc.pMultisampleState = &pending->DescMultisample;
+    pending->Desc.pColorBlendState = &pending->DescColorBlend;
+    pending->Desc.renderPass = renderPass->GetHandle();
+    _pendingPipelines.Add(pending);
+    auto task = New<PipelineCompileTaskVulkan>(this, pending);
+    pending->CompileTask = task;
+    task->Start();
+}
+
+#endif
+
 void GPUPipelineStateVulkan::OnReleaseGPU()
 {
     DSWriteContainer.Release();
@@ -184,8 +329,23 @@ void GPUPipelineStateVulkan::OnReleaseGPU()
     DescriptorSetsLayout = nullptr;
     DescriptorSetHandles.Resize(0);
     DynamicOffsets.Resize(0);
+#if VULKAN_ASYNC_PIPELINES
+    for (PendingPipeline* pending : _pendingPipelines)
+    {
+        const VkPipeline pipeline = pending->WaitForPipeline();
+        if (pipeline != VK_NULL_HANDLE)
+            _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, pipeline);
+        Delete(pending);
+    }
+    _pendingPipelines.Clear();
+#endif
+    Array<VkPipeline, InlinedAllocation<16>> released;
     for (auto i = _pipelines.Begin(); i.IsNotEnd(); ++i)
     {
+        // Skip pipelines shared by the compatible render passes
+        if (released.Contains(i->Value))
+            continue;
+        released.Add(i->Value);
         _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, i->Value);
     }
     _layout = nullptr;
@@ -388,4 +548,34 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
     return GPUPipelineState::Init(desc);
 }
 
+void GPUPipelineStateVulkan::Prewarm()
+{
+#if VULKAN_ASYNC_PIPELINES
+    if (!IsValid())
+        return;
+    PROFILE_CPU();
+    if (_desc.layout == VK_NULL_HANDLE)
+    {
+        _desc.layout = GetLayout()->GetHandle();
+    }
+
+    // Compile pipeline in the background for all the render passes used so far that can be used with this state
+    const bool usesDepth = _descDepthStencil.depthTestEnable || _descDepthStencil.depthWriteEnable;
+    for (auto i = _device->_renderPasses.Begin(); i.IsNotEnd(); ++i)
+    {
+        RenderPassVulkan* renderPass = i->Value;
+        const RenderTargetLayoutVulkan& layout = renderPass->Layout;
+        if (layout.BlendEnable != BlendEnable || (usesDepth && layout.DepthFormat == PixelFormat::Unknown))
+            continue;
+        bool isCompiled = false;
+        for (auto j = _pipelines.Begin(); j.IsNotEnd() && !isCompiled; ++j)
+            isCompiled = j->Key->Layout.IsCompatible(layout);
+        for (int32 j = 0; j < _pendingPipelines.Count() && !isCompiled; j++)
+            isCompiled = _pendingPipelines[j]->RenderPass->Layout.IsCompatible(layout);
+        if (!isCompiled)
+            CompileAsync(renderPass);
+    }
+#endif
+}
+
 #endif
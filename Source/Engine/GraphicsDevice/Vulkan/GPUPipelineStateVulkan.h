@@ -103,9 +103,16 @@ class ComputePipelineStateVulkan
 /// </summary>
 class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
 {
+    friend class PipelineCompileTaskVulkan;
+
 private:
 
+    struct PendingPipeline;
+
     Dictionary<RenderPassVulkan*, VkPipeline> _pipelines;
+#if VULKAN_ASYNC_PIPELINES
+    Array<PendingPipeline*> _pendingPipelines;
+#endif
     VkGraphicsPipelineCreateInfo _desc;
     VkPipelineShaderStageCreateInfo _shaderStages[ShaderStage_Count - 1];
     VkPipelineInputAssemblyStateCreateInfo _descInputAssembly;
@@ -210,15 +217,24 @@ class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
     /// <summary>
     /// Gets the Vulkan graphics pipeline object for the given rendering state. Uses depth buffer and render targets formats and multi-sample levels to setup a proper PSO. Uses caching.
     /// </summary>
+    /// <remarks>Returns null if pipeline is being compiled in the background (see GPUDeviceVulkan::AsyncPipelines) and the draw should be skipped.</remarks>
     /// <param name="renderPass">The render pass.</param>
     /// <returns>Vulkan graphics pipeline object.</returns>
     VkPipeline GetState(RenderPassVulkan* renderPass);
 
+private:
+
+    VkPipeline CreatePipeline(const VkGraphicsPipelineCreateInfo& desc) const;
+#if VULKAN_ASYNC_PIPELINES
+    void CompileAsync(RenderPassVulkan* renderPass);
+#endif
+
 public:
 
     // [GPUPipelineState]
     bool IsValid() const final override;
     bool Init(const Description& desc) final override;
+    void Prewarm() override;
 
 protected:
 
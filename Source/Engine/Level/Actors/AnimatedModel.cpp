@@ -589,13 +589,14 @@ void AnimatedModel::OnAnimationUpdated_Async()
         const int32 bonesCount = skeleton.Bones.Count();
         Matrix3x4* output = (Matrix3x4*)_skinningData.Data.Get();
         ASSERT(_skinningData.Data.Count() == bonesCount * sizeof(Matrix3x4));
+        bool poseChanged = false;
         for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
         {
             auto& bone = skeleton.Bones[boneIndex];
             Matrix matrix = bone.OffsetMatrix * GraphInstance.NodesPose[bone.NodeIndex];
-            output[boneIndex].SetMatrixTranspose(matrix);
+            poseChanged |= SkinnedMeshDrawData::SetBone(output[boneIndex], matrix);
         }
-        _skinningData.OnDataChanged(!PerBoneMotionBlur);
+        _skinningData.OnDataChanged(!PerBoneMotionBlur, poseChanged);
     }
 
     UpdateBounds();
@@ -81,6 +81,9 @@ void Decal::Draw(RenderContext& renderContext)
         if (Math::Square(DrawMinScreenSize * 0.5f) > screenRadiusSquared)
             return;
 
+        // Decals don't compute the on-screen UVs density so don't limit the textures
+        Material->Params.RequestTexturesFullQuality();
+
         renderContext.List->Decals.Add(this);
     }
 }
@@ -41,6 +41,19 @@ void Skybox::Draw(RenderContext& renderContext)
     }
     if (isReady)
     {
+        // Sky covers the whole view so don't limit the textures quality
+        if (CustomMaterial)
+        {
+            CustomMaterial->Params.RequestTexturesFullQuality();
+        }
+        else
+        {
+            if (CubeTexture && CubeTexture->IsLoaded())
+                CubeTexture->StreamingTexture()->RequestMip(0);
+            if (PanoramicTexture && PanoramicTexture->IsLoaded())
+                PanoramicTexture->StreamingTexture()->RequestMip(0);
+        }
+
         renderContext.List->Sky = this;
     }
 }
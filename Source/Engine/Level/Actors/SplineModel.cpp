@@ -396,6 +396,7 @@ void SplineModel::Draw(RenderContext& renderContext)
                 continue;
         }
         lodIndex += _lodBias + renderContext.View.ModelLODBias;
+        model->RequestLOD(lodIndex);
         lodIndex = model->ClampLODIndex(lodIndex);
 
         // Draw
@@ -427,6 +428,10 @@ void SplineModel::Draw(RenderContext& renderContext)
             if (!material || !material->IsDeformable())
                 continue;
 
+            // Spline deformation stretches the mesh so its UVs density doesn't match and the textures quality is not limited
+            if (drawModes & (DrawPass::GBuffer | DrawPass::Forward))
+                material->Params.RequestTexturesFullQuality();
+
             // Submit draw call
             mesh->GetDrawCallGeometry(drawCall);
             drawCall.Material = material;
@@ -33,10 +33,10 @@
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Prefabs/Prefab.h"
+#include "Engine/Engine/CommandLine.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #include "Engine/Platform/MessageBox.h"
-#include "Engine/Engine/CommandLine.h"
 #include "Engine/Serialization/JsonSerializer.h"
 #include "Editor/Scripting/ScriptsBuilder.h"
 #endif
@@ -999,6 +999,14 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
         return false;
     }
 
+    // Record the assets used by the scene (the scene asset id matches the scene object id)
+    if (CommandLine::Options.LoadTrace.IsTrue())
+    {
+        Content::BeginLoadTrace(sceneId);
+        Content::TraceLoad(sceneId, -1);
+        Content::TraceLoad(sceneId, 0);
+    }
+
     // Create scene actor
     // Note: the first object in the scene file data is a Scene Actor
     auto scene = New<Scene>(ScriptingObjectSpawnParams(sceneId, Scene::TypeInitializer));
@@ -6,17 +6,25 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Actor.h"
-#include "Engine/Threading/Threading.h"
-#if USE_EDITOR
+#include "Engine/Content/Content.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/Scripting.h"
-#endif
+#include "Engine/Threading/Threading.h"
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
+namespace
+{
+    // Incremented on every prefab load/unload to invalidate templates that might use the data of the nested prefabs
+    int64 TemplatesVersion = 0;
+}
+
 Prefab::Prefab(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
     , _isCreatingDefaultInstance(false)
     , _defaultInstance(nullptr)
+    , _template(nullptr)
+    , _templateVersion(-1)
     , ObjectsCount(0)
 {
 }
@@ -70,9 +78,67 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
     return result;
 }
 
+const PrefabTemplate* Prefab::GetTemplate()
+{
+    ScopeLock lock(Locker);
+
+    // Reuse cached template if still valid
+    const int64 version = Platform::AtomicRead(&TemplatesVersion);
+    if (_templateVersion == version)
+        return _template && _template->Objects.HasItems() ? _template : nullptr;
+    _templateVersion = version;
+    if (!IsLoaded())
+        return nullptr;
+    PROFILE_CPU_NAMED("Prefab.BuildTemplate");
+    if (!_template)
+        _template = New<PrefabTemplate>();
+    auto& objects = _template->Objects;
+    objects.Clear();
+    objects.Resize(ObjectsCount);
+    const auto& data = *Data;
+    for (int32 i = 0; i < ObjectsCount; i++)
+    {
+        auto& obj = objects[i];
+        obj.NestedObjectIds.Clear();
+        obj.Data.Clear();
+
+        // Gather data from the nested prefabs
+        const ISerializable::DeserializeStream* stream = &data[i];
+        Guid prefabObjectId;
+        obj.Data.Add(stream);
+        while (JsonTools::GetGuidIfValid(prefabObjectId, *stream, "PrefabObjectID"))
+        {
+            const Guid prefabId = JsonTools::GetGuid(*stream, "PrefabID");
+            const auto prefab = prefabId.IsValid() ? Content::LoadAsync<Prefab>(prefabId) : nullptr;
+            if (prefab == nullptr || prefab->WaitForLoaded() || !prefab->ObjectsDataCache.TryGet(prefabObjectId, stream))
+            {
+                // Missing data is reported when spawning from the json data
+                objects.Clear();
+                return nullptr;
+            }
+            obj.NestedObjectIds.Add(prefabObjectId);
+            obj.Data.Add(stream);
+        }
+        obj.Data.Reverse();
+
+        // Resolve object type
+        const auto typeNameMember = stream->FindMember("TypeName");
+        if (typeNameMember != stream->MemberEnd() && typeNameMember->value.IsString())
+            obj.Type = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+        if (!obj.Type)
+        {
+            objects.Clear();
+            return nullptr;
+        }
+    }
+
+    return _template;
+}
+
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
+    Platform::InterlockedIncrement(&TemplatesVersion);
     ObjectsCache.Clear();
     if (_defaultInstance)
     {
@@ -87,6 +153,7 @@ Asset::LoadResult Prefab::loadAsset()
     const auto result = JsonAssetBase::loadAsset();
     if (result != LoadResult::Ok)
         return result;
+    Platform::InterlockedIncrement(&TemplatesVersion);
 
     // Validate data schema
     if (!Data->IsArray())
@@ -166,6 +233,12 @@ void Prefab::unload(bool isReloading)
     ObjectsDataCache.SetCapacity(0);
     ObjectsCache.Clear();
     ObjectsCache.SetCapacity(0);
+    Platform::InterlockedIncrement(&TemplatesVersion);
+    if (_template)
+    {
+        Delete(_template);
+        _template = nullptr;
+    }
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
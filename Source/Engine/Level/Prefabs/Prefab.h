@@ -5,10 +5,32 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Scripting/ScriptingType.h"
 
 class Actor;
 class SceneObject;
 
+/// <summary>
+/// The compiled prefab data used to speed up the prefab spawning. Contains the resolved objects types and the nested prefabs data to skip the json lookups and types search on every spawn.
+/// </summary>
+struct FLAXENGINE_API PrefabTemplate
+{
+    struct Object
+    {
+        // The object type.
+        ScriptingTypeHandle Type;
+        // The ids of the nested prefabs objects that map to this object instance (used to resolve references inside the nested prefabs).
+        Array<Guid, InlinedAllocation<4>> NestedObjectIds;
+        // The object data to deserialize in order (nested prefabs data first, then the overrides of this prefab).
+        Array<const ISerializable::DeserializeStream*, InlinedAllocation<4>> Data;
+    };
+
+    /// <summary>
+    /// The prefab objects (matches the order of the prefab data).
+    /// </summary>
+    Array<Object> Objects;
+};
+
 /// <summary>
 /// Json asset that stores the collection of scene objects including actors and scripts. In general it can serve as any grouping of scene objects (for example a level) or be used as a form of a template instantiated and reused throughout the scene.
 /// </summary>
@@ -19,6 +41,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
 private:
     bool _isCreatingDefaultInstance;
     Actor* _defaultInstance;
+    PrefabTemplate* _template;
+    int64 _templateVersion;
 
 public:
     /// <summary>
@@ -69,6 +93,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Gets the compiled prefab template used for the faster spawning. Builds it on the first use, rebuilds it after the prefab (or any nested prefab) reload.
+    /// </summary>
+    /// <returns>The prefab template or null if prefab cannot be compiled (eg. uses the deprecated data format or references missing types) and needs to be spawned from the json data.</returns>
+    const PrefabTemplate* GetTemplate();
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -82,15 +82,27 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Vector3& position, const
 
 Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform)
 {
-    auto instance = SpawnPrefab(prefab);
-    if (instance)
-    {
-        instance->SetTransform(transform);
-    }
-    return instance;
+    Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes[0] : nullptr;
+    return SpawnPrefabInternal(prefab, parent, nullptr, false, &transform);
 }
 
 Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*>* objectsCache, bool withSynchronization)
+{
+    return SpawnPrefabInternal(prefab, parent, objectsCache, withSynchronization, nullptr);
+}
+
+Array<Actor*> PrefabManager::SpawnPrefab(Prefab* prefab, const Span<Transform>& transforms)
+{
+    PROFILE_CPU_NAMED("Prefab.SpawnBatch");
+    Array<Actor*> result;
+    result.Resize(transforms.Length());
+    Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes[0] : nullptr;
+    for (int32 i = 0; i < transforms.Length(); i++)
+        result[i] = SpawnPrefabInternal(prefab, parent, nullptr, false, &transforms[i]);
+    return result;
+}
+
+Actor* PrefabManager::SpawnPrefabInternal(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*>* objectsCache, bool withSynchronization, const Transform* transform)
 {
     PROFILE_CPU_NAMED("Prefab.Spawn");
 
@@ -133,37 +145,74 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     }
     auto& data = *prefab->Data;
     SceneObjectsFactory::Context context(modifier.Value);
-
-    // Deserialize prefab objects
     auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
     Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-    for (int32 i = 0; i < objectsCount; i++)
+
+    // Use compiled prefab template if possible (prefab synchronization needs to process the json data)
+    const PrefabTemplate* prefabTemplate = withSynchronization ? nullptr : prefab->GetTemplate();
+    if (prefabTemplate)
     {
-        auto& stream = data[i];
-        auto obj = SceneObjectsFactory::Spawn(context, stream);
-        sceneObjects->At(i) = obj;
-        if (obj)
-            obj->RegisterObject();
-        else
-            SceneObjectsFactory::HandleObjectDeserializationError(stream);
+        // Spawn prefab objects
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            const auto& e = prefabTemplate->Objects[i];
+            const Guid id = modifier->IdsMapping[prefab->ObjectsIds[i]];
+            for (const Guid& nestedObjectId : e.NestedObjectIds)
+                modifier->IdsMapping[nestedObjectId] = id;
+            const ScriptingObjectSpawnParams params(id, e.Type);
+            auto obj = (SceneObject*)e.Type.GetType().Script.Spawn(params);
+            sceneObjects->At(i) = obj;
+            if (obj)
+                obj->RegisterObject();
+            else
+                LOG(Warning, "Failed to spawn object of type {0}.", e.Type.ToString(true));
+        }
+
+        // Deserialize prefab objects
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            SceneObject* obj = sceneObjects->At(i);
+            if (!obj)
+                continue;
+            for (auto stream : prefabTemplate->Objects[i].Data)
+                obj->Deserialize(*(ISerializable::DeserializeStream*)stream, modifier.Value);
+        }
+        Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
     }
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
-    if (withSynchronization)
+    else
     {
-        // Synchronize new prefab instances (prefab may have new objects added so deserialized instances need to synchronize with it)
-        // TODO: resave and force sync prefabs during game cooking so this step could be skipped in game
-        SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
-        SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
-        Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        // Deserialize prefab objects
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            auto& stream = data[i];
+            auto obj = SceneObjectsFactory::Spawn(context, stream);
+            sceneObjects->At(i) = obj;
+            if (obj)
+                obj->RegisterObject();
+            else
+                SceneObjectsFactory::HandleObjectDeserializationError(stream);
+        }
     }
-    for (int32 i = 0; i < objectsCount; i++)
+    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
+    if (!prefabTemplate)
     {
-        auto& stream = data[i];
-        SceneObject* obj = sceneObjects->At(i);
-        if (obj)
-            SceneObjectsFactory::Deserialize(context, obj, stream);
+        if (withSynchronization)
+        {
+            // Synchronize new prefab instances (prefab may have new objects added so deserialized instances need to synchronize with it)
+            // TODO: resave and force sync prefabs during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
+            SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        }
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            auto& stream = data[i];
+            SceneObject* obj = sceneObjects->At(i);
+            if (obj)
+                SceneObjectsFactory::Deserialize(context, obj, stream);
+        }
+        Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
     }
-    Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
 
     // Assume that prefab has always only one root actor that is serialized first
     if (sceneObjects.Value->IsEmpty())
@@ -179,7 +228,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     }
 
     // Synchronize prefab instances (prefab may have new objects added or some removed so deserialized instances need to synchronize with it)
-    if (withSynchronization)
+    if (withSynchronization && !prefabTemplate)
     {
         // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
         SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
@@ -251,12 +300,11 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     // Link objects to prefab (only deserialized from prefab data)
     for (int32 i = 0; i < objectsCount; i++)
     {
-        auto& stream = data[i];
         SceneObject* obj = sceneObjects->At(i);
         if (!obj)
             continue;
 
-        const auto prefabObjectId = JsonTools::GetGuid(stream, "ID");
+        const Guid prefabObjectId = prefab->ObjectsIds[i];
 
         if (objectsCache)
             objectsCache->Add(prefabObjectId, obj);
@@ -264,7 +312,10 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     }
 
     // Update transformations
-    root->OnTransformChanged();
+    if (transform)
+        root->SetTransform(*transform);
+    else
+        root->OnTransformChanged();
 
     // Spawn if need to
     if (parent && parent->IsDuringPlay())
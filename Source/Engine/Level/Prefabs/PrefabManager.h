@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
 
 class Prefab;
 class Actor;
@@ -64,6 +66,14 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(PrefabManager);
     /// <returns>The created actor (root) or null if failed.</returns>
     API_FUNCTION() static Actor* SpawnPrefab(Prefab* prefab, const Transform& transform);
 
+    /// <summary>
+    /// Spawns the multiple instances of the prefab objects (eg. projectiles or pickups). Prefab will be spawned to the first loaded scene. Instances are placed before the BeginPlay so it's faster than moving them after the spawn.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transforms">The spawn transformations in the world space (one per instance).</param>
+    /// <returns>The created actors (roots, matches the transforms order). Elements are null if spawning failed.</returns>
+    API_FUNCTION() static Array<Actor*> SpawnPrefab(Prefab* prefab, const Span<Transform>& transforms);
+
     /// <summary>
     /// Spawns the instance of the prefab objects. If parent actor is specified then created actors are fully initialized (OnLoad event and BeginPlay is called if parent actor is already during gameplay).
     /// </summary>
@@ -136,4 +146,7 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(PrefabManager);
     API_FUNCTION() static bool ApplyAll(Actor* instance);
 
 #endif
+
+private:
+    static Actor* SpawnPrefabInternal(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*, HeapAllocation>* objectsCache, bool withSynchronization, const Transform* transform);
 };
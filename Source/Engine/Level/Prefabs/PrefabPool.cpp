@@ -0,0 +1,335 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "PrefabPool.h"
+#include "Prefab.h"
+#include "PrefabManager.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Cache.h"
+#include "Engine/Core/Collections/CollectionPoolCache.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Debug/Exceptions/ArgumentNullException.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/ActorsCache.h"
+#include "Engine/Scripting/Script.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Scripting/ScriptingObjectReference.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace
+{
+    class Pool
+    {
+    public:
+        AssetReference<Prefab> PrefabAsset;
+        int32 Capacity;
+        PrefabPoolStats Stats;
+        Array<ScriptingObjectReference<Actor>> Instances;
+        HashSet<Guid> Parked;
+        Dictionary<Guid, int32> ObjectIndices;
+
+        void OnReloading(Asset* asset)
+        {
+            // Parked instances use the old prefab data
+            Clear();
+            ObjectIndices.Clear();
+        }
+
+        void OnUnloaded(Asset* asset);
+
+        void Clear()
+        {
+            for (auto& instance : Instances)
+            {
+                if (instance)
+                    instance->DeleteObject();
+            }
+            Instances.Clear();
+            Parked.Clear();
+            Stats.Pooled = 0;
+        }
+    };
+
+    Dictionary<Guid, Pool*> Pools;
+
+    void Pool::OnUnloaded(Asset* asset)
+    {
+        // Remove the pool of the unloaded prefab
+        Clear();
+        asset->OnReloading.Unbind<Pool, &Pool::OnReloading>(this);
+        asset->OnUnloaded.Unbind<Pool, &Pool::OnUnloaded>(this);
+        Pools.Remove(asset->GetID());
+        Delete(this);
+    }
+
+    Pool* GetPool(Prefab* prefab)
+    {
+        Pool* pool;
+        if (!Pools.TryGet(prefab->GetID(), pool))
+        {
+            pool = New<Pool>();
+            pool->PrefabAsset = prefab;
+            pool->Capacity = PrefabPool::DefaultCapacity;
+            prefab->OnReloading.Bind<Pool, &Pool::OnReloading>(pool);
+            prefab->OnUnloaded.Bind<Pool, &Pool::OnUnloaded>(pool);
+            Pools.Add(prefab->GetID(), pool);
+        }
+        return pool;
+    }
+
+    Actor* GetParent(Actor* parent)
+    {
+        if (parent == nullptr && Level::Scenes.HasItems())
+            parent = Level::Scenes[0];
+        return parent;
+    }
+
+    void GatherObjects(Actor* actor, Array<SceneObject*>& objects)
+    {
+        objects.Add(actor);
+        for (Script* script : actor->Scripts)
+            objects.Add(script);
+        for (Actor* child : actor->Children)
+            GatherObjects(child, objects);
+    }
+
+    bool ResetInstance(Pool* pool, Actor* instance)
+    {
+        PROFILE_CPU_NAMED("PrefabPool.Reset");
+        Prefab* prefab = pool->PrefabAsset.Get();
+        const PrefabTemplate* prefabTemplate = prefab->GetTemplate();
+        if (!prefabTemplate)
+        {
+            LOG(Error, "Failed to reset the pooled instance {0}. Missing prefab {1} data.", instance->ToString(), prefab->ToString());
+            return true;
+        }
+        if (pool->ObjectIndices.IsEmpty())
+        {
+            for (int32 i = 0; i < prefab->ObjectsIds.Count(); i++)
+                pool->ObjectIndices.Add(prefab->ObjectsIds[i], i);
+        }
+
+        // Map the prefab objects to the existing instance objects
+        const Guid prefabId = prefab->GetID();
+        CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache objects = ActorsCache::SceneObjectsListCache.Get();
+        GatherObjects(instance, *objects.Value);
+        CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+        for (SceneObject* obj : *objects.Value)
+        {
+            int32 index;
+            if (obj->GetPrefabID() != prefabId || !pool->ObjectIndices.TryGet(obj->GetPrefabObjectID(), index))
+                continue;
+            modifier->IdsMapping[obj->GetPrefabObjectID()] = obj->GetID();
+            for (const Guid& nestedObjectId : prefabTemplate->Objects[index].NestedObjectIds)
+                modifier->IdsMapping[nestedObjectId] = obj->GetID();
+        }
+
+        // Restore the prefab state
+        auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
+        Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        for (SceneObject* obj : *objects.Value)
+        {
+            int32 index;
+            if (obj->GetPrefabID() != prefabId || !pool->ObjectIndices.TryGet(obj->GetPrefabObjectID(), index))
+                continue;
+            Actor* actor = ScriptingObject::Cast<Actor>(obj);
+            const bool wasActive = actor && actor->GetIsActive();
+            for (auto stream : prefabTemplate->Objects[index].Data)
+                obj->Deserialize(*(ISerializable::DeserializeStream*)stream, modifier.Value);
+
+            // Nested prefabs data overrides the prefab link so link objects again (the same way as PrefabManager does when spawning)
+            obj->LinkPrefab(prefabId, prefab->ObjectsIds[index]);
+
+            // Deserialization doesn't send active state change events so update the hierarchy state properly
+            if (actor && actor != instance && actor->GetIsActive() != wasActive)
+                actor->OnActiveChanged();
+        }
+        Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
+
+        // Root stays parked until it gets activated by the spawn
+        instance->SetIsActive(false);
+        return false;
+    }
+}
+
+class PrefabPoolService : public EngineService
+{
+public:
+    PrefabPoolService()
+        : EngineService(TEXT("Prefab Pool"), 111)
+    {
+    }
+
+    void Dispose() override
+    {
+        for (auto& e : Pools)
+        {
+            Pool* pool = e.Value;
+            pool->Clear();
+            if (pool->PrefabAsset)
+            {
+                pool->PrefabAsset->OnReloading.Unbind<Pool, &Pool::OnReloading>(pool);
+                pool->PrefabAsset->OnUnloaded.Unbind<Pool, &Pool::OnUnloaded>(pool);
+            }
+            Delete(pool);
+        }
+        Pools.Clear();
+    }
+};
+
+PrefabPoolService PrefabPoolServiceInstance;
+
+int32 PrefabPool::DefaultCapacity = 64;
+
+void PrefabPool::SetCapacity(Prefab* prefab, int32 capacity)
+{
+    CHECK(prefab);
+    Pool* pool = GetPool(prefab);
+    pool->Capacity = Math::Max(capacity, 0);
+    while (pool->Instances.Count() > pool->Capacity)
+    {
+        Actor* instance = pool->Instances.Last().Get();
+        pool->Instances.RemoveLast();
+        if (instance)
+        {
+            pool->Parked.Remove(instance->GetID());
+            instance->DeleteObject();
+        }
+    }
+    pool->Stats.Pooled = pool->Instances.Count();
+}
+
+void PrefabPool::Prewarm(Prefab* prefab, int32 count, Actor* parent)
+{
+    CHECK(prefab);
+    PROFILE_CPU();
+    Pool* pool = GetPool(prefab);
+    parent = GetParent(parent);
+    count = Math::Min(count, pool->Capacity);
+    while (pool->Instances.Count() < count)
+    {
+        // Spawn without parent to deactivate instance before it begins play
+        Actor* instance = PrefabManager::SpawnPrefab(prefab, nullptr, nullptr);
+        if (!instance)
+            break;
+        instance->SetIsActive(false);
+        instance->SetParent(parent, false, false);
+        pool->Instances.Add(instance);
+        pool->Parked.Add(instance->GetID());
+        pool->Stats.Created++;
+    }
+    pool->Stats.Pooled = pool->Instances.Count();
+}
+
+Actor* PrefabPool::Spawn(Prefab* prefab, const Transform& transform, Actor* parent)
+{
+    if (prefab == nullptr)
+    {
+        Log::ArgumentNullException();
+        return nullptr;
+    }
+    PROFILE_CPU();
+    Pool* pool = GetPool(prefab);
+    parent = GetParent(parent);
+    pool->Stats.Spawned++;
+
+    // Reuse the parked instance (skip instances deleted in the meantime, eg. with the scene)
+    while (pool->Instances.HasItems())
+    {
+        Actor* instance = pool->Instances.Last().Get();
+        pool->Instances.RemoveLast();
+        if (!instance)
+            continue;
+        pool->Parked.Remove(instance->GetID());
+        pool->Stats.Pooled = pool->Instances.Count();
+        if (ResetInstance(pool, instance))
+        {
+            instance->DeleteObject();
+            continue;
+        }
+        pool->Stats.Reused++;
+        if (instance->GetParent() != parent)
+            instance->SetParent(parent, false, false);
+        instance->SetTransform(transform);
+        instance->SetIsActive(true);
+        return instance;
+    }
+    pool->Stats.Pooled = 0;
+
+    // Create a new instance
+    Actor* instance = PrefabManager::SpawnPrefab(prefab, nullptr, nullptr);
+    if (instance)
+    {
+        pool->Stats.Created++;
+        instance->SetTransform(transform);
+        instance->SetParent(parent, true, false);
+    }
+    return instance;
+}
+
+void PrefabPool::Despawn(Actor* instance)
+{
+    if (instance == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+    PROFILE_CPU();
+    Pool* pool = nullptr;
+    if (instance->HasPrefabLink())
+    {
+        Pools.TryGet(instance->GetPrefabID(), pool);
+        if (pool && (!pool->PrefabAsset || instance->GetPrefabObjectID() != pool->PrefabAsset->GetRootObjectId()))
+            pool = nullptr;
+    }
+    if (!pool)
+    {
+        LOG(Warning, "Actor {0} was not spawned from the prefab pool. Destroying it.", instance->ToString());
+        instance->DeleteObject();
+        return;
+    }
+    if (pool->Parked.Contains(instance->GetID()))
+    {
+        LOG(Warning, "Actor {0} is already despawned.", instance->ToString());
+        return;
+    }
+    pool->Stats.Despawned++;
+    if (pool->Instances.Count() >= pool->Capacity)
+    {
+        pool->Stats.Destroyed++;
+        instance->DeleteObject();
+        return;
+    }
+
+    // Park the instance (deactivation unregisters it from rendering, ticking and physics)
+    instance->SetIsActive(false);
+    pool->Instances.Add(instance);
+    pool->Parked.Add(instance->GetID());
+    pool->Stats.Pooled = pool->Instances.Count();
+}
+
+PrefabPoolStats PrefabPool::GetStats(Prefab* prefab)
+{
+    Pool* pool;
+    if (prefab && Pools.TryGet(prefab->GetID(), pool))
+        return pool->Stats;
+    return PrefabPoolStats();
+}
+
+void PrefabPool::Clear(Prefab* prefab)
+{
+    if (prefab)
+    {
+        Pool* pool;
+        if (Pools.TryGet(prefab->GetID(), pool))
+            pool->Clear();
+    }
+    else
+    {
+        for (auto& e : Pools)
+            e.Value->Clear();
+    }
+}
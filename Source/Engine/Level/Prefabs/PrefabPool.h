@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Math/Transform.h"
+
+class Prefab;
+class Actor;
+
+/// <summary>
+/// The prefab instances pool statistics.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API PrefabPoolStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(PrefabPoolStats);
+
+    /// <summary>
+    /// The total amount of spawned instances (reused and created).
+    /// </summary>
+    API_FIELD() int32 Spawned = 0;
+
+    /// <summary>
+    /// The amount of spawned instances that were reused from the pool. Hit rate is Reused divided by Spawned.
+    /// </summary>
+    API_FIELD() int32 Reused = 0;
+
+    /// <summary>
+    /// The amount of created instances (pool misses and prewarming).
+    /// </summary>
+    API_FIELD() int32 Created = 0;
+
+    /// <summary>
+    /// The amount of despawned instances (returned to the pool or destroyed).
+    /// </summary>
+    API_FIELD() int32 Despawned = 0;
+
+    /// <summary>
+    /// The amount of despawned instances that were destroyed because the pool was full.
+    /// </summary>
+    API_FIELD() int32 Destroyed = 0;
+
+    /// <summary>
+    /// The current amount of the parked instances ready to reuse.
+    /// </summary>
+    API_FIELD() int32 Pooled = 0;
+};
+
+/// <summary>
+/// The prefab instances pool. Despawned instances are deactivated and parked in the scene (deactivation unregisters them from rendering, ticking and physics) so the next spawn can reuse them without allocating new objects and registering new object ids.
+/// </summary>
+/// <remarks>
+/// Reused instances have the prefab state restored (objects properties are deserialized from the prefab data). Objects added or removed at runtime from the instance are not restored.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API PrefabPool
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(PrefabPool);
+
+    /// <summary>
+    /// The default maximum amount of the parked instances per prefab.
+    /// </summary>
+    API_FIELD() static int32 DefaultCapacity;
+
+    /// <summary>
+    /// Sets the maximum amount of the parked instances of the prefab. Instances despawned above this limit are destroyed.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="capacity">The pool capacity.</param>
+    API_FUNCTION() static void SetCapacity(Prefab* prefab, int32 capacity);
+
+    /// <summary>
+    /// Creates the parked instances of the prefab to make the following spawns cheap (eg. during level loading).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="count">The amount of the parked instances to have in the pool (limited by the pool capacity).</param>
+    /// <param name="parent">The parent actor to park instances in. Null to use the first loaded scene.</param>
+    API_FUNCTION() static void Prewarm(Prefab* prefab, int32 count, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Spawns the instance of the prefab. Reuses the parked instance if available, otherwise creates a new one.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transform">The spawn transformation in the world space.</param>
+    /// <param name="parent">The parent actor. Null to use the first loaded scene.</param>
+    /// <returns>The instance (root actor) or null if failed.</returns>
+    API_FUNCTION() static Actor* Spawn(Prefab* prefab, API_PARAM(Ref) const Transform& transform, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Despawns the prefab instance. Instance gets deactivated and parked in the pool or destroyed if the pool is full. Instances not spawned from the prefab are destroyed.
+    /// </summary>
+    /// <param name="instance">The prefab instance (root actor).</param>
+    API_FUNCTION() static void Despawn(Actor* instance);
+
+    /// <summary>
+    /// Gets the pool statistics of the prefab.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <returns>The pool statistics.</returns>
+    API_FUNCTION() static PrefabPoolStats GetStats(Prefab* prefab);
+
+    /// <summary>
+    /// Destroys the parked instances of the prefab.
+    /// </summary>
+    /// <param name="prefab">The prefab asset. Null to clear all pools.</param>
+    API_FUNCTION() static void Clear(Prefab* prefab = nullptr);
+};
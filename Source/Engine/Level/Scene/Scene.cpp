@@ -8,6 +8,12 @@
 #include "Engine/Content/Factories/JsonAssetFactory.h"
 #include "Engine/Physics/Colliders/MeshCollider.h"
 #include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Actors/AnimatedModel.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Content/Assets/MaterialBase.h"
 #include "Engine/Level/ActorsCache.h"
 #include "Engine/Navigation/NavigationSettings.h"
 #include "Engine/Navigation/NavMeshBoundsVolume.h"
@@ -98,6 +104,66 @@ void Scene::BuildCSG(float timeoutMs)
     CSGData.BuildCSG(timeoutMs);
 }
 
+namespace
+{
+    void AddMaterial(Array<MaterialBase*>& materials, MaterialBase* material)
+    {
+        if (material)
+            materials.AddUnique(material);
+    }
+
+    void AddMaterials(Array<MaterialBase*>& materials, const ModelInstanceEntries& entries, const ModelBase* model)
+    {
+        for (const auto& entry : entries)
+            AddMaterial(materials, entry.Material);
+        if (model && model->IsLoaded())
+        {
+            for (const auto& slot : model->MaterialSlots)
+                AddMaterial(materials, slot.Material);
+        }
+    }
+
+    bool CollectMaterials(Actor* actor, Array<MaterialBase*>& materials)
+    {
+        if (const auto staticModel = dynamic_cast<StaticModel*>(actor))
+        {
+            AddMaterials(materials, staticModel->Entries, staticModel->Model.Get());
+        }
+        else if (const auto animatedModel = dynamic_cast<AnimatedModel*>(actor))
+        {
+            AddMaterials(materials, animatedModel->Entries, animatedModel->SkinnedModel.Get());
+        }
+        else if (const auto foliage = dynamic_cast<Foliage*>(actor))
+        {
+            for (const auto& type : foliage->FoliageTypes)
+                AddMaterials(materials, type.Entries, type.Model.Get());
+        }
+        else if (const auto terrain = dynamic_cast<Terrain*>(actor))
+        {
+            AddMaterial(materials, terrain->Material);
+        }
+        return true;
+    }
+}
+
+int32 Scene::PrewarmMaterials()
+{
+    PROFILE_CPU();
+    Array<MaterialBase*> materials;
+    Function<bool(Actor*, Array<MaterialBase*>&)> action(CollectMaterials);
+    TreeExecute<Array<MaterialBase*>&>(action, materials);
+    int32 count = 0;
+    for (MaterialBase* material : materials)
+    {
+        if (material->IsLoaded())
+        {
+            material->Prewarm();
+            count++;
+        }
+    }
+    return count;
+}
+
 #if USE_EDITOR
 
 String Scene::GetPath() const
@@ -91,6 +91,13 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// <param name="timeoutMs">The timeout to wait before building CSG (in milliseconds).</param>
     API_FUNCTION() void BuildCSG(float timeoutMs = 50);
 
+    /// <summary>
+    /// Starts the background compilation of the pipeline states of the materials used by the scene actors (models, foliage and terrain). Can be called after loading the scene to prevent hitches on the first draw (if supported by the rendering backend).
+    /// </summary>
+    /// <seealso cref="GPUPipelineState.Prewarm"/>
+    /// <returns>The amount of the loaded materials that were prewarmed.</returns>
+    API_FUNCTION() int32 PrewarmMaterials();
+
 #if USE_EDITOR
 
     /// <summary>
@@ -9,6 +9,7 @@
 #include "NavLink.h"
 #include "NavModifierVolume.h"
 #include "NavMeshRuntime.h"
+#include "NavMeshTileCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Math/Vector3.h"
@@ -21,12 +22,14 @@
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Terrain/Terrain.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Level/SceneQuery.h"
 #include <ThirdParty/recastnavigation/Recast.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/recastnavigation/DetourTileCacheBuilder.h>
 
 int32 BoxTrianglesIndicesCache[] =
 {
@@ -428,6 +431,80 @@ void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int
     runtime->RemoveTile(x, y, layer);
 }
 
+// Builds the compressed heightfield layers for the tile cache (used to update tile by dynamic obstacles at runtime)
+bool BuildTileCacheData(rcContext& context, rcConfig& config, rcCompactHeightfield& compactHeightfield, int32 x, int32 y, const Array<OffMeshLink>& offMeshLinks, BytesContainer& result)
+{
+    PROFILE_CPU_NAMED("BuildTileCacheData");
+
+    rcHeightfieldLayerSet* layerSet = rcAllocHeightfieldLayerSet();
+    if (!layerSet)
+    {
+        LOG(Warning, "Could not generate navmesh: Out of memory for heightfield layers.");
+        return true;
+    }
+    if (!rcBuildHeightfieldLayers(&context, compactHeightfield, config.borderSize, config.walkableHeight, *layerSet))
+    {
+        LOG(Warning, "Could not generate navmesh: Could not build heightfield layers.");
+        rcFreeHeightfieldLayerSet(layerSet);
+        return true;
+    }
+    if (layerSet->nlayers > NAV_MESH_TILE_CACHE_MAX_LAYERS)
+    {
+        LOG(Warning, "Navmesh tile at {0}x{1} has {2} layers, only {3} will be used for the dynamic obstacles.", x, y, layerSet->nlayers, NAV_MESH_TILE_CACHE_MAX_LAYERS);
+    }
+
+    Array<BytesContainer> layers;
+    layers.Resize(Math::Min(layerSet->nlayers, NAV_MESH_TILE_CACHE_MAX_LAYERS));
+    for (int32 i = 0; i < layers.Count(); i++)
+    {
+        const rcHeightfieldLayer& layer = layerSet->layers[i];
+        dtTileCacheLayerHeader header;
+        header.magic = DT_TILECACHE_MAGIC;
+        header.version = DT_TILECACHE_VERSION;
+        header.tx = x;
+        header.ty = y;
+        header.tlayer = i;
+        rcVcopy(header.bmin, layer.bmin);
+        rcVcopy(header.bmax, layer.bmax);
+        header.width = (unsigned char)layer.width;
+        header.height = (unsigned char)layer.height;
+        header.minx = (unsigned char)layer.minx;
+        header.maxx = (unsigned char)layer.maxx;
+        header.miny = (unsigned char)layer.miny;
+        header.maxy = (unsigned char)layer.maxy;
+        header.hmin = (unsigned short)layer.hmin;
+        header.hmax = (unsigned short)layer.hmax;
+
+        unsigned char* data = nullptr;
+        int dataSize = 0;
+        if (dtStatusFailed(dtBuildTileCacheLayer(NavMeshTileCache::GetCompressor(), &header, layer.heights, layer.areas, layer.cons, &data, &dataSize)))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not build tile cache layer.");
+            rcFreeHeightfieldLayerSet(layerSet);
+            return true;
+        }
+        layers[i].Copy(data, dataSize);
+        dtFree(data);
+    }
+    rcFreeHeightfieldLayerSet(layerSet);
+
+    Array<NavMeshTileCacheLink> links;
+    links.Resize(offMeshLinks.Count());
+    for (int32 i = 0; i < links.Count(); i++)
+    {
+        const auto& link = offMeshLinks[i];
+        auto& e = links[i];
+        e.Start = link.Start;
+        e.End = link.End;
+        e.Radius = link.Radius;
+        e.Id = link.Id;
+        e.BiDir = link.BiDir ? 1 : 0;
+    }
+
+    NavMeshTileCache::WriteData(result, links, layers);
+    return false;
+}
+
 bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config)
 {
     rcContext context;
@@ -490,6 +567,14 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         rcMarkBoxArea(&context, &bMin.X, &bMax.X, areaId, *compactHeightfield);
     }
 
+    // Build tile cache layers for dynamic obstacles
+    BytesContainer cacheData;
+    if (NavigationSettings::Get()->EnableDynamicObstacles && config.tileSize <= 255)
+    {
+        if (BuildTileCacheData(context, config, *compactHeightfield, x, y, offMeshLinks, cacheData))
+            return true;
+    }
+
     if (!rcBuildDistanceField(&context, *compactHeightfield))
     {
         LOG(Warning, "Could not generate navmesh: Could not build distance field.");
@@ -656,6 +741,7 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
 
         // Copy data to the tile
         tile->Data.Copy(navData, navDataSize);
+        tile->CacheData.Swap(cacheData);
 
         // Add tile to navmesh
         runtime->AddTile(navMesh, *tile);
@@ -728,6 +814,7 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     bool Run() override
     {
         PROFILE_CPU_NAMED("BuildNavMeshTile");
+        PROFILE_MEM(Navigation);
 
         const auto navMesh = NavMesh.Get();
         if (!navMesh)
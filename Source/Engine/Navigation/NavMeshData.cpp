@@ -9,7 +9,7 @@ void NavMeshData::Save(WriteStream& stream)
 {
     // Write header
     NavMeshDataHeader header;
-    header.Version = 1;
+    header.Version = 2;
     header.TileSize = TileSize;
     header.TilesCount = Tiles.Count();
     stream.Write(&header);
@@ -36,6 +36,12 @@ void NavMeshData::Save(WriteStream& stream)
         {
             LOG(Warning, "Empty navmesh tile data.");
         }
+
+        // Write tile cache data
+        const int32 cacheDataSize = tile.CacheData.Length();
+        stream.WriteInt32(cacheDataSize);
+        if (cacheDataSize)
+            stream.WriteBytes(tile.CacheData.Get(), cacheDataSize);
     }
 }
 
@@ -51,7 +57,7 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
 
     // Read header
     const auto header = stream.Read<NavMeshDataHeader>(1);
-    if (header->Version != 1)
+    if (header->Version != 1 && header->Version != 2)
     {
         LOG(Warning, "Invalid valid navmesh data version {0}.", header->Version);
         return true;
@@ -90,6 +96,26 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
         {
             tile.Data.Link(tileData, tileHeader->DataSize);
         }
+
+        // Read tile cache data (optional)
+        tile.CacheData.Release();
+        if (header->Version >= 2)
+        {
+            const int32 cacheDataSize = *stream.Read<int32>(1);
+            if (cacheDataSize < 0)
+            {
+                LOG(Warning, "Invalid navmesh tile cache data.");
+                return true;
+            }
+            if (cacheDataSize != 0)
+            {
+                const auto cacheData = stream.Read<byte>(cacheDataSize);
+                if (copyData)
+                    tile.CacheData.Copy(cacheData, cacheDataSize);
+                else
+                    tile.CacheData.Link(cacheData, cacheDataSize);
+            }
+        }
     }
 
     return false;
@@ -21,6 +21,11 @@ struct NavMeshTileData
     int32 PosY;
     int32 Layer;
     BytesContainer Data;
+
+    /// <summary>
+    /// The compressed tile cache layers data used to update navmesh tile with dynamic obstacles at runtime. Empty if unused.
+    /// </summary>
+    BytesContainer CacheData;
 };
 
 struct NavMeshDataHeader
@@ -30,17 +30,19 @@ NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
     _tileSize = 0;
+    _tileCache = nullptr;
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
+    DisposeTileCache();
     dtFreeNavMesh(_navMesh);
     dtFreeNavMeshQuery(_navMeshQuery);
 }
 
 int32 NavMeshRuntime::GetTilesCapacity() const
 {
-    return _navMesh ? _navMesh->getMaxTiles() : 0;
+    return _navMesh ? _navMesh->getMaxTiles() / (_tileCache ? NAV_MESH_TILE_CACHE_MAX_LAYERS : 1) : 0;
 }
 
 bool NavMeshRuntime::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance) const
@@ -332,6 +334,7 @@ void NavMeshRuntime::SetTileSize(float tileSize)
     // Dispose the existing mesh (its invalid)
     if (_navMesh)
     {
+        DisposeTileCache();
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
         _tiles.Clear();
@@ -360,10 +363,12 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     ASSERT(_tileSize != 0);
 
     // Fre previous data (if any)
+    DisposeTileCache();
     if (_navMesh)
     {
         dtFreeNavMesh(_navMesh);
     }
+    const bool useTileCache = NavigationSettings::Get()->EnableDynamicObstacles;
 
     // Allocate new navmesh
     _navMesh = dtAllocNavMesh();
@@ -379,7 +384,7 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     params.orig[2] = 0.0f;
     params.tileWidth = _tileSize;
     params.tileHeight = _tileSize;
-    params.maxTiles = newCapacity;
+    params.maxTiles = newCapacity * (useTileCache ? NAV_MESH_TILE_CACHE_MAX_LAYERS : 1);
     const int32 tilesBits = (int32)Math::Log2((float)Math::RoundUpToPowerOf2(params.maxTiles));
     params.maxPolys = 1 << (22 - tilesBits);
 
@@ -390,26 +395,28 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
         return;
     }
 
+    // Initialize tile cache for dynamic obstacles
+    if (useTileCache)
+    {
+        _tileCache = New<NavMeshTileCache>(this);
+        if (_tileCache->Init(_navMesh, newCapacity))
+        {
+            DisposeTileCache();
+        }
+        else
+        {
+            for (auto& e : _obstacles)
+                _tileCache->AddObstacle(e.Key, e.Value);
+        }
+    }
+
     // Prepare tiles container
     _tiles.EnsureCapacity(newCapacity);
 
     // Restore previous tiles
     for (auto& tile : _tiles)
     {
-        const int32 dataSize = tile.Data.Length();
-#if USE_NAV_MESH_ALLOC
-        const auto flags = DT_TILE_FREE_DATA;
-        const auto data = (byte*)dtAlloc(dataSize, DT_ALLOC_PERM);
-        Platform::MemoryCopy(data, tile.Data.Get(), dataSize);
-#else
-		const auto flags = 0;
-		const auto data = tile.Data.Get();
-#endif
-        const auto result = _navMesh->addTile(data, dataSize, flags, 0, nullptr);
-        if (dtStatusFailed(result))
-        {
-            LOG(Warning, "Could not add tile to navmesh {0} (error: {1}).", Properties.Name, result & ~DT_FAILURE);
-        }
+        AddTileData(tile);
     }
 }
 
@@ -491,6 +498,17 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
         return;
     PROFILE_CPU_NAMED("NavMeshRuntime.RemoveTile");
 
+    for (int32 i = 0; i < _tiles.Count(); i++)
+    {
+        auto& tile = _tiles[i];
+        if (tile.X == x && tile.Y == y && tile.Layer == layer)
+        {
+            RemoveTileData(tile);
+            _tiles.RemoveAt(i);
+            return;
+        }
+    }
+
     const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
     if (tileRef == 0)
     {
@@ -501,16 +519,6 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
     {
         LOG(Warning, "Failed to remove tile from navmesh {0}.", Properties.Name);
     }
-
-    for (int32 i = 0; i < _tiles.Count(); i++)
-    {
-        auto& tile = _tiles[i];
-        if (tile.X == x && tile.Y == y && tile.Layer == layer)
-        {
-            _tiles.RemoveAt(i);
-            break;
-        }
-    }
 }
 
 void NavMeshRuntime::RemoveTiles(bool (* prediction)(const NavMeshRuntime* navMesh, const NavMeshTile& tile, void* customData), void* userData)
@@ -526,24 +534,50 @@ void NavMeshRuntime::RemoveTiles(bool (* prediction)(const NavMeshRuntime* navMe
         auto& tile = _tiles[i];
         if (prediction(this, tile, userData))
         {
-            const auto tileRef = _navMesh->getTileRefAt(tile.X, tile.Y, tile.Layer);
-            if (tileRef == 0)
-            {
-                LOG(Warning, "Missing navmesh {3} tile at {0}x{1}, layer: {2}", tile.X, tile.Y, tile.Layer, Properties.Name);
-            }
-            else
-            {
-                if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
-                {
-                    LOG(Warning, "Failed to remove tile from navmesh {0}.", Properties.Name);
-                }
-            }
-
+            RemoveTileData(tile);
             _tiles.RemoveAt(i--);
         }
     }
 }
 
+void NavMeshRuntime::AddObstacle(uint32 id, const NavMeshObstacle& obstacle)
+{
+    ScopeLock lock(Locker);
+    _obstacles[id] = obstacle;
+    if (_tileCache)
+        _tileCache->AddObstacle(id, obstacle);
+}
+
+void NavMeshRuntime::RemoveObstacle(uint32 id)
+{
+    ScopeLock lock(Locker);
+    if (_obstacles.Remove(id) && _tileCache)
+        _tileCache->RemoveObstacle(id);
+}
+
+void NavMeshRuntime::UpdateTileCache(float timeBudgetMs)
+{
+    ScopeLock lock(Locker);
+    if (_tileCache)
+        _tileCache->Update(timeBudgetMs);
+}
+
+NavMeshTileCacheStats NavMeshRuntime::GetTileCacheStats() const
+{
+    ScopeLock lock(Locker);
+    NavMeshTileCacheStats result;
+    if (_tileCache)
+    {
+        result = _tileCache->Stats;
+    }
+    else
+    {
+        Platform::MemoryClear(&result, sizeof(result));
+        result.ObstaclesCount = _obstacles.Count();
+    }
+    return result;
+}
+
 #if COMPILE_WITH_DEBUG_DRAW
 
 #include "Engine/Debug/DebugDraw.h"
@@ -653,6 +687,7 @@ void NavMeshRuntime::DebugDraw()
 
 void NavMeshRuntime::Dispose()
 {
+    DisposeTileCache();
     if (_navMesh)
     {
         dtFreeNavMesh(_navMesh);
@@ -665,28 +700,25 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
 {
     // Check if that tile has been added to navmesh
     NavMeshTile* tile = nullptr;
-    const auto tileRef = _navMesh->getTileRefAt(tileData.PosX, tileData.PosY, tileData.Layer);
-    if (tileRef)
+    for (int32 i = 0; i < _tiles.Count(); i++)
     {
-        // Remove any existing tile at that location
-        if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+        auto& e = _tiles[i];
+        if (e.X == tileData.PosX && e.Y == tileData.PosY && e.Layer == tileData.Layer)
         {
-            LOG(Warning, "Failed to remove tile from navmesh {0}.", Properties.Name);
-        }
-
-        // Reuse tile data container
-        for (int32 i = 0; i < _tiles.Count(); i++)
-        {
-            auto& e = _tiles[i];
-            if (e.X == tileData.PosX && e.Y == tileData.PosY && e.Layer == tileData.Layer)
-            {
-                tile = &e;
-                break;
-            }
+            // Remove any existing tile at that location and reuse tile data container
+            RemoveTileData(e);
+            tile = &e;
+            break;
         }
     }
     if (!tile)
     {
+        const auto tileRef = _navMesh->getTileRefAt(tileData.PosX, tileData.PosY, tileData.Layer);
+        if (tileRef && dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+        {
+            LOG(Warning, "Failed to remove tile from navmesh {0}.", Properties.Name);
+        }
+
         // Add tile
         tile = &_tiles.AddOne();
     }
@@ -698,19 +730,34 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
     tile->Layer = tileData.Layer;
 #if USE_DATA_LINK
 	tile->Data.Link(tileData.Data);
+	tile->CacheData.Link(tileData.CacheData);
 #else
     tile->Data.Copy(tileData.Data);
+    tile->CacheData.Copy(tileData.CacheData);
 #endif
 
     // Add tile to navmesh
-    const int32 dataSize = tile->Data.Length();
+    AddTileData(*tile);
+}
+
+void NavMeshRuntime::AddTileData(const NavMeshTile& tile)
+{
+    // Build tile from the compressed layers if using dynamic obstacles
+    if (_tileCache && tile.CacheData.IsValid())
+    {
+        if (!_tileCache->AddTile(tile.X, tile.Y, tile.CacheData, _obstacles))
+            return;
+        _tileCache->RemoveTile(tile.X, tile.Y);
+    }
+
+    const int32 dataSize = tile.Data.Length();
 #if USE_NAV_MESH_ALLOC
     const auto flags = DT_TILE_FREE_DATA;
     const auto data = (byte*)dtAlloc(dataSize, DT_ALLOC_PERM);
-    Platform::MemoryCopy(data, tile->Data.Get(), dataSize);
+    Platform::MemoryCopy(data, tile.Data.Get(), dataSize);
 #else
 	const auto flags = 0;
-	const auto data = tile->Data.Get();
+	const auto data = tile.Data.Get();
 #endif
     const auto result = _navMesh->addTile(data, dataSize, flags, 0, nullptr);
     if (dtStatusFailed(result))
@@ -718,3 +765,32 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
         LOG(Warning, "Could not add tile to navmesh {0} (error: {1}).", Properties.Name, result & ~DT_FAILURE);
     }
 }
+
+void NavMeshRuntime::RemoveTileData(const NavMeshTile& tile)
+{
+    // Tiles built from the cache can use multiple layers
+    if (_tileCache && tile.CacheData.IsValid())
+    {
+        _tileCache->RemoveTile(tile.X, tile.Y);
+        return;
+    }
+
+    const auto tileRef = _navMesh->getTileRefAt(tile.X, tile.Y, tile.Layer);
+    if (tileRef == 0)
+    {
+        LOG(Warning, "Missing navmesh {3} tile at {0}x{1}, layer: {2}", tile.X, tile.Y, tile.Layer, Properties.Name);
+    }
+    else if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+    {
+        LOG(Warning, "Failed to remove tile from navmesh {0}.", Properties.Name);
+    }
+}
+
+void NavMeshRuntime::DisposeTileCache()
+{
+    if (_tileCache)
+    {
+        Delete(_tileCache);
+        _tileCache = nullptr;
+    }
+}
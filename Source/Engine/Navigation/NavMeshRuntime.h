@@ -4,7 +4,9 @@
 
 #include "Engine/Core/Types/BaseTypes.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "NavMeshData.h"
+#include "NavMeshTileCache.h"
 #include "NavigationTypes.h"
 
 class dtNavMesh;
@@ -22,6 +24,7 @@ class FLAXENGINE_API NavMeshTile
     int32 Layer;
     NavMesh* NavMesh;
     BytesContainer Data;
+    BytesContainer CacheData;
 };
 
 /// <summary>
@@ -53,6 +56,8 @@ class FLAXENGINE_API NavMeshRuntime
     dtNavMeshQuery* _navMeshQuery;
     float _tileSize;
     Array<NavMeshTile> _tiles;
+    NavMeshTileCache* _tileCache;
+    Dictionary<uint32, NavMeshObstacle> _obstacles;
 
 public:
     NavMeshRuntime(const NavMeshProperties& properties);
@@ -196,6 +201,31 @@ class FLAXENGINE_API NavMeshRuntime
     /// <param name="userData">The user data passed to the callback method.</param>
     void RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMesh, const NavMeshTile& tile, void* customData), void* userData);
 
+public:
+    /// <summary>
+    /// Adds the dynamic obstacle to the navmesh. Affected tiles are updated by the tile cache (if navmesh has been built with dynamic obstacles enabled).
+    /// </summary>
+    /// <param name="id">The obstacle unique identifier.</param>
+    /// <param name="obstacle">The obstacle descriptor (in world-space).</param>
+    void AddObstacle(uint32 id, const NavMeshObstacle& obstacle);
+
+    /// <summary>
+    /// Removes the dynamic obstacle from the navmesh.
+    /// </summary>
+    /// <param name="id">The obstacle unique identifier.</param>
+    void RemoveObstacle(uint32 id);
+
+    /// <summary>
+    /// Updates the navmesh tiles affected by the dynamic obstacles changes.
+    /// </summary>
+    /// <param name="timeBudgetMs">The time budget (in milliseconds).</param>
+    void UpdateTileCache(float timeBudgetMs);
+
+    /// <summary>
+    /// Gets the dynamic obstacles tile cache statistics.
+    /// </summary>
+    NavMeshTileCacheStats GetTileCacheStats() const;
+
 #if COMPILE_WITH_DEBUG_DRAW
     void DebugDraw();
 #endif
@@ -207,4 +237,7 @@ class FLAXENGINE_API NavMeshRuntime
 
 private:
     void AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData);
+    void AddTileData(const NavMeshTile& tile);
+    void RemoveTileData(const NavMeshTile& tile);
+    void DisposeTileCache();
 };
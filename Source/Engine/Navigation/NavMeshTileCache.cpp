@@ -0,0 +1,466 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "NavMeshTileCache.h"
+#include "NavMeshRuntime.h"
+#include "NavigationSettings.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include <ThirdParty/recastnavigation/DetourCommon.h>
+#include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
+#include <ThirdParty/recastnavigation/DetourTileCache.h>
+#include <ThirdParty/recastnavigation/DetourTileCacheBuilder.h>
+#include <ThirdParty/LZ4/lz4.h>
+
+#define NAV_MESH_TILE_CACHE_DATA_VERSION 1
+
+struct NavMeshTileCacheCompressor : dtTileCacheCompressor
+{
+    int maxCompressedSize(const int bufferSize) override
+    {
+        return LZ4_compressBound(bufferSize);
+    }
+
+    dtStatus compress(const unsigned char* buffer, const int bufferSize, unsigned char* compressed, const int maxCompressedSize, int* compressedSize) override
+    {
+        const int32 size = LZ4_compress_default((const char*)buffer, (char*)compressed, bufferSize, maxCompressedSize);
+        if (size <= 0)
+            return DT_FAILURE;
+        *compressedSize = size;
+        return DT_SUCCESS;
+    }
+
+    dtStatus decompress(const unsigned char* compressed, const int compressedSize, unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+    {
+        const int32 size = LZ4_decompress_safe((const char*)compressed, (char*)buffer, compressedSize, maxBufferSize);
+        if (size < 0)
+            return DT_FAILURE;
+        *bufferSize = size;
+        return DT_SUCCESS;
+    }
+};
+
+// Linear allocator for the temporary tile building data (reset before each tile build). Falls back to the heap allocations when running out of the space and grows the buffer on reset.
+struct NavMeshTileCacheAllocator : dtTileCacheAlloc
+{
+    byte* Buffer = nullptr;
+    uintptr Capacity = 0;
+    uintptr Top = 0;
+    uintptr Required = 0;
+    Array<void*> Overflow;
+
+    explicit NavMeshTileCacheAllocator(uintptr capacity)
+    {
+        Capacity = capacity;
+        Buffer = (byte*)Allocator::Allocate(capacity, 16);
+    }
+
+    ~NavMeshTileCacheAllocator() override
+    {
+        reset();
+        Allocator::Free(Buffer);
+    }
+
+    void reset() override
+    {
+        for (void* ptr : Overflow)
+            Allocator::Free(ptr);
+        Overflow.Clear();
+        if (Required > Capacity)
+        {
+            Allocator::Free(Buffer);
+            Capacity = Math::RoundUpToPowerOf2(Required);
+            Buffer = (byte*)Allocator::Allocate(Capacity, 16);
+        }
+        Top = 0;
+        Required = 0;
+    }
+
+    void* alloc(const size_t size) override
+    {
+        const uintptr alignedSize = Math::AlignUp<uintptr>((uintptr)size, 16);
+        Required += alignedSize;
+        if (Top + alignedSize > Capacity)
+        {
+            void* ptr = Allocator::Allocate(size, 16);
+            Overflow.Add(ptr);
+            return ptr;
+        }
+        void* ptr = Buffer + Top;
+        Top += alignedSize;
+        return ptr;
+    }
+
+    void free(void* ptr) override
+    {
+        // Memory is released on reset
+    }
+};
+
+// Sets the polygons flags and injects the off-mesh links into the tiles built from the tile cache.
+struct NavMeshTileCacheMeshProcess : dtTileCacheMeshProcess
+{
+    NavMeshTileCache* Cache;
+    Array<Float3> OffMeshStartEnd;
+    Array<float> OffMeshRadius;
+    Array<unsigned char> OffMeshDir;
+    Array<unsigned char> OffMeshArea;
+    Array<unsigned short> OffMeshFlags;
+    Array<unsigned int> OffMeshId;
+
+    void process(dtNavMeshCreateParams* params, unsigned char* polyAreas, unsigned short* polyFlags) override
+    {
+        for (int32 i = 0; i < params->polyCount; i++)
+            polyFlags[i] = polyAreas[i] != DT_TILECACHE_NULL_AREA ? 1 : 0;
+
+        const auto links = Cache->_links.TryGet(NavMeshTileCache::GetTileKey(params->tileX, params->tileY));
+        if (!links || links->IsEmpty())
+            return;
+        const int32 linksCount = links->Count();
+        OffMeshStartEnd.Resize(linksCount * 2, false);
+        OffMeshRadius.Resize(linksCount, false);
+        OffMeshDir.Resize(linksCount, false);
+        OffMeshArea.Resize(linksCount, false);
+        OffMeshFlags.Resize(linksCount, false);
+        OffMeshId.Resize(linksCount, false);
+        for (int32 i = 0; i < linksCount; i++)
+        {
+            const auto& link = links->At(i);
+            OffMeshStartEnd[i * 2] = link.Start;
+            OffMeshStartEnd[i * 2 + 1] = link.End;
+            OffMeshRadius[i] = link.Radius;
+            OffMeshDir[i] = link.BiDir ? DT_OFFMESH_CON_BIDIR : 0;
+            OffMeshArea[i] = DT_TILECACHE_WALKABLE_AREA;
+            OffMeshFlags[i] = 1;
+            OffMeshId[i] = link.Id;
+        }
+        params->offMeshConCount = linksCount;
+        params->offMeshConVerts = (const float*)OffMeshStartEnd.Get();
+        params->offMeshConRad = OffMeshRadius.Get();
+        params->offMeshConDir = OffMeshDir.Get();
+        params->offMeshConAreas = OffMeshArea.Get();
+        params->offMeshConFlags = OffMeshFlags.Get();
+        params->offMeshConUserID = OffMeshId.Get();
+    }
+};
+
+NavMeshTileCache::NavMeshTileCache(NavMeshRuntime* runtime)
+    : _runtime(runtime)
+    , _navMesh(nullptr)
+    , _tileCache(nullptr)
+    , _allocator(nullptr)
+    , _meshProcess(nullptr)
+    , _isDirty(false)
+    , _cachedTilesMemory(0)
+    , _totalTileUpdatesTimeMs(0.0f)
+{
+    Platform::MemoryClear(&Stats, sizeof(Stats));
+}
+
+NavMeshTileCache::~NavMeshTileCache()
+{
+    dtFreeTileCache(_tileCache);
+    Delete(_allocator);
+    Delete(_meshProcess);
+}
+
+dtTileCacheCompressor* NavMeshTileCache::GetCompressor()
+{
+    static NavMeshTileCacheCompressor Compressor;
+    return &Compressor;
+}
+
+void NavMeshTileCache::WriteData(BytesContainer& result, const Array<NavMeshTileCacheLink>& links, const Array<BytesContainer>& layers)
+{
+    int32 size = sizeof(NavMeshTileCacheHeader) + links.Count() * sizeof(NavMeshTileCacheLink);
+    for (const auto& layer : layers)
+        size += sizeof(int32) + layer.Length();
+    MemoryWriteStream stream(size);
+
+    NavMeshTileCacheHeader header;
+    header.Version = NAV_MESH_TILE_CACHE_DATA_VERSION;
+    header.LayersCount = layers.Count();
+    header.LinksCount = links.Count();
+    stream.Write(&header);
+    if (links.HasItems())
+        stream.WriteBytes(links.Get(), links.Count() * sizeof(NavMeshTileCacheLink));
+    for (const auto& layer : layers)
+    {
+        stream.WriteInt32(layer.Length());
+        stream.WriteBytes(layer.Get(), layer.Length());
+    }
+
+    result.Copy(stream.GetHandle(), (int32)stream.GetPosition());
+}
+
+bool NavMeshTileCache::Init(dtNavMesh* navMesh, int32 maxTiles)
+{
+    ASSERT(navMesh && !_tileCache);
+    const auto& settings = *NavigationSettings::Get();
+    const auto& agent = _runtime->Properties.Agent;
+    if (settings.TileSize > 255)
+    {
+        LOG(Warning, "Navmesh dynamic obstacles are not supported with Tile Size {0} (max 255).", settings.TileSize);
+        return true;
+    }
+    _navMesh = navMesh;
+
+    dtTileCacheParams params;
+    Platform::MemoryClear(&params, sizeof(params));
+    params.cs = settings.CellSize;
+    params.ch = settings.CellHeight;
+    params.width = settings.TileSize;
+    params.height = settings.TileSize;
+    params.walkableHeight = agent.Height;
+    params.walkableRadius = agent.Radius;
+    params.walkableClimb = agent.StepHeight;
+    params.maxSimplificationError = settings.MaxEdgeError;
+    params.maxTiles = maxTiles * NAV_MESH_TILE_CACHE_MAX_LAYERS;
+    params.maxObstacles = settings.MaxDynamicObstacles;
+
+    // Estimate the temporary memory for a single layer build (heights, areas, cons, regions + contours and poly mesh)
+    const int32 layerCells = (settings.TileSize + 1) * (settings.TileSize + 1);
+    _allocator = New<NavMeshTileCacheAllocator>(Math::RoundUpToPowerOf2((uintptr)layerCells * 32));
+    _meshProcess = New<NavMeshTileCacheMeshProcess>();
+    _meshProcess->Cache = this;
+    _tileCache = dtAllocTileCache();
+    if (!_tileCache || dtStatusFailed(_tileCache->init(&params, _allocator, GetCompressor(), _meshProcess)))
+    {
+        LOG(Error, "Failed to initialize navmesh {0} tile cache.", _runtime->Properties.Name);
+        return true;
+    }
+
+    return false;
+}
+
+bool NavMeshTileCache::AddTile(int32 x, int32 y, const BytesContainer& cacheData, const Dictionary<uint32, NavMeshObstacle>& obstacles)
+{
+    if (cacheData.Length() < sizeof(NavMeshTileCacheHeader))
+        return true;
+    PROFILE_CPU_NAMED("NavMeshTileCache.AddTile");
+
+    // Remove any existing layers at that location
+    RemoveTile(x, y);
+
+    MemoryReadStream stream(cacheData.Get(), cacheData.Length());
+    const auto header = stream.Read<NavMeshTileCacheHeader>();
+    if (header->Version != NAV_MESH_TILE_CACHE_DATA_VERSION || header->LayersCount < 0 || header->LinksCount < 0)
+    {
+        LOG(Warning, "Invalid navmesh tile cache data at {0}x{1}.", x, y);
+        return true;
+    }
+
+    // Off-mesh links
+    if (header->LinksCount != 0)
+    {
+        auto& links = _links[GetTileKey(x, y)];
+        links.Set(stream.Read<NavMeshTileCacheLink>(header->LinksCount), header->LinksCount);
+    }
+
+    // Compressed layers
+    for (int32 layerIndex = 0; layerIndex < header->LayersCount; layerIndex++)
+    {
+        const int32 size = *stream.Read<int32>();
+        const byte* layerData = stream.Read<byte>(size);
+        auto data = (byte*)dtAlloc(size, DT_ALLOC_PERM);
+        Platform::MemoryCopy(data, layerData, size);
+        const dtStatus status = _tileCache->addTile(data, size, DT_COMPRESSEDTILE_FREE_DATA, nullptr);
+        if (dtStatusFailed(status))
+        {
+            LOG(Warning, "Could not add tile {1}x{2} to navmesh {0} tile cache (error: {3}).", _runtime->Properties.Name, x, y, status & ~DT_FAILURE);
+            dtFree(data);
+            continue;
+        }
+        _cachedTilesMemory += size;
+    }
+    Stats.CachedTilesCount++;
+    Stats.CachedTilesMemory = _cachedTilesMemory;
+
+    // Obstacles are linked to the tiles existing at the time of adding so refresh the ones overlapping the new tile
+    if (_obstacles.HasItems())
+    {
+        dtCompressedTileRef tiles[NAV_MESH_TILE_CACHE_MAX_LAYERS];
+        const int32 tilesCount = _tileCache->getTilesAt(x, y, tiles, NAV_MESH_TILE_CACHE_MAX_LAYERS);
+        Float3 tileMin(MAX_float), tileMax(-MAX_float);
+        for (int32 i = 0; i < tilesCount; i++)
+        {
+            Float3 layerMin, layerMax;
+            _tileCache->calcTightTileBounds(_tileCache->getTileByRef(tiles[i])->header, &layerMin.X, &layerMax.X);
+            tileMin = Float3::Min(tileMin, layerMin);
+            tileMax = Float3::Max(tileMax, layerMax);
+        }
+        for (const auto& e : obstacles)
+        {
+            uint32 ref;
+            if (!_obstacles.TryGet(e.Key, ref))
+                continue;
+            const dtTileCacheObstacle* ob = _tileCache->getObstacleByRef(ref);
+            if (!ob)
+                continue;
+            Float3 obstacleMin, obstacleMax;
+            _tileCache->getObstacleBounds(ob, &obstacleMin.X, &obstacleMax.X);
+            if (dtOverlapBounds(&tileMin.X, &tileMax.X, &obstacleMin.X, &obstacleMax.X))
+            {
+                RemoveObstacle(e.Key);
+                AddObstacle(e.Key, e.Value);
+            }
+        }
+    }
+
+    // Build navmesh tiles from layers (with all obstacles applied)
+    const dtStatus status = _tileCache->buildNavMeshTilesAt(x, y, _navMesh);
+    if (dtStatusFailed(status))
+    {
+        LOG(Warning, "Could not build tile {1}x{2} of navmesh {0} from tile cache (error: {3}).", _runtime->Properties.Name, x, y, status & ~DT_FAILURE);
+        return true;
+    }
+    return false;
+}
+
+void NavMeshTileCache::RemoveTile(int32 x, int32 y)
+{
+    dtCompressedTileRef tiles[NAV_MESH_TILE_CACHE_MAX_LAYERS];
+    const int32 tilesCount = _tileCache->getTilesAt(x, y, tiles, NAV_MESH_TILE_CACHE_MAX_LAYERS);
+    if (tilesCount != 0)
+        Stats.CachedTilesCount--;
+    for (int32 i = 0; i < tilesCount; i++)
+    {
+        const dtCompressedTile* tile = _tileCache->getTileByRef(tiles[i]);
+        if (tile)
+            _cachedTilesMemory -= tile->dataSize;
+        _tileCache->removeTile(tiles[i], nullptr, nullptr);
+    }
+    Stats.CachedTilesMemory = _cachedTilesMemory;
+
+    // Remove built navmesh tiles for all layers at that location
+    const dtMeshTile* meshTiles[NAV_MESH_TILE_CACHE_MAX_LAYERS];
+    dtTileRef meshTilesRefs[NAV_MESH_TILE_CACHE_MAX_LAYERS];
+    const int32 meshTilesCount = ((const dtNavMesh*)_navMesh)->getTilesAt(x, y, meshTiles, NAV_MESH_TILE_CACHE_MAX_LAYERS);
+    for (int32 i = 0; i < meshTilesCount; i++)
+        meshTilesRefs[i] = _navMesh->getTileRef(meshTiles[i]);
+    for (int32 i = 0; i < meshTilesCount; i++)
+        _navMesh->removeTile(meshTilesRefs[i], nullptr, nullptr);
+
+    _links.Remove(GetTileKey(x, y));
+}
+
+void NavMeshTileCache::AddObstacle(uint32 id, const NavMeshObstacle& obstacle)
+{
+    if (AddObstacleInternal(id, obstacle))
+    {
+        // Requests queue is full so retry on the next update
+        _pendingAdds[id] = obstacle;
+    }
+    Stats.ObstaclesCount = _obstacles.Count() + _pendingAdds.Count();
+}
+
+void NavMeshTileCache::RemoveObstacle(uint32 id)
+{
+    uint32 ref;
+    if (_obstacles.TryGet(id, ref))
+    {
+        _obstacles.Remove(id);
+        if (dtStatusFailed(_tileCache->removeObstacle(ref)))
+            _pendingRemoves.Add(ref);
+        _isDirty = true;
+    }
+    else
+    {
+        _pendingAdds.Remove(id);
+    }
+    Stats.ObstaclesCount = _obstacles.Count() + _pendingAdds.Count();
+}
+
+void NavMeshTileCache::Update(float timeBudgetMs)
+{
+    Stats.LastFrameTileUpdates = 0;
+    Stats.LastFrameUpdateTimeMs = 0.0f;
+
+    // Flush requests that didn't fit into the tile cache requests queue
+    for (int32 i = 0; i < _pendingRemoves.Count(); i++)
+    {
+        if (dtStatusFailed(_tileCache->removeObstacle(_pendingRemoves[i])))
+            break;
+        _pendingRemoves.RemoveAtKeepOrder(i--);
+        _isDirty = true;
+    }
+    for (auto i = _pendingAdds.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (AddObstacleInternal(i->Key, i->Value))
+            break;
+        _pendingAdds.Remove(i);
+    }
+    if (!_isDirty)
+        return;
+    PROFILE_CPU_NAMED("NavMeshTileCache.Update");
+
+    // Rebuild the tiles touched by the obstacles (each update call rebuilds a single tile)
+    const double startTime = Platform::GetTimeSeconds();
+    bool upToDate = false;
+    while (!upToDate)
+    {
+        const double tileStartTime = Platform::GetTimeSeconds();
+        const dtStatus status = _tileCache->update(0.0f, _navMesh, &upToDate);
+        const double tileEndTime = Platform::GetTimeSeconds();
+        if (dtStatusFailed(status))
+        {
+            LOG(Warning, "Failed to update navmesh {0} tile cache (error: {1}).", _runtime->Properties.Name, status & ~DT_FAILURE);
+        }
+
+        const float tileUpdateTimeMs = (float)((tileEndTime - tileStartTime) * 1000.0);
+        Stats.LastFrameTileUpdates++;
+        Stats.TotalTileUpdates++;
+        Stats.MaxTileUpdateTimeMs = Math::Max(Stats.MaxTileUpdateTimeMs, tileUpdateTimeMs);
+        _totalTileUpdatesTimeMs += tileUpdateTimeMs;
+        if ((tileEndTime - startTime) * 1000.0 >= timeBudgetMs)
+            break;
+    }
+    _isDirty = !upToDate || _pendingRemoves.HasItems() || _pendingAdds.HasItems();
+    Stats.LastFrameUpdateTimeMs = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    Stats.AverageTileUpdateTimeMs = Stats.TotalTileUpdates != 0 ? _totalTileUpdatesTimeMs / (float)Stats.TotalTileUpdates : 0.0f;
+}
+
+uint64 NavMeshTileCache::GetTileKey(int32 x, int32 y)
+{
+    return ((uint64)(uint32)x << 32) | (uint64)(uint32)y;
+}
+
+bool NavMeshTileCache::AddObstacleInternal(uint32 id, const NavMeshObstacle& obstacle)
+{
+    // Transform obstacle into the navmesh space and inflate it by the agent radius (tile cache layers are already eroded)
+    const auto& properties = _runtime->Properties;
+    const float agentRadius = properties.Agent.Radius;
+    Float3 position;
+    Float3::Transform(obstacle.Position, properties.Rotation, position);
+    dtObstacleRef ref = 0;
+    dtStatus status;
+    switch (obstacle.Type)
+    {
+    case NavMeshObstacleType::Cylinder:
+        status = _tileCache->addObstacle(&position.X, obstacle.Radius + agentRadius, obstacle.Height, &ref);
+        break;
+    case NavMeshObstacleType::Box:
+    {
+        const Float3 halfExtents = obstacle.Extents + Float3(agentRadius, 0.0f, agentRadius);
+        const float yaw = (properties.Rotation * obstacle.Orientation).GetEuler().Y * DegreesToRadians;
+        status = _tileCache->addBoxObstacle(&position.X, &halfExtents.X, yaw, &ref);
+        break;
+    }
+    default:
+        return false;
+    }
+    if (dtStatusFailed(status))
+    {
+        if (dtStatusDetail(status, DT_BUFFER_TOO_SMALL))
+            return true;
+        LOG(Warning, "Failed to add obstacle to navmesh {0} tile cache (error: {1}).", properties.Name, status & ~DT_FAILURE);
+        return false;
+    }
+    _obstacles[id] = ref;
+    _isDirty = true;
+    return false;
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "NavigationTypes.h"
+#include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+class dtNavMesh;
+class dtTileCache;
+class NavMeshRuntime;
+struct dtTileCacheCompressor;
+struct NavMeshTileCacheAllocator;
+struct NavMeshTileCacheMeshProcess;
+
+// The maximum amount of the heightfield layers stored per navmesh tile in the tile cache
+#define NAV_MESH_TILE_CACHE_MAX_LAYERS 4
+
+/// <summary>
+/// The header of the navmesh tile cache data (stored per tile in NavMeshTileData::CacheData).
+/// </summary>
+struct NavMeshTileCacheHeader
+{
+    int32 Version;
+    int32 LayersCount;
+    int32 LinksCount;
+};
+
+/// <summary>
+/// The off-mesh link stored within the navmesh tile cache data (links are not a part of the compressed heightfield layers so they are added to the tiles when building them from the cache).
+/// </summary>
+struct NavMeshTileCacheLink
+{
+    Float3 Start;
+    Float3 End;
+    float Radius;
+    uint32 Id;
+    int32 BiDir;
+};
+
+/// <summary>
+/// The types of the navmesh dynamic obstacles.
+/// </summary>
+enum class NavMeshObstacleType
+{
+    // Vertical cylinder (defined by the bottom center position, radius and height).
+    Cylinder,
+    // Box (defined by the center position, half-extents and orientation - only rotation around up axis is used).
+    Box,
+};
+
+/// <summary>
+/// The navmesh dynamic obstacle descriptor (in world-space).
+/// </summary>
+struct NavMeshObstacle
+{
+    NavMeshObstacleType Type;
+    Vector3 Position;
+    Float3 Extents;
+    float Radius;
+    float Height;
+    Quaternion Orientation;
+};
+
+/// <summary>
+/// The navmesh tiles cache that stores the compressed heightfield layers for the tiles and allows to quickly rebuild the tiles affected by the dynamic obstacles (without rasterizing scene geometry again).
+/// </summary>
+class NavMeshTileCache
+{
+private:
+    NavMeshRuntime* _runtime;
+    dtNavMesh* _navMesh;
+    dtTileCache* _tileCache;
+    NavMeshTileCacheAllocator* _allocator;
+    NavMeshTileCacheMeshProcess* _meshProcess;
+    Dictionary<uint64, Array<NavMeshTileCacheLink>> _links;
+    Dictionary<uint32, uint32> _obstacles;
+    Dictionary<uint32, NavMeshObstacle> _pendingAdds;
+    Array<uint32> _pendingRemoves;
+    bool _isDirty;
+    int32 _cachedTilesMemory;
+    float _totalTileUpdatesTimeMs;
+
+public:
+    NavMeshTileCache(NavMeshRuntime* runtime);
+    ~NavMeshTileCache();
+
+public:
+    /// <summary>
+    /// The tile cache statistics.
+    /// </summary>
+    NavMeshTileCacheStats Stats;
+
+    /// <summary>
+    /// Gets the compressor used to pack the tile cache layers data.
+    /// </summary>
+    static dtTileCacheCompressor* GetCompressor();
+
+    /// <summary>
+    /// Writes the tile cache data (header, off-mesh links and compressed layers).
+    /// </summary>
+    /// <param name="result">The output data container.</param>
+    /// <param name="links">The tile off-mesh links.</param>
+    /// <param name="layers">The compressed heightfield layers of the tile.</param>
+    static void WriteData(BytesContainer& result, const Array<NavMeshTileCacheLink>& links, const Array<BytesContainer>& layers);
+
+public:
+    /// <summary>
+    /// Initializes the tile cache for the given navmesh.
+    /// </summary>
+    /// <param name="navMesh">The Detour navmesh to update with the tile cache.</param>
+    /// <param name="maxTiles">The maximum amount of tiles (locations).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Init(dtNavMesh* navMesh, int32 maxTiles);
+
+    /// <summary>
+    /// Adds the tile compressed layers to the cache and builds the navmesh tiles at that location (including all active obstacles).
+    /// </summary>
+    /// <param name="x">The tile X coordinate.</param>
+    /// <param name="y">The tile Y coordinate.</param>
+    /// <param name="cacheData">The tile cache data.</param>
+    /// <param name="obstacles">The registered obstacles (the ones overlapping the tile are refreshed to affect the new tile).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool AddTile(int32 x, int32 y, const BytesContainer& cacheData, const Dictionary<uint32, NavMeshObstacle>& obstacles);
+
+    /// <summary>
+    /// Removes the tile layers from the cache and the navmesh.
+    /// </summary>
+    /// <param name="x">The tile X coordinate.</param>
+    /// <param name="y">The tile Y coordinate.</param>
+    void RemoveTile(int32 x, int32 y);
+
+    /// <summary>
+    /// Adds the dynamic obstacle. Obstacles that don't fit into the tile cache requests queue are added during the next Update.
+    /// </summary>
+    /// <param name="id">The obstacle unique identifier.</param>
+    /// <param name="obstacle">The obstacle descriptor (in world-space).</param>
+    void AddObstacle(uint32 id, const NavMeshObstacle& obstacle);
+
+    /// <summary>
+    /// Removes the dynamic obstacle.
+    /// </summary>
+    /// <param name="id">The obstacle unique identifier.</param>
+    void RemoveObstacle(uint32 id);
+
+    /// <summary>
+    /// Processes the pending obstacles changes and rebuilds the affected navmesh tiles (within a time budget).
+    /// </summary>
+    /// <param name="timeBudgetMs">The time budget (in milliseconds). At least one tile is always processed.</param>
+    void Update(float timeBudgetMs);
+
+private:
+    friend struct NavMeshTileCacheMeshProcess;
+    static uint64 GetTileKey(int32 x, int32 y);
+    bool AddObstacleInternal(uint32 id, const NavMeshObstacle& obstacle);
+};
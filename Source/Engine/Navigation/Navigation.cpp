@@ -5,6 +5,7 @@
 #include "NavMeshRuntime.h"
 #include "NavMeshBuilder.h"
 #include "Engine/Core/Config/GameSettings.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Threading/Threading.h"
@@ -23,6 +24,9 @@
 namespace
 {
     Array<NavMeshRuntime*, InlinedAllocation<16>> NavMeshes;
+    CriticalSection ObstaclesLocker;
+    Dictionary<uint32, NavMeshObstacle> Obstacles;
+    uint32 ObstaclesIdCounter = 0;
 }
 
 NavMeshRuntime* NavMeshRuntime::Get()
@@ -93,6 +97,11 @@ NavMeshRuntime* NavMeshRuntime::Get(const NavMeshProperties& navMeshProperties,
         // Create a new navmesh
         result = New<NavMeshRuntime>(navMeshProperties);
         NavMeshes.Add(result);
+
+        // Register existing dynamic obstacles
+        ScopeLock lock(ObstaclesLocker);
+        for (auto& e : Obstacles)
+            result->AddObstacle(e.Key, e.Value);
     }
     return result;
 }
@@ -166,9 +175,7 @@ class NavigationService : public EngineService
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
     void Dispose() override;
 };
 
@@ -235,6 +242,9 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(MaxEdgeError);
     DESERIALIZE(DetailSamplingDist);
     DESERIALIZE(MaxDetailSamplingError);
+    DESERIALIZE(EnableDynamicObstacles);
+    DESERIALIZE(MaxDynamicObstacles);
+    DESERIALIZE(DynamicObstaclesUpdateBudget);
     if (modifier->EngineBuild >= 6215)
     {
         DESERIALIZE(NavMeshes);
@@ -270,15 +280,25 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
-}
-
 #endif
 
+    // Update navmeshes affected by the dynamic obstacles (skip if obstacles were never used)
+    ObstaclesLocker.Lock();
+    const bool anyObstacles = ObstaclesIdCounter != 0;
+    ObstaclesLocker.Unlock();
+    if (anyObstacles)
+    {
+        PROFILE_CPU_NAMED("Navigation.UpdateTileCache");
+        const float timeBudgetMs = NavigationSettings::Get()->DynamicObstaclesUpdateBudget;
+        for (auto navMesh : NavMeshes)
+            navMesh->UpdateTileCache(timeBudgetMs);
+    }
+}
+
 void NavigationService::Dispose()
 {
     // Release nav meshes
@@ -289,6 +309,8 @@ void NavigationService::Dispose()
     }
     NavMeshes.Clear();
     NavMeshes.ClearDelete();
+    ScopeLock lock(ObstaclesLocker);
+    Obstacles.Clear();
 }
 
 bool Navigation::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance)
@@ -340,6 +362,68 @@ bool Navigation::RayCast(const Vector3& startPosition, const Vector3& endPositio
     return NavMeshes.First()->RayCast(startPosition, endPosition, hitInfo);
 }
 
+uint32 Navigation::AddCylinderObstacle(const Vector3& position, float radius, float height)
+{
+    NavMeshObstacle obstacle;
+    obstacle.Type = NavMeshObstacleType::Cylinder;
+    obstacle.Position = position;
+    obstacle.Extents = Float3::Zero;
+    obstacle.Radius = radius;
+    obstacle.Height = height;
+    obstacle.Orientation = Quaternion::Identity;
+    ScopeLock lock(ObstaclesLocker);
+    const uint32 id = ++ObstaclesIdCounter;
+    Obstacles.Add(id, obstacle);
+    for (auto navMesh : NavMeshes)
+        navMesh->AddObstacle(id, obstacle);
+    return id;
+}
+
+uint32 Navigation::AddBoxObstacle(const OrientedBoundingBox& box)
+{
+    NavMeshObstacle obstacle;
+    obstacle.Type = NavMeshObstacleType::Box;
+    obstacle.Position = box.Transformation.Translation;
+    obstacle.Extents = box.Extents * box.Transformation.Scale;
+    obstacle.Radius = 0.0f;
+    obstacle.Height = 0.0f;
+    obstacle.Orientation = box.Transformation.Orientation;
+    ScopeLock lock(ObstaclesLocker);
+    const uint32 id = ++ObstaclesIdCounter;
+    Obstacles.Add(id, obstacle);
+    for (auto navMesh : NavMeshes)
+        navMesh->AddObstacle(id, obstacle);
+    return id;
+}
+
+void Navigation::RemoveObstacle(uint32 obstacleId)
+{
+    ScopeLock lock(ObstaclesLocker);
+    if (!Obstacles.Remove(obstacleId))
+        return;
+    for (auto navMesh : NavMeshes)
+        navMesh->RemoveObstacle(obstacleId);
+}
+
+NavMeshTileCacheStats Navigation::GetTileCacheStats()
+{
+    NavMeshTileCacheStats result;
+    Platform::MemoryClear(&result, sizeof(result));
+    for (auto navMesh : NavMeshes)
+    {
+        const NavMeshTileCacheStats stats = navMesh->GetTileCacheStats();
+        result.ObstaclesCount = Math::Max(result.ObstaclesCount, stats.ObstaclesCount);
+        result.CachedTilesCount += stats.CachedTilesCount;
+        result.CachedTilesMemory += stats.CachedTilesMemory;
+        result.LastFrameTileUpdates += stats.LastFrameTileUpdates;
+        result.TotalTileUpdates += stats.TotalTileUpdates;
+        result.LastFrameUpdateTimeMs += stats.LastFrameUpdateTimeMs;
+        result.AverageTileUpdateTimeMs = Math::Max(result.AverageTileUpdateTimeMs, stats.AverageTileUpdateTimeMs);
+        result.MaxTileUpdateTimeMs = Math::Max(result.MaxTileUpdateTimeMs, stats.MaxTileUpdateTimeMs);
+    }
+    return result;
+}
+
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
 bool Navigation::IsBuildingNavMesh()
@@ -5,6 +5,7 @@
 #include "NavigationTypes.h"
 
 class Scene;
+struct OrientedBoundingBox;
 
 /// <summary>
 /// The navigation service used for path finding and agents navigation system.
@@ -72,6 +73,40 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo);
 
+public:
+    /// <summary>
+    /// Adds the cylinder-shaped dynamic obstacle that blocks the navmesh (eg. moving prop or destructible). Affects only navmeshes built with dynamic obstacles enabled (see Navigation Settings).
+    /// </summary>
+    /// <remarks>
+    /// Affected navmesh tiles are updated from the compressed tile cache during the next game update (without rasterizing scene geometry again). Use RemoveObstacle to remove it or re-add to move it.
+    /// </remarks>
+    /// <param name="position">The obstacle position (bottom center of the cylinder) in world-space.</param>
+    /// <param name="radius">The obstacle radius.</param>
+    /// <param name="height">The obstacle height.</param>
+    /// <returns>The obstacle identifier.</returns>
+    API_FUNCTION() static uint32 AddCylinderObstacle(const Vector3& position, float radius, float height);
+
+    /// <summary>
+    /// Adds the box-shaped dynamic obstacle that blocks the navmesh (eg. closed door). Affects only navmeshes built with dynamic obstacles enabled (see Navigation Settings).
+    /// </summary>
+    /// <remarks>
+    /// Only rotation around up axis is used for the obstacle box. Affected navmesh tiles are updated from the compressed tile cache during the next game update (without rasterizing scene geometry again).
+    /// </remarks>
+    /// <param name="box">The obstacle box in world-space.</param>
+    /// <returns>The obstacle identifier.</returns>
+    API_FUNCTION() static uint32 AddBoxObstacle(const OrientedBoundingBox& box);
+
+    /// <summary>
+    /// Removes the dynamic obstacle.
+    /// </summary>
+    /// <param name="obstacleId">The obstacle identifier.</param>
+    API_FUNCTION() static void RemoveObstacle(uint32 obstacleId);
+
+    /// <summary>
+    /// Gets the dynamic obstacles tile cache statistics (accumulated for all navmeshes). Can be used to measure tiles update latency.
+    /// </summary>
+    API_FUNCTION() static NavMeshTileCacheStats GetTileCacheStats();
+
 public:
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
@@ -80,6 +80,25 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="Limit(0, 3), EditorOrder(290), EditorDisplay(\"Nav Mesh Options\")")
     float MaxDetailSamplingError = 1.0f;
 
+public:
+    /// <summary>
+    /// If checked, navmesh building will store the compressed heightfield layers for each tile so the navmesh can be locally updated at runtime by dynamic obstacles (eg. doors or destructibles) without full tiles rebuild. Increases the navmesh data size. Requires Tile Size to be lower than 256.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), EditorDisplay(\"Dynamic Obstacles\")")
+    bool EnableDynamicObstacles = false;
+
+    /// <summary>
+    /// The maximum amount of dynamic obstacles that can exist at once in a single navmesh.
+    /// </summary>
+    API_FIELD(Attributes="Limit(1, 65535), EditorOrder(410), EditorDisplay(\"Dynamic Obstacles\")")
+    int32 MaxDynamicObstacles = 1024;
+
+    /// <summary>
+    /// The time budget (in milliseconds) for the navmesh tiles updating caused by the dynamic obstacles changes (per frame). At least one tile is always updated each frame if needed.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0, 100, 0.1f), EditorOrder(420), EditorDisplay(\"Dynamic Obstacles\")")
+    float DynamicObstaclesUpdateBudget = 1.0f;
+
 public:
     /// <summary>
     /// The configuration for navmeshes.
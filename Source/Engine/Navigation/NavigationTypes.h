@@ -156,6 +156,54 @@ API_STRUCT() struct FLAXENGINE_API NavMeshHit
     API_FIELD() Vector3 Normal;
 };
 
+/// <summary>
+/// The navigation mesh dynamic obstacles (tile cache) statistics.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API NavMeshTileCacheStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NavMeshTileCacheStats);
+
+    /// <summary>
+    /// The amount of the registered dynamic obstacles.
+    /// </summary>
+    API_FIELD() int32 ObstaclesCount;
+
+    /// <summary>
+    /// The amount of the navmesh tiles with compressed layers data that can be updated by the obstacles.
+    /// </summary>
+    API_FIELD() int32 CachedTilesCount;
+
+    /// <summary>
+    /// The total amount of the memory (in bytes) used by the compressed tiles layers.
+    /// </summary>
+    API_FIELD() int32 CachedTilesMemory;
+
+    /// <summary>
+    /// The amount of tile updates performed during the last frame.
+    /// </summary>
+    API_FIELD() int32 LastFrameTileUpdates;
+
+    /// <summary>
+    /// The total amount of tile updates performed since the start.
+    /// </summary>
+    API_FIELD() uint64 TotalTileUpdates;
+
+    /// <summary>
+    /// The time (in milliseconds) spent on tiles updating during the last frame.
+    /// </summary>
+    API_FIELD() float LastFrameUpdateTimeMs;
+
+    /// <summary>
+    /// The average time (in milliseconds) of a single tile update.
+    /// </summary>
+    API_FIELD() float AverageTileUpdateTimeMs;
+
+    /// <summary>
+    /// The maximum time (in milliseconds) of a single tile update.
+    /// </summary>
+    API_FIELD() float MaxTileUpdateTimeMs;
+};
+
 /// <summary>
 /// The navigation area properties container for navmesh building and navigation runtime.
 /// </summary>
@@ -0,0 +1,341 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "LoopbackDriver.h"
+#include "Engine/Networking/NetworkConfig.h"
+#include "Engine/Networking/NetworkChannelType.h"
+#include "Engine/Networking/NetworkEvent.h"
+#include "Engine/Networking/NetworkPeer.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/Threading.h"
+#undef SendMessage
+
+namespace
+{
+    // All loopback drivers share a single lock so peers can be used from different threads
+    CriticalSection Locker;
+    Dictionary<String, LoopbackDriver*> Servers;
+
+    String GetServerKey(const String& address, uint16 port)
+    {
+        return String::Format(TEXT("{0}:{1}"), address, port);
+    }
+
+    bool IsOrdered(const NetworkChannelType channelType)
+    {
+        return channelType == NetworkChannelType::UnreliableOrdered || channelType == NetworkChannelType::ReliableOrdered;
+    }
+
+    bool IsReliable(const NetworkChannelType channelType)
+    {
+        return channelType > NetworkChannelType::UnreliableOrdered;
+    }
+}
+
+Function<double()> LoopbackDriver::TimeSource;
+
+LoopbackDriver::LoopbackDriver(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+bool LoopbackDriver::Initialize(NetworkPeer* host, const NetworkConfig& config)
+{
+    _networkHost = host;
+    _config = config;
+    _isServer = false;
+    _connectionsCounter = 0;
+    _inboxStart = 0;
+    _random.Initialize(Seed);
+
+    LOG(Info, "Initialized Loopback driver");
+    return false;
+}
+
+void LoopbackDriver::Dispose()
+{
+    ScopeLock lock(Locker);
+
+    if (_isServer)
+    {
+        const String key = GetServerKey(_config.Address, _config.Port);
+        LoopbackDriver* server;
+        if (Servers.TryGet(key, server) && server == this)
+            Servers.Remove(key);
+    }
+    for (auto& e : _links)
+    {
+        Link& link = e.Value;
+        link.Remote->_links.Remove(link.RemoteConnectionId);
+        link.Remote->Enqueue(NetworkEventType::Disconnected, link.RemoteConnectionId, nullptr, GetTime());
+    }
+    _links.Clear();
+    ClearInbox();
+    ClearBuffers();
+    _isServer = false;
+
+    LOG(Info, "Loopback driver stopped!");
+}
+
+bool LoopbackDriver::Listen()
+{
+    ScopeLock lock(Locker);
+
+    const String key = GetServerKey(_config.Address, _config.Port);
+    if (Servers.ContainsKey(key))
+    {
+        LOG(Error, "Failed to create Loopback server! Address {0} is already in use.", key);
+        return false;
+    }
+    Servers.Add(key, this);
+    _isServer = true;
+
+    LOG(Info, "Created Loopback server!");
+    return true;
+}
+
+bool LoopbackDriver::Connect()
+{
+    LOG(Info, "Connecting using Loopback...");
+    ScopeLock lock(Locker);
+
+    // Find the server (listening either on the given address or on any address)
+    LoopbackDriver* server = nullptr;
+    if (!Servers.TryGet(GetServerKey(_config.Address, _config.Port), server))
+        Servers.TryGet(GetServerKey(TEXT("any"), _config.Port), server);
+    if (server == nullptr)
+    {
+        LOG(Error, "Failed to connect using Loopback! Server at {0}:{1} not found.", _config.Address, _config.Port);
+        return false;
+    }
+    if (server->_links.Count() >= server->_config.ConnectionsLimit)
+    {
+        LOG(Error, "Failed to connect using Loopback! Server connections limit reached.");
+        return false;
+    }
+
+    // Link both peers (client sees the server as the connection 0)
+    const uint32 connectionId = ++server->_connectionsCounter;
+    const double now = GetTime();
+    server->_links.Add(connectionId, Link{ this, 0, now, now });
+    _links.Add(0, Link{ server, connectionId, now, now });
+
+    // Simulate the handshake
+    const double deliveryTime = now + (Latency + server->Latency) * 0.001;
+    server->Enqueue(NetworkEventType::Connected, connectionId, nullptr, deliveryTime);
+    Enqueue(NetworkEventType::Connected, 0, nullptr, deliveryTime);
+    return true;
+}
+
+void LoopbackDriver::Disconnect()
+{
+    ScopeLock lock(Locker);
+
+    Link* link = _links.TryGet(0);
+    if (link)
+    {
+        DisconnectLink(0, *link);
+
+        LOG(Info, "Disconnected");
+    }
+}
+
+void LoopbackDriver::Disconnect(const NetworkConnection& connection)
+{
+    ScopeLock lock(Locker);
+
+    Link* link = _links.TryGet(connection.ConnectionId);
+    if (link)
+    {
+        DisconnectLink(connection.ConnectionId, *link);
+    }
+    else
+    {
+        LOG(Error, "Failed to kick connection({0}). Loopback connection not found!", connection.ConnectionId);
+    }
+}
+
+bool LoopbackDriver::PopEvent(NetworkEvent* eventPtr)
+{
+    ScopeLock lock(Locker);
+
+    if (_inboxStart == _inbox.Count())
+        return false; // No events
+    const Packet& packet = _inbox[_inboxStart];
+    if (packet.DeliveryTime > GetTime())
+        return false; // Still in-flight
+
+    NetworkMessage message;
+    if (packet.EventType == NetworkEventType::Message)
+    {
+        // Message is taken from the pool only on delivery so in-flight packets don't hold the pooled messages
+        if (_networkHost->MessagePool.IsEmpty())
+            return false; // Wait for the peer to recycle the received messages
+        message = _networkHost->CreateMessage();
+        message.Length = packet.Length;
+        Platform::MemoryCopy(message.Buffer, packet.Data, packet.Length);
+        _buffers.Add(packet.Data);
+        ReceivedMessages++;
+        ReceivedBytes += packet.Length;
+    }
+    eventPtr->EventType = packet.EventType;
+    eventPtr->Sender = NetworkConnection();
+    eventPtr->Sender.ConnectionId = packet.ConnectionId;
+    eventPtr->Message = message;
+
+    // Packets are consumed from the front, compact the queue once the consumed part dominates it
+    _inboxStart++;
+    if (_inboxStart == _inbox.Count())
+    {
+        _inbox.Clear();
+        _inboxStart = 0;
+    }
+    else if (_inboxStart >= 256 && _inboxStart * 2 >= _inbox.Count())
+    {
+        const int32 count = _inbox.Count() - _inboxStart;
+        for (int32 i = 0; i < count; i++)
+            _inbox[i] = _inbox[_inboxStart + i];
+        _inbox.Resize(count);
+        _inboxStart = 0;
+    }
+    return true; // Event
+}
+
+void LoopbackDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message)
+{
+    ASSERT(IsServer() == false);
+    ScopeLock lock(Locker);
+
+    Link* link = _links.TryGet(0);
+    if (link)
+        SendToLink(*link, channelType, message);
+}
+
+void LoopbackDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target)
+{
+    ASSERT(IsServer());
+    ScopeLock lock(Locker);
+
+    Link* link = _links.TryGet(target.ConnectionId);
+    ASSERT(link != nullptr);
+    SendToLink(*link, channelType, message);
+}
+
+void LoopbackDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets)
+{
+    ASSERT(IsServer());
+    ScopeLock lock(Locker);
+
+    for (NetworkConnection target : targets)
+    {
+        Link* link = _links.TryGet(target.ConnectionId);
+        ASSERT(link != nullptr);
+        SendToLink(*link, channelType, message);
+    }
+}
+
+double LoopbackDriver::GetTime()
+{
+    return TimeSource.IsBinded() ? TimeSource() : Platform::GetTimeSeconds();
+}
+
+double LoopbackDriver::GetDeliveryTime(Link& link, const NetworkChannelType channelType, const uint32 size)
+{
+    double time = GetTime();
+
+    // Messages are serialized on the connection when bandwidth is limited
+    if (Bandwidth > 0)
+    {
+        time = Math::Max(time, link.BandwidthTime) + (double)size / Bandwidth;
+        link.BandwidthTime = time;
+    }
+
+    time += (Latency + _random.GetFraction() * Jitter) * 0.001;
+
+    // Ordered channels cannot overtake the previous messages
+    if (IsOrdered(channelType))
+    {
+        time = Math::Max(time, link.OrderedDeliveryTime);
+        link.OrderedDeliveryTime = time;
+    }
+    return time;
+}
+
+void LoopbackDriver::SendToLink(Link& link, const NetworkChannelType channelType, const NetworkMessage& message)
+{
+    SentMessages++;
+    SentBytes += message.Length;
+
+    if (!IsReliable(channelType) && PacketLoss > 0.0f && _random.GetFraction() < PacketLoss)
+    {
+        DroppedMessages++;
+        return;
+    }
+
+    if (message.Length > link.Remote->_config.MessageSize)
+    {
+        // Receiver cannot store the data
+        LOG(Warning, "Loopback message dropped. Message size {0} exceeds the receiver message size {1}.", message.Length, link.Remote->_config.MessageSize);
+        DroppedMessages++;
+        return;
+    }
+
+    const double deliveryTime = GetDeliveryTime(link, channelType, message.Length);
+    link.Remote->Enqueue(NetworkEventType::Message, link.RemoteConnectionId, &message, deliveryTime);
+}
+
+void LoopbackDriver::Enqueue(const NetworkEventType eventType, const uint32 connectionId, const NetworkMessage* message, const double deliveryTime)
+{
+    Packet packet;
+    packet.EventType = eventType;
+    packet.ConnectionId = connectionId;
+    packet.DeliveryTime = deliveryTime;
+    packet.Data = nullptr;
+    packet.Length = 0;
+    if (message)
+    {
+        // Copy message data into the buffer owned by the driver (called from the sender thread so the receiver messages pool cannot be used here)
+        if (_buffers.HasItems())
+            packet.Data = _buffers.Pop();
+        else
+            packet.Data = (byte*)Allocator::Allocate(_config.MessageSize);
+        packet.Length = message->Length;
+        Platform::MemoryCopy(packet.Data, message->Buffer, message->Length);
+    }
+
+    // Keep the queue sorted by the delivery time (new packets usually go to the end)
+    int32 index = _inbox.Count();
+    while (index > _inboxStart && _inbox[index - 1].DeliveryTime > deliveryTime)
+        index--;
+    _inbox.Insert(index, packet);
+}
+
+void LoopbackDriver::DisconnectLink(const uint32 connectionId, Link& link)
+{
+    LoopbackDriver* remote = link.Remote;
+    const uint32 remoteConnectionId = link.RemoteConnectionId;
+    _links.Remove(connectionId);
+    remote->_links.Remove(remoteConnectionId);
+    remote->Enqueue(NetworkEventType::Disconnected, remoteConnectionId, nullptr, GetTime() + Latency * 0.001);
+}
+
+void LoopbackDriver::ClearInbox()
+{
+    for (int32 i = _inboxStart; i < _inbox.Count(); i++)
+    {
+        const Packet& packet = _inbox[i];
+        if (packet.Data)
+            _buffers.Add(packet.Data);
+    }
+    _inbox.Clear();
+    _inboxStart = 0;
+}
+
+void LoopbackDriver::ClearBuffers()
+{
+    for (byte* buffer : _buffers)
+        Allocator::Free(buffer);
+    _buffers.Clear();
+}
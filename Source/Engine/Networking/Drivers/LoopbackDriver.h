@@ -0,0 +1,142 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Networking/Types.h"
+#include "Engine/Networking/INetworkDriver.h"
+#include "Engine/Networking/NetworkConnection.h"
+#include "Engine/Networking/NetworkConfig.h"
+#include "Engine/Networking/NetworkEvent.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Low-level network transport interface implementation that exchanges messages in-memory between the peers within the same process (no sockets are used).
+/// Supports simulating the network conditions (latency, jitter, packets loss and bandwidth) which makes it useful for testing and deterministic benchmarking of the networking code.
+/// </summary>
+/// <remarks>Server and clients are matched by the Address and Port from the <seealso cref="NetworkConfig"/> structure.</remarks>
+API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API LoopbackDriver : public ScriptingObject, public INetworkDriver
+{
+    DECLARE_SCRIPTING_TYPE(LoopbackDriver);
+public:
+    /// <summary>
+    /// The simulated one-way latency (in milliseconds) of the messages sent by this peer.
+    /// </summary>
+    API_FIELD() float Latency = 0.0f;
+
+    /// <summary>
+    /// The simulated maximum random delay (in milliseconds) added to the latency of the messages sent by this peer. Unordered messages can arrive out-of-order.
+    /// </summary>
+    API_FIELD() float Jitter = 0.0f;
+
+    /// <summary>
+    /// The simulated packets loss probability (in range 0-1) of the messages sent by this peer over the unreliable channels.
+    /// </summary>
+    API_FIELD() float PacketLoss = 0.0f;
+
+    /// <summary>
+    /// The simulated outgoing bandwidth limit (in bytes per second) of each connection of this peer. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() int32 Bandwidth = 0;
+
+    /// <summary>
+    /// The seed of the random numbers generator used to simulate jitter and packets loss. The same seed produces the same sequence of simulated conditions.
+    /// </summary>
+    API_FIELD() int32 Seed = 0;
+
+public:
+    /// <summary>
+    /// The total amount of messages sent by this peer (including the lost ones).
+    /// </summary>
+    API_FIELD(ReadOnly) uint64 SentMessages = 0;
+
+    /// <summary>
+    /// The total amount of bytes sent by this peer (including the lost messages).
+    /// </summary>
+    API_FIELD(ReadOnly) uint64 SentBytes = 0;
+
+    /// <summary>
+    /// The total amount of messages received by this peer.
+    /// </summary>
+    API_FIELD(ReadOnly) uint64 ReceivedMessages = 0;
+
+    /// <summary>
+    /// The total amount of bytes received by this peer.
+    /// </summary>
+    API_FIELD(ReadOnly) uint64 ReceivedBytes = 0;
+
+    /// <summary>
+    /// The total amount of messages sent by this peer that were lost (simulated packet loss or message larger than the receiver message size).
+    /// </summary>
+    API_FIELD(ReadOnly) uint64 DroppedMessages = 0;
+
+public:
+    /// <summary>
+    /// The custom clock (returns time in seconds) used by all loopback drivers to simulate the network conditions. Unbound by default which uses the platform time. Can be used to step the simulation deterministically (eg. in tests).
+    /// </summary>
+    static Function<double()> TimeSource;
+
+public:
+    // [INetworkDriver]
+    String DriverName() override
+    {
+        return String("LoopbackDriver");
+    }
+
+    bool Initialize(NetworkPeer* host, const NetworkConfig& config) override;
+    void Dispose() override;
+    bool Listen() override;
+    bool Connect() override;
+    void Disconnect() override;
+    void Disconnect(const NetworkConnection& connection) override;
+    bool PopEvent(NetworkEvent* eventPtr) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets) override;
+
+private:
+    struct Packet
+    {
+        NetworkEventType EventType;
+        uint32 ConnectionId;
+        byte* Data;
+        uint32 Length;
+        double DeliveryTime;
+    };
+
+    struct Link
+    {
+        LoopbackDriver* Remote;
+        uint32 RemoteConnectionId;
+        double BandwidthTime;
+        double OrderedDeliveryTime;
+    };
+
+    bool IsServer() const
+    {
+        return _isServer;
+    }
+
+    static double GetTime();
+    double GetDeliveryTime(Link& link, NetworkChannelType channelType, uint32 size);
+    void SendToLink(Link& link, NetworkChannelType channelType, const NetworkMessage& message);
+    void Enqueue(NetworkEventType eventType, uint32 connectionId, const NetworkMessage* message, double deliveryTime);
+    void DisconnectLink(uint32 connectionId, Link& link);
+    void ClearInbox();
+    void ClearBuffers();
+
+private:
+    NetworkConfig _config;
+    NetworkPeer* _networkHost = nullptr;
+    bool _isServer = false;
+    uint32 _connectionsCounter = 0;
+    Dictionary<uint32, Link> _links;
+    Array<Packet> _inbox;
+    int32 _inboxStart = 0;
+    Array<byte*> _buffers;
+    RandomStream _random;
+};
@@ -18,6 +18,7 @@ public void WriteBytes(byte* bytes, int length)
             Assert.IsTrue(Position + length <= BufferSize, $"Could not write data of length {length} into message with id={MessageId}! Current write position={Position}");
             Utils.MemoryCopy(new IntPtr(Buffer + Position), new IntPtr(bytes), (ulong)length);
             Position += (uint)length;
+            BitPosition = 0;
             Length = Position;
         }
 
@@ -34,6 +35,7 @@ public void ReadBytes(byte* buffer, int length)
             Assert.IsTrue(Position + length <= Length, $"Could not read data of length {length} from message with id={MessageId} and size of {Length}B! Current read position={Position}");
             Utils.MemoryCopy(new IntPtr(buffer), new IntPtr(Buffer + Position), (ulong)length);
             Position += (uint)length;
+            BitPosition = 0;
         }
 
         /// <summary>
@@ -383,5 +385,292 @@ public bool ReadBoolean()
             ReadBytes((byte*)&value, sizeof(bool));
             return value;
         }
+
+        /// <summary>
+        /// Writes the lowest bits of the value into the message (bit-packed).
+        /// </summary>
+        /// <param name="value">The value to write.</param>
+        /// <param name="numBits">The amount of bits to write (1-32).</param>
+        public void WriteBits(uint value, int numBits)
+        {
+            // Note: Make sure that this is consistent with the C++ message API!
+            Assert.IsTrue(numBits > 0 && numBits <= 32, $"Invalid bits count {numBits}.");
+            while (numBits > 0)
+            {
+                if (BitPosition == 0)
+                {
+                    Assert.IsTrue(Position < BufferSize, $"Could not write bits into message with id={MessageId}! Current write position={Position}");
+                    Buffer[Position++] = 0;
+                }
+                var count = Math.Min(numBits, 8 - (int)BitPosition);
+                Buffer[Position - 1] |= (byte)((value & ((1u << count) - 1)) << (int)BitPosition);
+                value >>= count;
+                numBits -= count;
+                BitPosition = (BitPosition + (uint)count) & 7;
+            }
+            Length = Position;
+        }
+
+        /// <summary>
+        /// Reads the bits from the message (bit-packed).
+        /// </summary>
+        /// <param name="numBits">The amount of bits to read (1-32).</param>
+        /// <returns>The value.</returns>
+        public uint ReadBits(int numBits)
+        {
+            // Note: Make sure that this is consistent with the C++ message API!
+            Assert.IsTrue(numBits > 0 && numBits <= 32, $"Invalid bits count {numBits}.");
+            uint result = 0;
+            int shift = 0;
+            while (numBits > 0)
+            {
+                if (BitPosition == 0)
+                {
+                    Assert.IsTrue(Position < Length, $"Could not read bits from message with id={MessageId} and size of {Length}B! Current read position={Position}");
+                    Position++;
+                }
+                var count = Math.Min(numBits, 8 - (int)BitPosition);
+                result |= (uint)((Buffer[Position - 1] >> (int)BitPosition) & ((1 << count) - 1)) << shift;
+                shift += count;
+                numBits -= count;
+                BitPosition = (BitPosition + (uint)count) & 7;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Writes a single bit into the message (bit-packed).
+        /// </summary>
+        public void WriteBit(bool value)
+        {
+            WriteBits(value ? 1u : 0u, 1);
+        }
+
+        /// <summary>
+        /// Reads a single bit from the message (bit-packed).
+        /// </summary>
+        public bool ReadBit()
+        {
+            return ReadBits(1) != 0;
+        }
+
+        /// <summary>
+        /// Gets the amount of bits required to store the given value.
+        /// </summary>
+        public static int GetBitsCount(uint value)
+        {
+            int result = 0;
+            while (value != 0)
+            {
+                value >>= 1;
+                result++;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Writes the integer from the given range using the minimal amount of bits (bit-packed). Use it for enums, counters, etc.
+        /// </summary>
+        /// <param name="value">The value to write (clamped into range).</param>
+        /// <param name="min">The minimum value (inclusive).</param>
+        /// <param name="max">The maximum value (inclusive).</param>
+        public void WriteRangedInt32(int value, int min, int max)
+        {
+            var numBits = GetBitsCount(unchecked((uint)max - (uint)min));
+            if (numBits != 0)
+                WriteBits(unchecked((uint)Mathf.Clamp(value, min, max) - (uint)min), numBits);
+        }
+
+        /// <summary>
+        /// Reads the integer from the given range written with <see cref="WriteRangedInt32"/> (bit-packed).
+        /// </summary>
+        /// <param name="min">The minimum value (inclusive).</param>
+        /// <param name="max">The maximum value (inclusive).</param>
+        public int ReadRangedInt32(int min, int max)
+        {
+            var numBits = GetBitsCount(unchecked((uint)max - (uint)min));
+            return numBits != 0 ? unchecked((int)(ReadBits(numBits) + (uint)min)) : min;
+        }
+
+        /// <summary>
+        /// Writes the floating-point value quantized within the given range (bit-packed). The precision is (max - min) / (2^numBits - 1).
+        /// </summary>
+        /// <param name="value">The value to write (clamped into range).</param>
+        /// <param name="min">The minimum value.</param>
+        /// <param name="max">The maximum value.</param>
+        /// <param name="numBits">The amount of bits to use (1-32).</param>
+        public void WriteQuantizedSingle(float value, float min, float max, int numBits)
+        {
+            var maxValue = numBits == 32 ? uint.MaxValue : (1u << numBits) - 1;
+            var alpha = Mathf.Saturate(((double)value - min) / ((double)max - min));
+            WriteBits((uint)(alpha * maxValue + 0.5), numBits);
+        }
+
+        /// <summary>
+        /// Reads the floating-point value written with <see cref="WriteQuantizedSingle"/> (bit-packed).
+        /// </summary>
+        /// <param name="min">The minimum value.</param>
+        /// <param name="max">The maximum value.</param>
+        /// <param name="numBits">The amount of bits to use (1-32).</param>
+        public float ReadQuantizedSingle(float min, float max, int numBits)
+        {
+            var maxValue = numBits == 32 ? uint.MaxValue : (1u << numBits) - 1;
+            return (float)(min + ((double)max - min) * ((double)ReadBits(numBits) / maxValue));
+        }
+
+        /// <summary>
+        /// Writes the vector quantized within the given bounds (bit-packed).
+        /// </summary>
+        /// <param name="value">The value to write (clamped into bounds).</param>
+        /// <param name="min">The bounds minimum.</param>
+        /// <param name="max">The bounds maximum.</param>
+        /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+        public void WriteQuantizedVector3(Vector3 value, Vector3 min, Vector3 max, int numBits)
+        {
+            for (int i = 0; i < 3; i++)
+                WriteQuantizedSingle((float)value[i], (float)min[i], (float)max[i], numBits);
+        }
+
+        /// <summary>
+        /// Reads the vector written with <see cref="WriteQuantizedVector3"/> (bit-packed).
+        /// </summary>
+        /// <param name="min">The bounds minimum.</param>
+        /// <param name="max">The bounds maximum.</param>
+        /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+        public Vector3 ReadQuantizedVector3(Vector3 min, Vector3 max, int numBits)
+        {
+            var result = new Vector3();
+            for (int i = 0; i < 3; i++)
+                result[i] = ReadQuantizedSingle((float)min[i], (float)max[i], numBits);
+            return result;
+        }
+
+        /// <summary>
+        /// Writes the normalized quaternion using the smallest-three encoding (bit-packed): index of the largest component (2 bits) and the remaining three components quantized (3 * numBits).
+        /// </summary>
+        /// <param name="value">The value to write (must be normalized).</param>
+        /// <param name="numBits">The amount of bits to use per component (1-32). 10 bits gives error below 0.1 degree.</param>
+        public void WriteQuaternionSmallestThree(Quaternion value, int numBits = 10)
+        {
+            // Note: Make sure that this is consistent with the C++ message API!
+            int largest = 0;
+            for (int i = 1; i < 4; i++)
+            {
+                if (Mathf.Abs(value[i]) > Mathf.Abs(value[largest]))
+                    largest = i;
+            }
+            var sign = value[largest] < 0.0f ? -1.0f : 1.0f;
+            WriteBits((uint)largest, 2);
+            for (int i = 0; i < 4; i++)
+            {
+                if (i != largest)
+                    WriteQuantizedSingle(value[i] * sign, -0.70710678118f, 0.70710678118f, numBits);
+            }
+        }
+
+        /// <summary>
+        /// Reads the quaternion written with <see cref="WriteQuaternionSmallestThree"/> (bit-packed).
+        /// </summary>
+        /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+        public Quaternion ReadQuaternionSmallestThree(int numBits = 10)
+        {
+            var result = new Quaternion();
+            var largest = (int)ReadBits(2);
+            var sum = 0.0f;
+            for (int i = 0; i < 4; i++)
+            {
+                if (i != largest)
+                {
+                    var component = ReadQuantizedSingle(-0.70710678118f, 0.70710678118f, numBits);
+                    result[i] = component;
+                    sum += component * component;
+                }
+            }
+            result[largest] = Mathf.Sqrt(Mathf.Max(1.0f - sum, 0.0f));
+            return result;
+        }
+
+        /// <summary>
+        /// Writes the integer as a delta against the baseline value (known to the receiver) using a variable amount of bits (bit-packed). Unchanged value takes a single bit.
+        /// </summary>
+        /// <param name="value">The value to write.</param>
+        /// <param name="baseline">The baseline value.</param>
+        public void WriteDeltaInt32(int value, int baseline)
+        {
+            // Zig-zag encoding keeps small negative deltas small
+            var delta = unchecked(value - baseline);
+            var encoded = unchecked((uint)(delta << 1) ^ (uint)(delta >> 31));
+            WriteBit(encoded != 0);
+            if (encoded != 0)
+            {
+                var numBits = GetBitsCount(encoded);
+                WriteBits((uint)numBits - 1, 5);
+                WriteBits(encoded, numBits);
+            }
+        }
+
+        /// <summary>
+        /// Reads the integer written with <see cref="WriteDeltaInt32"/> (bit-packed).
+        /// </summary>
+        /// <param name="baseline">The baseline value.</param>
+        public int ReadDeltaInt32(int baseline)
+        {
+            if (!ReadBit())
+                return baseline;
+            var numBits = (int)ReadBits(5) + 1;
+            var encoded = ReadBits(numBits);
+            var delta = unchecked((int)(encoded >> 1) ^ -(int)(encoded & 1));
+            return unchecked(baseline + delta);
+        }
+
+        /// <summary>
+        /// Writes the vector as a quantized delta against the baseline value (known to the receiver) (bit-packed). Unchanged components take a single bit each.
+        /// </summary>
+        /// <remarks>To prevent error accumulation, use the baseline reconstructed the same way as the receiver does (eg. the last acknowledged value read back with <see cref="ReadDeltaVector3"/>).</remarks>
+        /// <param name="value">The value to write.</param>
+        /// <param name="baseline">The baseline value.</param>
+        /// <param name="precision">The quantization step (eg. 0.01 for centimeter precision in meters units).</param>
+        public void WriteDeltaVector3(Vector3 value, Vector3 baseline, float precision)
+        {
+            for (int i = 0; i < 3; i++)
+                WriteDeltaInt32(Mathf.RoundToInt((float)(value[i] - baseline[i]) / precision), 0);
+        }
+
+        /// <summary>
+        /// Reads the vector written with <see cref="WriteDeltaVector3"/> (bit-packed).
+        /// </summary>
+        /// <param name="baseline">The baseline value.</param>
+        /// <param name="precision">The quantization step.</param>
+        public Vector3 ReadDeltaVector3(Vector3 baseline, float precision)
+        {
+            var result = new Vector3();
+            for (int i = 0; i < 3; i++)
+                result[i] = baseline[i] + ReadDeltaInt32(0) * precision;
+            return result;
+        }
+
+        /// <summary>
+        /// Writes the quaternion as a delta against the baseline value (bit-packed). Unchanged value takes a single bit, otherwise it's written with <see cref="WriteQuaternionSmallestThree"/>.
+        /// </summary>
+        /// <param name="value">The value to write (must be normalized).</param>
+        /// <param name="baseline">The baseline value.</param>
+        /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+        public void WriteDeltaQuaternion(Quaternion value, Quaternion baseline, int numBits = 10)
+        {
+            var changed = Mathf.Abs(Quaternion.Dot(value, baseline)) < 1.0f - Mathf.Epsilon;
+            WriteBit(changed);
+            if (changed)
+                WriteQuaternionSmallestThree(value, numBits);
+        }
+
+        /// <summary>
+        /// Reads the quaternion written with <see cref="WriteDeltaQuaternion"/> (bit-packed).
+        /// </summary>
+        /// <param name="baseline">The baseline value.</param>
+        /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+        public Quaternion ReadDeltaQuaternion(Quaternion baseline, int numBits = 10)
+        {
+            return ReadBit() ? ReadQuaternionSmallestThree(numBits) : baseline;
+        }
     }
 }
@@ -41,6 +41,11 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkMessa
     /// </summary>
     API_FIELD() uint32 Position = 0;
 
+    /// <summary>
+    /// The amount of bits already used in the last byte (at Position - 1) by the bit-level read/write. Zero if the stream is byte-aligned. Byte-level read/write always starts from the next whole byte.
+    /// </summary>
+    API_FIELD() uint32 BitPosition = 0;
+
 public:
     /// <summary>
     /// Initializes default values of the <seealso cref="NetworkMessage"/> structure.
@@ -56,6 +61,7 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkMessa
         , BufferSize(bufferSize)
         , Length(length)
         , Position(position)
+        , BitPosition(0)
     {
     }
 
@@ -72,6 +78,7 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkMessa
         ASSERT(Position + numBytes < BufferSize);
         Platform::MemoryCopy(Buffer + Position, bytes, numBytes);
         Position += numBytes;
+        BitPosition = 0;
         Length = Position;
     }
 
@@ -88,6 +95,7 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkMessa
         ASSERT(Position + numBytes < BufferSize);
         Platform::MemoryCopy(bytes, Buffer + Position, numBytes);
         Position += numBytes;
+        BitPosition = 0;
     }
 
 #define DECL_READWRITE(type, name) \
@@ -218,6 +226,287 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkMessa
         return value;
     }
 
+public:
+    /// <summary>
+    /// Writes the lowest bits of the value into the message (bit-packed).
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="numBits">The amount of bits to write (1-32).</param>
+    FORCE_INLINE void WriteBits(uint32 value, int32 numBits)
+    {
+        ASSERT(numBits > 0 && numBits <= 32);
+        while (numBits > 0)
+        {
+            if (BitPosition == 0)
+            {
+                ASSERT(Position < BufferSize);
+                Buffer[Position++] = 0;
+            }
+            const int32 count = Math::Min(numBits, 8 - (int32)BitPosition);
+            Buffer[Position - 1] |= (uint8)((value & ((1u << count) - 1)) << BitPosition);
+            value >>= count;
+            numBits -= count;
+            BitPosition = (BitPosition + count) & 7;
+        }
+        Length = Position;
+    }
+
+    /// <summary>
+    /// Reads the bits from the message (bit-packed).
+    /// </summary>
+    /// <param name="numBits">The amount of bits to read (1-32).</param>
+    /// <returns>The value.</returns>
+    FORCE_INLINE uint32 ReadBits(int32 numBits)
+    {
+        ASSERT(numBits > 0 && numBits <= 32);
+        uint32 result = 0;
+        int32 shift = 0;
+        while (numBits > 0)
+        {
+            if (BitPosition == 0)
+            {
+                ASSERT(Position < BufferSize);
+                Position++;
+            }
+            const int32 count = Math::Min(numBits, 8 - (int32)BitPosition);
+            result |= (uint32)((Buffer[Position - 1] >> BitPosition) & ((1u << count) - 1)) << shift;
+            shift += count;
+            numBits -= count;
+            BitPosition = (BitPosition + count) & 7;
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Writes a single bit into the message (bit-packed).
+    /// </summary>
+    FORCE_INLINE void WriteBit(bool value)
+    {
+        WriteBits(value ? 1 : 0, 1);
+    }
+
+    /// <summary>
+    /// Reads a single bit from the message (bit-packed).
+    /// </summary>
+    FORCE_INLINE bool ReadBit()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    /// <summary>
+    /// Gets the amount of bits required to store the given value.
+    /// </summary>
+    static int32 GetBitsCount(uint32 value)
+    {
+        return value == 0 ? 0 : (int32)Math::FloorLog2(value) + 1;
+    }
+
+    /// <summary>
+    /// Writes the integer from the given range using the minimal amount of bits (bit-packed). Use it for enums, counters, etc.
+    /// </summary>
+    /// <param name="value">The value to write (clamped into range).</param>
+    /// <param name="min">The minimum value (inclusive).</param>
+    /// <param name="max">The maximum value (inclusive).</param>
+    FORCE_INLINE void WriteRangedInt32(int32 value, int32 min, int32 max)
+    {
+        ASSERT(min <= max);
+        const int32 numBits = GetBitsCount((uint32)max - (uint32)min);
+        if (numBits != 0)
+            WriteBits((uint32)Math::Clamp(value, min, max) - (uint32)min, numBits);
+    }
+
+    /// <summary>
+    /// Reads the integer from the given range written with <see cref="WriteRangedInt32"/> (bit-packed).
+    /// </summary>
+    /// <param name="min">The minimum value (inclusive).</param>
+    /// <param name="max">The maximum value (inclusive).</param>
+    FORCE_INLINE int32 ReadRangedInt32(int32 min, int32 max)
+    {
+        ASSERT(min <= max);
+        const int32 numBits = GetBitsCount((uint32)max - (uint32)min);
+        return numBits != 0 ? (int32)(ReadBits(numBits) + (uint32)min) : min;
+    }
+
+    /// <summary>
+    /// Writes the floating-point value quantized within the given range (bit-packed). The precision is (max - min) / (2^numBits - 1).
+    /// </summary>
+    /// <param name="value">The value to write (clamped into range).</param>
+    /// <param name="min">The minimum value.</param>
+    /// <param name="max">The maximum value.</param>
+    /// <param name="numBits">The amount of bits to use (1-32).</param>
+    FORCE_INLINE void WriteQuantizedSingle(float value, float min, float max, int32 numBits)
+    {
+        const uint32 maxValue = numBits == 32 ? MAX_uint32 : (1u << numBits) - 1;
+        const double alpha = Math::Saturate(((double)value - min) / ((double)max - min));
+        WriteBits((uint32)(alpha * maxValue + 0.5), numBits);
+    }
+
+    /// <summary>
+    /// Reads the floating-point value written with <see cref="WriteQuantizedSingle"/> (bit-packed).
+    /// </summary>
+    /// <param name="min">The minimum value.</param>
+    /// <param name="max">The maximum value.</param>
+    /// <param name="numBits">The amount of bits to use (1-32).</param>
+    FORCE_INLINE float ReadQuantizedSingle(float min, float max, int32 numBits)
+    {
+        const uint32 maxValue = numBits == 32 ? MAX_uint32 : (1u << numBits) - 1;
+        return (float)(min + ((double)max - min) * ((double)ReadBits(numBits) / maxValue));
+    }
+
+    /// <summary>
+    /// Writes the vector quantized within the given bounds (bit-packed).
+    /// </summary>
+    /// <param name="value">The value to write (clamped into bounds).</param>
+    /// <param name="min">The bounds minimum.</param>
+    /// <param name="max">The bounds maximum.</param>
+    /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+    FORCE_INLINE void WriteQuantizedVector3(const Vector3& value, const Vector3& min, const Vector3& max, int32 numBits)
+    {
+        for (int32 i = 0; i < 3; i++)
+            WriteQuantizedSingle((float)value.Raw[i], (float)min.Raw[i], (float)max.Raw[i], numBits);
+    }
+
+    /// <summary>
+    /// Reads the vector written with <see cref="WriteQuantizedVector3"/> (bit-packed).
+    /// </summary>
+    /// <param name="min">The bounds minimum.</param>
+    /// <param name="max">The bounds maximum.</param>
+    /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+    FORCE_INLINE Vector3 ReadQuantizedVector3(const Vector3& min, const Vector3& max, int32 numBits)
+    {
+        Vector3 result;
+        for (int32 i = 0; i < 3; i++)
+            result.Raw[i] = ReadQuantizedSingle((float)min.Raw[i], (float)max.Raw[i], numBits);
+        return result;
+    }
+
+    /// <summary>
+    /// Writes the normalized quaternion using the smallest-three encoding (bit-packed): index of the largest component (2 bits) and the remaining three components quantized (3 * numBits).
+    /// </summary>
+    /// <param name="value">The value to write (must be normalized).</param>
+    /// <param name="numBits">The amount of bits to use per component (1-32). 10 bits gives error below 0.1 degree.</param>
+    void WriteQuaternionSmallestThree(const Quaternion& value, int32 numBits = 10)
+    {
+        int32 largest = 0;
+        for (int32 i = 1; i < 4; i++)
+        {
+            if (Math::Abs(value.Raw[i]) > Math::Abs(value.Raw[largest]))
+                largest = i;
+        }
+        const float sign = value.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+        WriteBits(largest, 2);
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (i != largest)
+                WriteQuantizedSingle(value.Raw[i] * sign, -0.70710678118f, 0.70710678118f, numBits);
+        }
+    }
+
+    /// <summary>
+    /// Reads the quaternion written with <see cref="WriteQuaternionSmallestThree"/> (bit-packed).
+    /// </summary>
+    /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+    Quaternion ReadQuaternionSmallestThree(int32 numBits = 10)
+    {
+        Quaternion result;
+        const int32 largest = (int32)ReadBits(2);
+        float sum = 0.0f;
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (i != largest)
+            {
+                const float component = ReadQuantizedSingle(-0.70710678118f, 0.70710678118f, numBits);
+                result.Raw[i] = component;
+                sum += component * component;
+            }
+        }
+        result.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sum, 0.0f));
+        return result;
+    }
+
+    /// <summary>
+    /// Writes the integer as a delta against the baseline value (known to the receiver) using a variable amount of bits (bit-packed). Unchanged value takes a single bit.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="baseline">The baseline value.</param>
+    FORCE_INLINE void WriteDeltaInt32(int32 value, int32 baseline)
+    {
+        // Zig-zag encoding keeps small negative deltas small
+        const int32 delta = (int32)((uint32)value - (uint32)baseline);
+        const uint32 encoded = ((uint32)delta << 1) ^ (uint32)(delta >> 31);
+        WriteBit(encoded != 0);
+        if (encoded != 0)
+        {
+            const int32 numBits = GetBitsCount(encoded);
+            WriteBits(numBits - 1, 5);
+            WriteBits(encoded, numBits);
+        }
+    }
+
+    /// <summary>
+    /// Reads the integer written with <see cref="WriteDeltaInt32"/> (bit-packed).
+    /// </summary>
+    /// <param name="baseline">The baseline value.</param>
+    FORCE_INLINE int32 ReadDeltaInt32(int32 baseline)
+    {
+        if (!ReadBit())
+            return baseline;
+        const int32 numBits = (int32)ReadBits(5) + 1;
+        const uint32 encoded = ReadBits(numBits);
+        const int32 delta = (int32)(encoded >> 1) ^ -(int32)(encoded & 1);
+        return (int32)((uint32)baseline + (uint32)delta);
+    }
+
+    /// <summary>
+    /// Writes the vector as a quantized delta against the baseline value (known to the receiver) (bit-packed). Unchanged components take a single bit each.
+    /// </summary>
+    /// <remarks>To prevent error accumulation, use the baseline reconstructed the same way as the receiver does (eg. the last acknowledged value read back with <see cref="ReadDeltaVector3"/>).</remarks>
+    /// <param name="value">The value to write.</param>
+    /// <param name="baseline">The baseline value.</param>
+    /// <param name="precision">The quantization step (eg. 0.01 for centimeter precision in meters units).</param>
+    FORCE_INLINE void WriteDeltaVector3(const Vector3& value, const Vector3& baseline, float precision)
+    {
+        for (int32 i = 0; i < 3; i++)
+            WriteDeltaInt32(Math::RoundToInt((float)(value.Raw[i] - baseline.Raw[i]) / precision), 0);
+    }
+
+    /// <summary>
+    /// Reads the vector written with <see cref="WriteDeltaVector3"/> (bit-packed).
+    /// </summary>
+    /// <param name="baseline">The baseline value.</param>
+    /// <param name="precision">The quantization step.</param>
+    FORCE_INLINE Vector3 ReadDeltaVector3(const Vector3& baseline, float precision)
+    {
+        Vector3 result;
+        for (int32 i = 0; i < 3; i++)
+            result.Raw[i] = baseline.Raw[i] + (Real)ReadDeltaInt32(0) * precision;
+        return result;
+    }
+
+    /// <summary>
+    /// Writes the quaternion as a delta against the baseline value (bit-packed). Unchanged value takes a single bit, otherwise it's written with <see cref="WriteQuaternionSmallestThree"/>.
+    /// </summary>
+    /// <param name="value">The value to write (must be normalized).</param>
+    /// <param name="baseline">The baseline value.</param>
+    /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+    FORCE_INLINE void WriteDeltaQuaternion(const Quaternion& value, const Quaternion& baseline, int32 numBits = 10)
+    {
+        const bool changed = Math::Abs(Quaternion::Dot(value, baseline)) < 1.0f - ZeroTolerance;
+        WriteBit(changed);
+        if (changed)
+            WriteQuaternionSmallestThree(value, numBits);
+    }
+
+    /// <summary>
+    /// Reads the quaternion written with <see cref="WriteDeltaQuaternion"/> (bit-packed).
+    /// </summary>
+    /// <param name="baseline">The baseline value.</param>
+    /// <param name="numBits">The amount of bits to use per component (1-32).</param>
+    FORCE_INLINE Quaternion ReadDeltaQuaternion(const Quaternion& baseline, int32 numBits = 10)
+    {
+        return ReadBit() ? ReadQuaternionSmallestThree(numBits) : baseline;
+    }
+
 public:
     /// <summary>
     /// Returns true if the message is valid for reading or writing.
@@ -0,0 +1,597 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "NetworkReplicator.h"
+#include "NetworkPeer.h"
+#include "NetworkMessage.h"
+#include "NetworkChannelType.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Scripting/Script.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
+
+namespace
+{
+    enum EntryFlags : uint8
+    {
+        HasObjectId = 1,
+        IsDelta = 2,
+    };
+
+    struct SerializerEntry
+    {
+        ScriptingTypeHandle Type;
+        NetworkReplicator::SerializeFunc Serialize;
+        NetworkReplicator::SerializeFunc Deserialize;
+    };
+
+    void SerializeActor(ScriptingObject* obj, NetworkMessage& message)
+    {
+        const Transform& transform = ((Actor*)obj)->GetTransform();
+        message.WriteVector3(transform.Translation);
+        message.WriteQuaternion(transform.Orientation);
+        message.WriteVector3(transform.Scale);
+    }
+
+    void DeserializeActor(ScriptingObject* obj, NetworkMessage& message)
+    {
+        Transform transform;
+        transform.Translation = message.ReadVector3();
+        transform.Orientation = message.ReadQuaternion();
+        transform.Scale = message.ReadVector3();
+        ((Actor*)obj)->SetTransform(transform);
+    }
+
+    Array<SerializerEntry>& GetSerializers()
+    {
+        static Array<SerializerEntry> serializers;
+        if (serializers.IsEmpty())
+        {
+            auto& e = serializers.AddOne();
+            e.Type = Actor::TypeInitializer;
+            e.Serialize.Bind<SerializeActor>();
+            e.Deserialize.Bind<DeserializeActor>();
+        }
+        return serializers;
+    }
+
+    int32 FindSerializer(ScriptingObject* obj)
+    {
+        // Last registered serializers are more specific
+        const auto& serializers = GetSerializers();
+        for (int32 i = serializers.Count() - 1; i >= 0; i--)
+        {
+            if (obj->Is(serializers[i].Type))
+                return i;
+        }
+        return -1;
+    }
+
+    bool GetObjectPosition(ScriptingObject* obj, Vector3& position)
+    {
+        if (const auto actor = ScriptingObject::Cast<Actor>(obj))
+        {
+            position = actor->GetPosition();
+            return true;
+        }
+        if (const auto script = ScriptingObject::Cast<Script>(obj))
+        {
+            if (script->GetActor())
+            {
+                position = script->GetActor()->GetPosition();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    FORCE_INLINE uint64 GetCellKey(int32 x, int32 z)
+    {
+        return ((uint64)(uint32)x << 32) | (uint64)(uint32)z;
+    }
+
+    uint32 GetRemainingBits(const NetworkMessage& message)
+    {
+        if (message.Position > message.Length)
+            return 0;
+        return (message.Length - message.Position) * 8 + (message.BitPosition != 0 ? 8 - message.BitPosition : 0);
+    }
+}
+
+NetworkReplicator::NetworkReplicator(NetworkPeer* peer, bool isServer)
+    : _peer(peer)
+    , _isServer(isServer)
+{
+}
+
+NetworkReplicator::~NetworkReplicator()
+{
+    _clients.ClearDelete();
+}
+
+void NetworkReplicator::AddSerializer(const ScriptingTypeHandle& type, const SerializeFunc& serialize, const SerializeFunc& deserialize)
+{
+    auto& e = GetSerializers().AddOne();
+    e.Type = type;
+    e.Serialize = serialize;
+    e.Deserialize = deserialize;
+}
+
+bool NetworkReplicator::AddObject(ScriptingObject* obj, float priority)
+{
+    ASSERT(_isServer);
+    if (!obj || _objectsMap.ContainsKey(obj->GetID()))
+        return true;
+    const int32 serializer = FindSerializer(obj);
+    if (serializer == -1)
+    {
+        LOG(Warning, "Cannot replicate object {0}. Missing serializer for type {1}.", obj->GetID(), String(obj->GetType().Fullname));
+        return true;
+    }
+
+    int32 index;
+    if (_freeObjects.HasItems())
+    {
+        index = _freeObjects.Pop();
+    }
+    else
+    {
+        index = _objects.Count();
+        _objects.AddOne();
+    }
+    auto& e = _objects[index];
+    e.Object = obj;
+    e.ObjectId = obj->GetID();
+    e.NetId = ++_netIdCounter;
+    e.Serializer = serializer;
+    e.Priority = priority;
+    e.HasPosition = false;
+    e.State.Clear();
+    _objectsMap.Add(e.ObjectId, index);
+    return false;
+}
+
+void NetworkReplicator::RemoveObject(ScriptingObject* obj)
+{
+    ASSERT(_isServer);
+    int32 index;
+    if (!obj || !_objectsMap.TryGet(obj->GetID(), index))
+        return;
+    _objectsMap.Remove(obj->GetID());
+    auto& e = _objects[index];
+    e.Object = nullptr;
+    e.NetId = 0;
+    e.State.Clear();
+    _freeObjects.Add(index);
+}
+
+void NetworkReplicator::AddClient(const NetworkConnection& connection)
+{
+    ASSERT(_isServer);
+    if (GetClient(connection))
+        return;
+    auto client = New<Client>();
+    client->Connection = connection;
+    _clients.Add(client);
+}
+
+void NetworkReplicator::RemoveClient(const NetworkConnection& connection)
+{
+    ASSERT(_isServer);
+    auto client = GetClient(connection);
+    if (client)
+    {
+        _clients.Remove(client);
+        Delete(client);
+    }
+}
+
+void NetworkReplicator::SetClientViewer(const NetworkConnection& connection, const Vector3& position)
+{
+    ASSERT(_isServer);
+    auto client = GetClient(connection);
+    if (client)
+    {
+        client->HasViewer = true;
+        client->Viewer = position;
+    }
+}
+
+void NetworkReplicator::Update(float deltaTime)
+{
+    ASSERT(_isServer);
+    PROFILE_CPU_NAMED("NetworkReplicator.Update");
+    PROFILE_MEM(Networking);
+    _snapshotId++;
+
+    // Take objects state snapshot
+    const auto& serializers = GetSerializers();
+    for (int32 index = 0; index < _objects.Count(); index++)
+    {
+        auto& e = _objects[index];
+        if (e.NetId == 0)
+            continue;
+        ScriptingObject* obj = e.Object.Get();
+        if (!obj)
+        {
+            // Object has been deleted
+            _objectsMap.Remove(e.ObjectId);
+            e.NetId = 0;
+            e.State.Clear();
+            _freeObjects.Add(index);
+            continue;
+        }
+        NetworkMessage state(_scratch, 0, NETWORK_REPLICATOR_MAX_STATE_SIZE, 0, 0);
+        serializers[e.Serializer].Serialize(obj, state);
+        e.State.Set(state.Buffer, (int32)state.Length);
+        e.HasPosition = GetObjectPosition(obj, e.Position);
+    }
+
+    // Build the spatial interest grid
+    for (auto& cell : _grid)
+        cell.Value.Clear();
+    _alwaysRelevant.Clear();
+    const float cellSize = Math::Max(Settings.InterestCellSize, 1.0f);
+    for (int32 index = 0; index < _objects.Count(); index++)
+    {
+        const auto& e = _objects[index];
+        if (e.NetId == 0)
+            continue;
+        if (e.HasPosition)
+        {
+            const uint64 key = GetCellKey(Math::FloorToInt((float)e.Position.X / cellSize), Math::FloorToInt((float)e.Position.Z / cellSize));
+            _grid[key].Add(index);
+        }
+        else
+        {
+            _alwaysRelevant.Add(index);
+        }
+    }
+
+    // Send snapshot to every client
+    for (Client* client : _clients)
+        SendSnapshot(client, deltaTime);
+}
+
+bool NetworkReplicator::ProcessMessage(NetworkMessage& message, const NetworkConnection& sender)
+{
+    if (message.Length == 0)
+        return false;
+    const uint32 position = message.Position;
+    const auto type = (NetworkReplicatorMessageType)message.ReadUInt8();
+    if (type == NetworkReplicatorMessageType::Snapshot && !_isServer)
+    {
+        ReceiveSnapshot(message);
+        return true;
+    }
+    if (type == NetworkReplicatorMessageType::Ack && _isServer)
+    {
+        ReceiveAck(message, sender);
+        return true;
+    }
+    message.Position = position;
+    return false;
+}
+
+NetworkReplicator::Client* NetworkReplicator::GetClient(const NetworkConnection& connection) const
+{
+    for (Client* client : _clients)
+    {
+        if (client->Connection.ConnectionId == connection.ConnectionId)
+            return client;
+    }
+    return nullptr;
+}
+
+void NetworkReplicator::GatherCandidates(Client* client)
+{
+    _candidates.Clear();
+    if (client->Objects.Count() < _objects.Count())
+        client->Objects.Resize(_objects.Count());
+
+    // Gather relevant objects using the interest grid around the viewer
+    const auto addCandidate = [this, client](int32 index, float relevance)
+    {
+        const auto& e = _objects[index];
+        auto& co = client->Objects[index];
+        if (co.NetId != e.NetId)
+        {
+            // Object slot has been reused
+            co = ClientObject();
+            co.NetId = e.NetId;
+        }
+        if (co.BaselineSnapshot != 0 && co.Baseline.Count() == e.State.Count() && Platform::MemoryCompare(co.Baseline.Get(), e.State.Get(), e.State.Count()) == 0)
+        {
+            // Client has already acknowledged the current state
+            co.Accumulator = 0.0f;
+            Stats.SkippedUpToDate++;
+            return;
+        }
+        co.Accumulator += relevance;
+        _candidates.Add({ index, co.Accumulator });
+    };
+    for (const int32 index : _alwaysRelevant)
+        addCandidate(index, _objects[index].Priority);
+    if (client->HasViewer)
+    {
+        const float radius = Settings.InterestRadius;
+        const float cellSize = Math::Max(Settings.InterestCellSize, 1.0f);
+        const int32 minX = Math::FloorToInt(((float)client->Viewer.X - radius) / cellSize);
+        const int32 maxX = Math::FloorToInt(((float)client->Viewer.X + radius) / cellSize);
+        const int32 minZ = Math::FloorToInt(((float)client->Viewer.Z - radius) / cellSize);
+        const int32 maxZ = Math::FloorToInt(((float)client->Viewer.Z + radius) / cellSize);
+        for (int32 x = minX; x <= maxX; x++)
+        {
+            for (int32 z = minZ; z <= maxZ; z++)
+            {
+                const Array<int32>* cell = _grid.TryGet(GetCellKey(x, z));
+                if (!cell)
+                    continue;
+                for (const int32 index : *cell)
+                {
+                    const auto& e = _objects[index];
+                    const float distance = (float)Vector3::Distance(e.Position, client->Viewer);
+                    if (distance < radius)
+                        addCandidate(index, e.Priority * (1.0f - distance / radius));
+                }
+            }
+        }
+    }
+    else
+    {
+        for (auto& cell : _grid)
+        {
+            for (const int32 index : cell.Value)
+                addCandidate(index, _objects[index].Priority);
+        }
+    }
+
+    // Sort by the accumulated priority (objects that were not sent get more important over time)
+    Sorting::QuickSort(_candidates.Get(), _candidates.Count());
+}
+
+int32 NetworkReplicator::WriteEntry(Client* client, int32 index, NetworkMessage& entry)
+{
+    const auto& e = _objects[index];
+    const auto& co = client->Objects[index];
+    const int32 size = e.State.Count();
+
+    // Use delta against the acknowledged state unless client could have evicted it from the history
+    const bool isDelta = co.BaselineSnapshot != 0 && co.Baseline.Count() == size && co.SentCount - co.BaselineSentCount < NETWORK_REPLICATOR_HISTORY_SIZE - 1;
+    uint8 flags = 0;
+    if (co.BaselineSnapshot == 0)
+        flags |= HasObjectId;
+    if (isDelta)
+        flags |= IsDelta;
+    entry.WriteUInt32(e.NetId);
+    entry.WriteUInt8(flags);
+    if (flags & HasObjectId)
+        entry.WriteGuid(e.ObjectId);
+    entry.WriteUInt16((uint16)size);
+    if (isDelta)
+    {
+        // Changed bytes are sent as xor against baseline, unchanged ones take a single bit
+        entry.WriteUInt32(co.BaselineSnapshot);
+        const byte* baseline = co.Baseline.Get();
+        const byte* state = e.State.Get();
+        for (int32 i = 0; i < size; i++)
+        {
+            const byte delta = state[i] ^ baseline[i];
+            entry.WriteBit(delta != 0);
+            if (delta != 0)
+                entry.WriteBits(delta, 8);
+        }
+    }
+    else
+    {
+        entry.WriteBytes((uint8*)e.State.Get(), size);
+    }
+    return isDelta ? 1 : 0;
+}
+
+void NetworkReplicator::SendSnapshot(Client* client, float deltaTime)
+{
+    GatherCandidates(client);
+    if (_candidates.IsEmpty())
+        return;
+
+    // Write as many objects as bandwidth budget allows
+    const int32 budget = Math::Clamp((int32)(Settings.BandwidthBudget * deltaTime), 64, (int32)_peer->Config.MessageSize - 1);
+    NetworkMessage msg = _peer->BeginSendMessage();
+    msg.WriteUInt8((uint8)NetworkReplicatorMessageType::Snapshot);
+    msg.WriteUInt32(_snapshotId);
+    const uint32 countPosition = msg.Position;
+    msg.WriteUInt16(0);
+    uint16 count = 0;
+    SentSnapshot* sent = nullptr;
+    byte* entryBuffer = _scratch + NETWORK_REPLICATOR_MAX_STATE_SIZE;
+    for (const Candidate& candidate : _candidates)
+    {
+        NetworkMessage entry(entryBuffer, 0, NETWORK_REPLICATOR_MAX_STATE_SIZE * 2, 0, 0);
+        const int32 isDelta = WriteEntry(client, candidate.Index, entry);
+        if (msg.Position + entry.Length >= (uint32)budget)
+            continue;
+        msg.WriteBytes(entryBuffer, (int32)entry.Length);
+        count++;
+        Stats.SentObjects++;
+        Stats.SentDeltas += isDelta;
+
+        // Track sent state to update the baseline once client acknowledges the snapshot
+        const auto& e = _objects[candidate.Index];
+        auto& co = client->Objects[candidate.Index];
+        co.Accumulator = 0.0f;
+        co.SentCount++;
+        if (!sent)
+        {
+            sent = &client->InFlight[_snapshotId];
+            sent->Entries.Clear();
+            sent->Data.Clear();
+        }
+        sent->Entries.Add({ candidate.Index, e.NetId, co.SentCount, sent->Data.Count(), e.State.Count() });
+        sent->Data.Add(e.State);
+    }
+    if (count == 0)
+    {
+        _peer->AbortSendMessage(msg);
+        return;
+    }
+    Platform::MemoryCopy(msg.Buffer + countPosition, &count, sizeof(count));
+    Stats.SentSnapshots++;
+    Stats.SentBytes += msg.Length;
+    _peer->EndSendMessage(NetworkChannelType::Unreliable, msg, client->Connection);
+
+    // Forget about old snapshots (treat them as lost)
+    const uint32 maxInFlight = (uint32)Math::Max(Settings.MaxInFlightSnapshots, 1);
+    for (auto i = client->InFlight.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Key + maxInFlight <= _snapshotId)
+            client->InFlight.Remove(i);
+    }
+}
+
+void NetworkReplicator::ReceiveSnapshot(NetworkMessage& message)
+{
+    PROFILE_CPU_NAMED("NetworkReplicator.ReceiveSnapshot");
+    if (GetRemainingBits(message) < (sizeof(uint32) + sizeof(uint16)) * 8)
+    {
+        Stats.RejectedSnapshots++;
+        return;
+    }
+    const uint32 snapshotId = message.ReadUInt32();
+    const uint16 count = message.ReadUInt16();
+    const auto& serializers = GetSerializers();
+    Stats.ReceivedSnapshots++;
+    for (uint16 entryIndex = 0; entryIndex < count; entryIndex++)
+    {
+        // Validate the data received from the network before reading it
+        if (GetRemainingBits(message) < (sizeof(uint32) + sizeof(uint8)) * 8)
+        {
+            Stats.RejectedSnapshots++;
+            return;
+        }
+        const uint32 netId = message.ReadUInt32();
+        const uint8 flags = message.ReadUInt8();
+        const uint32 headerSize = (flags & HasObjectId ? sizeof(Guid) : 0) + sizeof(uint16) + (flags & IsDelta ? sizeof(uint32) : 0);
+        if (GetRemainingBits(message) < headerSize * 8)
+        {
+            Stats.RejectedSnapshots++;
+            return;
+        }
+        RemoteObject& remote = _remoteObjects[netId];
+        if (flags & HasObjectId)
+            remote.ObjectId = message.ReadGuid();
+        const uint16 size = message.ReadUInt16();
+        if (size > NETWORK_REPLICATOR_MAX_STATE_SIZE)
+        {
+            Stats.RejectedSnapshots++;
+            return;
+        }
+        byte* state = _scratch;
+        bool valid = true;
+        if (flags & IsDelta)
+        {
+            // Find the baseline state in history
+            const uint32 baselineSnapshot = message.ReadUInt32();
+            const Array<byte>* baseline = nullptr;
+            for (int32 i = 0; i < NETWORK_REPLICATOR_HISTORY_SIZE; i++)
+            {
+                if (remote.Snapshots[i] == baselineSnapshot && remote.States[i].Count() == size)
+                {
+                    baseline = &remote.States[i];
+                    break;
+                }
+            }
+            valid = baseline != nullptr;
+            for (int32 i = 0; i < size; i++)
+            {
+                if (GetRemainingBits(message) < 1)
+                {
+                    Stats.RejectedSnapshots++;
+                    return;
+                }
+                if (!message.ReadBit())
+                {
+                    if (valid)
+                        state[i] = baseline->At(i);
+                    continue;
+                }
+                if (GetRemainingBits(message) < 8)
+                {
+                    Stats.RejectedSnapshots++;
+                    return;
+                }
+                const byte delta = (byte)message.ReadBits(8);
+                if (valid)
+                    state[i] = baseline->At(i) ^ delta;
+            }
+        }
+        else
+        {
+            if (GetRemainingBits(message) < (uint32)size * 8)
+            {
+                Stats.RejectedSnapshots++;
+                return;
+            }
+            message.ReadBytes(state, size);
+        }
+        if (!valid)
+        {
+            Stats.FailedDeltas++;
+            continue;
+        }
+
+        // Store state in history for the next deltas (even if it's older than the applied one because server can still use it as a baseline)
+        remote.Head = (remote.Head + 1) % NETWORK_REPLICATOR_HISTORY_SIZE;
+        remote.Snapshots[remote.Head] = snapshotId;
+        remote.States[remote.Head].Set(state, size);
+
+        // Skip states older than the already applied one (unreliable snapshots can arrive out of order)
+        if (snapshotId <= remote.AppliedSnapshot)
+        {
+            Stats.StaleObjects++;
+            continue;
+        }
+        remote.AppliedSnapshot = snapshotId;
+        Stats.ReceivedObjects++;
+
+        // Apply state
+        ScriptingObject* obj = Scripting::FindObject(remote.ObjectId);
+        const int32 serializer = obj ? FindSerializer(obj) : -1;
+        if (serializer != -1)
+        {
+            NetworkMessage stateMessage(state, 0, NETWORK_REPLICATOR_MAX_STATE_SIZE, size, 0);
+            serializers[serializer].Deserialize(obj, stateMessage);
+        }
+    }
+
+    // Acknowledge the snapshot
+    NetworkMessage ack = _peer->BeginSendMessage();
+    ack.WriteUInt8((uint8)NetworkReplicatorMessageType::Ack);
+    ack.WriteUInt32(snapshotId);
+    _peer->EndSendMessage(NetworkChannelType::Unreliable, ack);
+}
+
+void NetworkReplicator::ReceiveAck(NetworkMessage& message, const NetworkConnection& sender)
+{
+    const uint32 snapshotId = message.ReadUInt32();
+    Client* client = GetClient(sender);
+    SentSnapshot* sent = client ? client->InFlight.TryGet(snapshotId) : nullptr;
+    if (!sent)
+        return;
+
+    // Promote acknowledged states to the baselines
+    for (const SentEntry& entry : sent->Entries)
+    {
+        auto& co = client->Objects[entry.Index];
+        if (co.NetId == entry.NetId && snapshotId > co.BaselineSnapshot)
+        {
+            co.BaselineSnapshot = snapshotId;
+            co.BaselineSentCount = entry.SentCount;
+            co.Baseline.Set(sent->Data.Get() + entry.Offset, entry.Size);
+        }
+    }
+    client->InFlight.Remove(snapshotId);
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "NetworkConnection.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Scripting/ScriptingObjectReference.h"
+
+// The maximum size (in bytes) of the serialized object state
+#define NETWORK_REPLICATOR_MAX_STATE_SIZE 1024
+
+// The amount of the recent states kept per replicated object on the client to decode deltas (server sends full state if the baseline could be already evicted)
+#define NETWORK_REPLICATOR_HISTORY_SIZE 8
+
+/// <summary>
+/// The network replication message types. Replication messages use the first byte of the message to identify it so the game messages should not start with those values.
+/// </summary>
+enum class NetworkReplicatorMessageType : uint8
+{
+    // Server to client objects state snapshot.
+    Snapshot = 0xF0,
+    // Client to server snapshot acknowledgement.
+    Ack = 0xF1,
+};
+
+/// <summary>
+/// The network replication settings.
+/// </summary>
+struct FLAXENGINE_API NetworkReplicatorSettings
+{
+    /// <summary>
+    /// The outgoing bandwidth budget (in bytes per second) for the replication of a single client connection. Limited by the message size.
+    /// </summary>
+    int32 BandwidthBudget = 64 * 1024;
+
+    /// <summary>
+    /// The radius around the client viewer within which objects are relevant for replication (objects outside it are not replicated to the client).
+    /// </summary>
+    float InterestRadius = 20000.0f;
+
+    /// <summary>
+    /// The size of the spatial grid cell used to find the objects relevant to the client viewer.
+    /// </summary>
+    float InterestCellSize = 5000.0f;
+
+    /// <summary>
+    /// The maximum amount of sent snapshots per client that are waiting for the acknowledgement. Older ones are treated as lost.
+    /// </summary>
+    int32 MaxInFlightSnapshots = 32;
+};
+
+/// <summary>
+/// The network replication statistics.
+/// </summary>
+struct FLAXENGINE_API NetworkReplicatorStats
+{
+    uint64 SentSnapshots = 0;
+    uint64 SentBytes = 0;
+    uint64 SentObjects = 0;
+    uint64 SentDeltas = 0;
+    uint64 SkippedUpToDate = 0;
+    uint64 ReceivedSnapshots = 0;
+    uint64 ReceivedObjects = 0;
+    uint64 FailedDeltas = 0;
+    uint64 StaleObjects = 0;
+    uint64 RejectedSnapshots = 0;
+};
+
+/// <summary>
+/// Server-authoritative objects state replication system. Server takes snapshots of the registered objects state and sends to each client the delta against the state last acknowledged by that client.
+/// Objects are prioritized per-client by relevance (distance to the client viewer and object priority) within the bandwidth budget, and the spatial interest grid is used to skip irrelevant objects.
+/// </summary>
+/// <remarks>
+/// Replicated objects are matched by the object ID so they need to exist on both server and clients (eg. loaded with the scene).
+/// Received messages have to be passed to <see cref="ProcessMessage"/> by the game before processing them as game messages.
+/// </remarks>
+class FLAXENGINE_API NetworkReplicator
+{
+public:
+    /// <summary>
+    /// The object state serialization function (writes or reads the object state to/from the message).
+    /// </summary>
+    typedef Function<void(ScriptingObject*, NetworkMessage&)> SerializeFunc;
+
+private:
+    struct ReplicatedObject
+    {
+        ScriptingObjectReference<ScriptingObject> Object;
+        Guid ObjectId;
+        uint32 NetId;
+        int32 Serializer;
+        float Priority;
+        bool HasPosition;
+        Vector3 Position;
+        Array<byte> State;
+    };
+
+    struct ClientObject
+    {
+        uint32 NetId = 0;
+        uint32 BaselineSnapshot = 0;
+        uint32 SentCount = 0;
+        uint32 BaselineSentCount = 0;
+        float Accumulator = 0.0f;
+        Array<byte> Baseline;
+    };
+
+    struct SentEntry
+    {
+        int32 Index;
+        uint32 NetId;
+        uint32 SentCount;
+        int32 Offset;
+        int32 Size;
+    };
+
+    struct SentSnapshot
+    {
+        Array<SentEntry> Entries;
+        Array<byte> Data;
+    };
+
+    struct Client
+    {
+        NetworkConnection Connection;
+        bool HasViewer = false;
+        Vector3 Viewer = Vector3::Zero;
+        Array<ClientObject> Objects;
+        Dictionary<uint32, SentSnapshot> InFlight;
+    };
+
+    struct RemoteObject
+    {
+        Guid ObjectId;
+        int32 Head = 0;
+        uint32 AppliedSnapshot = 0;
+        uint32 Snapshots[NETWORK_REPLICATOR_HISTORY_SIZE] = {};
+        Array<byte> States[NETWORK_REPLICATOR_HISTORY_SIZE];
+    };
+
+    struct Candidate
+    {
+        int32 Index;
+        float Priority;
+
+        bool operator<(const Candidate& other) const
+        {
+            return Priority > other.Priority;
+        }
+    };
+
+    NetworkPeer* _peer;
+    bool _isServer;
+    uint32 _snapshotId = 0;
+    Array<ReplicatedObject> _objects;
+    Array<int32> _freeObjects;
+    Dictionary<Guid, int32> _objectsMap;
+    uint32 _netIdCounter = 0;
+    Array<Client*> _clients;
+    Dictionary<uint64, Array<int32>> _grid;
+    Array<int32> _alwaysRelevant;
+    Array<Candidate> _candidates;
+    Dictionary<uint32, RemoteObject> _remoteObjects;
+    byte _scratch[NETWORK_REPLICATOR_MAX_STATE_SIZE * 3];
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="NetworkReplicator"/> class.
+    /// </summary>
+    /// <param name="peer">The network peer used to send the replication messages.</param>
+    /// <param name="isServer">True if replicator runs on the server (sends the objects state), otherwise it runs on the client (receives the objects state).</param>
+    NetworkReplicator(NetworkPeer* peer, bool isServer);
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="NetworkReplicator"/> class.
+    /// </summary>
+    ~NetworkReplicator();
+
+public:
+    /// <summary>
+    /// The replication settings.
+    /// </summary>
+    NetworkReplicatorSettings Settings;
+
+    /// <summary>
+    /// The replication statistics.
+    /// </summary>
+    NetworkReplicatorStats Stats;
+
+public:
+    /// <summary>
+    /// Registers the state serialization functions for objects of the given type (and types deriving from it). Actors transform is replicated by default.
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    /// <param name="serialize">The function that writes the object state.</param>
+    /// <param name="deserialize">The function that reads the object state.</param>
+    static void AddSerializer(const ScriptingTypeHandle& type, const SerializeFunc& serialize, const SerializeFunc& deserialize);
+
+    /// <summary>
+    /// Adds the object to the replication (server-only).
+    /// </summary>
+    /// <param name="obj">The object (actor or script) to replicate.</param>
+    /// <param name="priority">The replication priority. Objects with higher priority are replicated more often when bandwidth is limited.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool AddObject(ScriptingObject* obj, float priority = 1.0f);
+
+    /// <summary>
+    /// Removes the object from the replication (server-only).
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    void RemoveObject(ScriptingObject* obj);
+
+    /// <summary>
+    /// Adds the client connection to the replication (server-only).
+    /// </summary>
+    /// <param name="connection">The client connection.</param>
+    void AddClient(const NetworkConnection& connection);
+
+    /// <summary>
+    /// Removes the client connection from the replication (server-only).
+    /// </summary>
+    /// <param name="connection">The client connection.</param>
+    void RemoveClient(const NetworkConnection& connection);
+
+    /// <summary>
+    /// Sets the client viewer location used for the interest management and relevance (server-only). Clients without a viewer receive all objects.
+    /// </summary>
+    /// <param name="connection">The client connection.</param>
+    /// <param name="position">The viewer location (eg. player position).</param>
+    void SetClientViewer(const NetworkConnection& connection, const Vector3& position);
+
+    /// <summary>
+    /// Takes the objects state snapshot and sends it to the clients (server-only). Should be called with the network tick rate.
+    /// </summary>
+    /// <param name="deltaTime">The time (in seconds) since the last update (used for the bandwidth budget).</param>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// Processes the received message if it's a replication message. Message is not recycled.
+    /// </summary>
+    /// <param name="message">The received message.</param>
+    /// <param name="sender">The message sender connection.</param>
+    /// <returns>True if message was processed by the replication system, otherwise false (message is rewinded).</returns>
+    bool ProcessMessage(NetworkMessage& message, const NetworkConnection& sender);
+
+private:
+    Client* GetClient(const NetworkConnection& connection) const;
+    void GatherCandidates(Client* client);
+    int32 WriteEntry(Client* client, int32 index, NetworkMessage& entry);
+    void SendSnapshot(Client* client, float deltaTime);
+    void ReceiveSnapshot(NetworkMessage& message);
+    void ReceiveAck(NetworkMessage& message, const NetworkConnection& sender);
+};
@@ -930,6 +930,7 @@ void Particles::DrawParticles(RenderContext& renderContext, ParticleEffect* effe
                     (view.Pass & material->GetDrawModes() & moduleDrawModes) == 0
                 )
                     break;
+                material->Params.RequestTexturesFullQuality();
                 renderModulesIndices.Add(moduleIndex);
                 break;
             }
@@ -949,6 +950,7 @@ void Particles::DrawParticles(RenderContext& renderContext, ParticleEffect* effe
                     (view.Pass & material->GetDrawModes() & moduleDrawModes) == 0
                 )
                     break;
+                material->Params.RequestTexturesFullQuality();
                 renderModulesIndices.Add(moduleIndex);
                 break;
             }
@@ -963,6 +965,7 @@ void Particles::DrawParticles(RenderContext& renderContext, ParticleEffect* effe
                     (view.Pass & material->GetDrawModes() & moduleDrawModes) == 0
                 )
                     break;
+                material->Params.RequestTexturesFullQuality();
                 renderModulesIndices.Add(moduleIndex);
                 break;
             }
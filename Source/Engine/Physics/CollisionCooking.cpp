@@ -124,6 +124,12 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
             // If mesh data is already cached in memory then we could use it instead of GPU
             useCpuData |= arg.Model->HasChunkLoaded(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
         }
+        if (!useCpuData && arg.Model->WaitForLOD(lodIndex))
+        {
+            // Mesh data is downloaded from the GPU so the LOD needs to be streamed in
+            LOG(Warning, "Model LOD streaming failed.");
+            return true;
+        }
         if (useCpuData)
         {
             // Read directly from the asset storage
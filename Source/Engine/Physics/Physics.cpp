@@ -8,6 +8,7 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
 
@@ -192,6 +193,7 @@ void Physics::SetBounceThresholdVelocity(const float value)
 
 void Physics::Simulate(float dt)
 {
+    PROFILE_MEM(Physics);
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -201,6 +203,7 @@ void Physics::Simulate(float dt)
 
 void Physics::CollectResults()
 {
+    PROFILE_MEM(Physics);
     if (DefaultScene)
         DefaultScene->CollectResults();
 }
@@ -4,12 +4,44 @@
 
 #include "ProfilerCPU.h"
 #include "Engine/Engine/Globals.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Threading/ThreadRegistry.h"
 
 THREADLOCAL ProfilerCPU::Thread* ProfilerCPU::Thread::Current = nullptr;
 Array<ProfilerCPU::Thread*, InlinedAllocation<64>> ProfilerCPU::Threads;
 bool ProfilerCPU::Enabled = false;
 
+namespace
+{
+    // Interned events names (name id is the index, 0 is reserved for the unnamed events)
+    CriticalSection NamesLocker;
+    Array<String> Names;
+    Dictionary<String, int32> NamesMap;
+
+    // Version of the threads names lookup caches (incremented to invalidate them)
+    int64 NamesCacheVersion = 0;
+
+    // Limit for the threads names lookup caches to not grow without bound
+    constexpr int32 NamesCacheMaxSize = 16 * 1024;
+
+    int32 InternName(const StringView& name)
+    {
+        if (name.IsEmpty())
+            return 0;
+        ScopeLock lock(NamesLocker);
+        int32 id;
+        if (!NamesMap.TryGet(name, id))
+        {
+            if (Names.IsEmpty())
+                Names.Add(String::Empty);
+            id = Names.Count();
+            Names.Add(name);
+            NamesMap.Add(name, id);
+        }
+        return id;
+    }
+}
+
 ProfilerCPU::EventBuffer::EventBuffer()
 {
     _capacity = 8192;
@@ -101,6 +133,57 @@ void ProfilerCPU::EventBuffer::Extract(Array<Event>& data, bool withRemove)
         Platform::MemoryCopy(data.Get() + spaceLeftCount, &_data[0], overflow * sizeof(Event));
 }
 
+void ProfilerCPU::Thread::CheckNamesCache()
+{
+    const int64 version = Platform::AtomicRead(&NamesCacheVersion);
+    if (_namesCacheVersion != version || _namesCache.Count() >= NamesCacheMaxSize || _dynamicNamesCache.Count() >= NamesCacheMaxSize)
+    {
+        _namesCacheVersion = version;
+        _namesCache.Clear();
+        _dynamicNamesCache.Clear();
+    }
+}
+
+int32 ProfilerCPU::Thread::GetNameId(const Char* name)
+{
+    if (name == nullptr)
+        return 0;
+    CheckNamesCache();
+    int32 id;
+    if (!_namesCache.TryGet(name, id))
+    {
+        id = InternName(StringView(name));
+        _namesCache.Add(name, id);
+    }
+    return id;
+}
+
+int32 ProfilerCPU::Thread::GetNameId(const char* name)
+{
+    if (name == nullptr)
+        return 0;
+    CheckNamesCache();
+    int32 id;
+    if (!_namesCache.TryGet(name, id))
+    {
+        id = InternName(String(name));
+        _namesCache.Add(name, id);
+    }
+    return id;
+}
+
+int32 ProfilerCPU::Thread::GetNameId(const StringView& name)
+{
+    CheckNamesCache();
+    int32 id;
+    if (!_dynamicNamesCache.TryGet(name, id))
+    {
+        id = InternName(name);
+        _dynamicNamesCache.Add(name, id);
+    }
+    return id;
+}
+
 int32 ProfilerCPU::Thread::BeginEvent()
 {
     const double time = Platform::GetTimeSeconds() * 1000.0;
@@ -111,6 +194,7 @@ int32 ProfilerCPU::Thread::BeginEvent()
     e.Depth = _depth++;
     e.NativeMemoryAllocation = 0;
     e.ManagedMemoryAllocation = 0;
+    e.NameId = 0;
     return index;
 }
 
@@ -135,6 +219,29 @@ bool ProfilerCPU::IsProfilingCurrentThread()
     return Enabled && Thread::Current != nullptr;
 }
 
+int32 ProfilerCPU::GetNameId(const StringView& name)
+{
+    const auto thread = Thread::Current;
+    return thread ? thread->GetNameId(name) : InternName(name);
+}
+
+void ProfilerCPU::InvalidateNamesCache()
+{
+    Platform::InterlockedIncrement(&NamesCacheVersion);
+}
+
+String ProfilerCPU::GetEventName(int32 nameId)
+{
+    ScopeLock lock(NamesLocker);
+    return nameId > 0 && nameId < Names.Count() ? Names[nameId] : String::Empty;
+}
+
+int32 ProfilerCPU::GetEventNamesCount()
+{
+    ScopeLock lock(NamesLocker);
+    return Math::Max(Names.Count(), 1);
+}
+
 ProfilerCPU::Thread* ProfilerCPU::GetCurrentThread()
 {
     return Enabled ? Thread::Current : nullptr;
@@ -168,16 +275,7 @@ int32 ProfilerCPU::BeginEvent(const Char* name)
         return -1;
     const auto index = BeginEvent();
     const auto thread = Thread::Current;
-    auto& e = thread->Buffer.Get(index);
-    auto dst = e.Name;
-    auto src = name;
-    if (src)
-    {
-        const auto end = dst + ARRAY_COUNT(e.Name) - 1;
-        while (*src && dst != end)
-            *dst++ = *src++;
-    }
-    *dst = 0;
+    thread->Buffer.Get(index).NameId = thread->GetNameId(name);
     return index;
 }
 
@@ -187,16 +285,16 @@ int32 ProfilerCPU::BeginEvent(const char* name)
         return -1;
     const auto index = BeginEvent();
     const auto thread = Thread::Current;
-    auto& e = thread->Buffer.Get(index);
-    auto dst = e.Name;
-    auto src = name;
-    if (src)
-    {
-        const auto end = dst + ARRAY_COUNT(e.Name) - 1;
-        while (*src && dst != end)
-            *dst++ = *src++;
-    }
-    *dst = 0;
+    thread->Buffer.Get(index).NameId = thread->GetNameId(name);
+    return index;
+}
+
+int32 ProfilerCPU::BeginEvent(int32 nameId)
+{
+    if (!Enabled)
+        return -1;
+    const auto index = BeginEvent();
+    Thread::Current->Buffer.Get(index).NameId = nameId;
     return index;
 }
 
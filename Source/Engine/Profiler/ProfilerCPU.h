@@ -5,8 +5,10 @@
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/NonCopyable.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/StringView.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include <ThirdParty/tracy/Tracy.h>
 
@@ -51,7 +53,10 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         /// </summary>
         API_FIELD() int32 ManagedMemoryAllocation;
 
-        API_FIELD(Private, NoArray) Char Name[100];
+        /// <summary>
+        /// The event name identifier. Use <see cref="ProfilerCPU.GetEventName"/> to get the name text.
+        /// </summary>
+        API_FIELD() int32 NameId;
     };
 
     /// <summary>
@@ -222,6 +227,13 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         String _name;
         int32 _depth = 0;
 
+        // Thread-local names lookup cache (string pointer -> name id) to skip locking the shared names table
+        Dictionary<const void*, int32> _namesCache;
+        Dictionary<String, int32> _dynamicNamesCache;
+        int64 _namesCacheVersion = 0;
+
+        void CheckNamesCache();
+
     public:
         Thread(const Char* name)
         {
@@ -254,6 +266,27 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         EventBuffer Buffer;
 
     public:
+        /// <summary>
+        /// Gets the identifier of the static event name (the same pointer has to always point to the same text, eg. string literal).
+        /// </summary>
+        /// <param name="name">The event name.</param>
+        /// <returns>The name identifier.</returns>
+        int32 GetNameId(const Char* name);
+
+        /// <summary>
+        /// Gets the identifier of the static event name (the same pointer has to always point to the same text, eg. string literal).
+        /// </summary>
+        /// <param name="name">The event name.</param>
+        /// <returns>The name identifier.</returns>
+        int32 GetNameId(const char* name);
+
+        /// <summary>
+        /// Gets the identifier of the dynamic event name (text is hashed).
+        /// </summary>
+        /// <param name="name">The event name.</param>
+        /// <returns>The name identifier.</returns>
+        int32 GetNameId(const StringView& name);
+
         /// <summary>
         /// Begins the event running on a this thread. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
         /// </summary>
@@ -283,6 +316,31 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     /// </summary>
     static bool Enabled;
 
+public:
+    /// <summary>
+    /// Gets the identifier of the event name. Names are interned so the events store only the name identifier. The name text is hashed so use it for the dynamic names (eg. built at runtime).
+    /// </summary>
+    /// <param name="name">The event name.</param>
+    /// <returns>The name identifier.</returns>
+    static int32 GetNameId(const StringView& name);
+
+    /// <summary>
+    /// Invalidates the names lookup caches of all threads. Has to be called when the memory of the event names with a dynamic lifetime is freed (eg. scripting methods on scripts reload), otherwise the reused pointers would resolve to the old names.
+    /// </summary>
+    static void InvalidateNamesCache();
+
+    /// <summary>
+    /// Gets the event name text.
+    /// </summary>
+    /// <param name="nameId">The event name identifier.</param>
+    /// <returns>The event name, empty if identifier is invalid.</returns>
+    API_FUNCTION() static String GetEventName(int32 nameId);
+
+    /// <summary>
+    /// Gets the amount of the interned event names. Names identifiers are in range [0; count).
+    /// </summary>
+    static int32 GetEventNamesCount();
+
 public:
     /// <summary>
     /// Determines whether the current (calling) thread is being profiled by the service (it may has no active profile block but is registered).
@@ -303,17 +361,24 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     /// <summary>
     /// Begins the event. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
     /// </summary>
-    /// <param name="name">The event name.</param>
+    /// <param name="name">The event name. Has to be a static string (eg. string literal), use overload with name identifier for the dynamic names.</param>
     /// <returns>The event token.</returns>
     static int32 BeginEvent(const Char* name);
 
     /// <summary>
     /// Begins the event. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
     /// </summary>
-    /// <param name="name">The event name.</param>
+    /// <param name="name">The event name. Has to be a static string (eg. string literal), use overload with name identifier for the dynamic names.</param>
     /// <returns>The event token.</returns>
     static int32 BeginEvent(const char* name);
 
+    /// <summary>
+    /// Begins the event. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
+    /// </summary>
+    /// <param name="nameId">The event name identifier (see GetNameId).</param>
+    /// <returns>The event token.</returns>
+    static int32 BeginEvent(int32 nameId);
+
     /// <summary>
     /// Ends the event.
     /// </summary>
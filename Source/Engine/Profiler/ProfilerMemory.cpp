@@ -0,0 +1,208 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerMemory.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Scripting/Enums.h"
+#include "Engine/Threading/Threading.h"
+
+#define MEMORY_TAGS_STACK_SIZE 32
+#define MEMORY_ALLOCATIONS_BUCKETS 16
+
+namespace
+{
+    struct AllocationInfo
+    {
+        uint64 Size;
+        MemoryTag Tag;
+    };
+
+    struct AllocationsBucket
+    {
+        CriticalSection Locker;
+        Dictionary<void*, AllocationInfo> Allocations;
+    };
+
+    struct TagStats
+    {
+        int64 Current = 0;
+        int64 Peak = 0;
+        int64 Allocations = 0;
+        int64 TotalAllocations = 0;
+        int64 Budget = 0;
+        int64 BudgetExceeded = 0;
+    };
+
+    bool Enabled = false;
+    TagStats Tags[(int32)MemoryTag::MAX];
+
+    // Allocations side table is split into buckets (by the pointer) to reduce the locking contention between threads
+    AllocationsBucket Buckets[MEMORY_ALLOCATIONS_BUCKETS];
+
+    THREADLOCAL MemoryTag TagsStack[MEMORY_TAGS_STACK_SIZE];
+    THREADLOCAL int32 TagsStackSize = 0;
+
+    // Set while tracking the allocation to skip the allocations done by the tracking itself
+    THREADLOCAL bool IsTracking = false;
+
+    void OnBudgetExceeded(MemoryTag tag, int64 current, int64 budget)
+    {
+        LOG(Error, "Memory budget exceeded for {0}: {1} MB used out of {2} MB", ScriptingEnum::ToString(tag), current / (1024 * 1024), budget / (1024 * 1024));
+        if (ProfilerMemory::AssertOnBudgetExceeded)
+        {
+            ASSERT(current <= budget);
+        }
+    }
+
+    FORCE_INLINE AllocationsBucket& GetBucket(void* ptr)
+    {
+        // Skip the low bits that are the same due to the allocations alignment
+        return Buckets[((uintptr)ptr >> 4) % MEMORY_ALLOCATIONS_BUCKETS];
+    }
+}
+
+bool ProfilerMemory::AssertOnBudgetExceeded = false;
+
+void ProfilerMemory::PushTag(MemoryTag tag)
+{
+    if (TagsStackSize < MEMORY_TAGS_STACK_SIZE)
+        TagsStack[TagsStackSize] = tag;
+    TagsStackSize++;
+}
+
+void ProfilerMemory::PopTag()
+{
+    ASSERT(TagsStackSize > 0);
+    TagsStackSize--;
+}
+
+MemoryTag ProfilerMemory::GetCurrentTag()
+{
+    if (TagsStackSize == 0)
+        return MemoryTag::None;
+    return TagsStack[Math::Min(TagsStackSize, MEMORY_TAGS_STACK_SIZE) - 1];
+}
+
+void ProfilerMemory::SetBudget(MemoryTag tag, int64 budget)
+{
+    if (tag == MemoryTag::None || tag >= MemoryTag::MAX)
+        return;
+    TagStats& stats = Tags[(int32)tag];
+    Platform::AtomicStore(&stats.Budget, Math::Max<int64>(budget, 0));
+    Platform::AtomicStore(&stats.BudgetExceeded, 0);
+}
+
+MemoryTagStats ProfilerMemory::GetStats(MemoryTag tag)
+{
+    MemoryTagStats result;
+    result.Tag = tag;
+    if (tag == MemoryTag::None || tag >= MemoryTag::MAX)
+        return result;
+    TagStats& stats = Tags[(int32)tag];
+    result.Current = Platform::AtomicRead(&stats.Current);
+    result.Peak = Platform::AtomicRead(&stats.Peak);
+    result.Allocations = Platform::AtomicRead(&stats.Allocations);
+    result.TotalAllocations = Platform::AtomicRead(&stats.TotalAllocations);
+    result.Budget = Platform::AtomicRead(&stats.Budget);
+    return result;
+}
+
+void ProfilerMemory::GetStats(Array<MemoryTagStats>& result)
+{
+    result.Resize((int32)MemoryTag::MAX - 1);
+    for (int32 i = 1; i < (int32)MemoryTag::MAX; i++)
+        result[i - 1] = GetStats((MemoryTag)i);
+}
+
+void ProfilerMemory::ResetPeaks()
+{
+    for (TagStats& stats : Tags)
+        Platform::AtomicStore(&stats.Peak, Platform::AtomicRead(&stats.Current));
+}
+
+bool ProfilerMemory::GetEnabled()
+{
+    return Enabled;
+}
+
+void ProfilerMemory::SetEnabled(bool enable)
+{
+    Enabled = enable;
+    if (!enable)
+    {
+        IsTracking = true;
+        for (AllocationsBucket& bucket : Buckets)
+        {
+            ScopeLock lock(bucket.Locker);
+            bucket.Allocations.SetCapacity(0);
+        }
+        IsTracking = false;
+
+        // Allocations are no longer tracked so the freed memory would not be subtracted
+        for (TagStats& stats : Tags)
+        {
+            Platform::AtomicStore(&stats.Current, 0);
+            Platform::AtomicStore(&stats.Peak, 0);
+            Platform::AtomicStore(&stats.Allocations, 0);
+            Platform::AtomicStore(&stats.TotalAllocations, 0);
+            Platform::AtomicStore(&stats.BudgetExceeded, 0);
+        }
+    }
+}
+
+void ProfilerMemory::OnMemoryAlloc(void* ptr, uint64 size)
+{
+    const MemoryTag tag = GetCurrentTag();
+    if (tag == MemoryTag::None || !Enabled || IsTracking)
+        return;
+    IsTracking = true;
+    {
+        AllocationsBucket& bucket = GetBucket(ptr);
+        ScopeLock lock(bucket.Locker);
+        bucket.Allocations[ptr] = { size, tag };
+    }
+    TagStats& stats = Tags[(int32)tag];
+    const int64 current = Platform::InterlockedAdd(&stats.Current, (int64)size) + (int64)size;
+    Platform::InterlockedIncrement(&stats.Allocations);
+    Platform::InterlockedIncrement(&stats.TotalAllocations);
+    int64 peak = Platform::AtomicRead(&stats.Peak);
+    while (current > peak && Platform::InterlockedCompareExchange(&stats.Peak, current, peak) != peak)
+        peak = Platform::AtomicRead(&stats.Peak);
+    const int64 budget = Platform::AtomicRead(&stats.Budget);
+    if (budget > 0 && current > budget && Platform::InterlockedCompareExchange(&stats.BudgetExceeded, 1, 0) == 0)
+    {
+        // Report once until the usage gets back within the budget
+        OnBudgetExceeded(tag, current, budget);
+    }
+    IsTracking = false;
+}
+
+void ProfilerMemory::OnMemoryFree(void* ptr)
+{
+    if (!Enabled || IsTracking)
+        return;
+    IsTracking = true;
+    AllocationInfo info;
+    bool found;
+    {
+        AllocationsBucket& bucket = GetBucket(ptr);
+        ScopeLock lock(bucket.Locker);
+        found = bucket.Allocations.TryGet(ptr, info);
+        if (found)
+            bucket.Allocations.Remove(ptr);
+    }
+    if (found)
+    {
+        TagStats& stats = Tags[(int32)info.Tag];
+        const int64 current = Platform::InterlockedAdd(&stats.Current, -(int64)info.Size) - (int64)info.Size;
+        Platform::InterlockedDecrement(&stats.Allocations);
+        if (current <= Platform::AtomicRead(&stats.Budget))
+            Platform::AtomicStore(&stats.BudgetExceeded, 0);
+    }
+    IsTracking = false;
+}
+
+#endif
@@ -0,0 +1,207 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// The engine subsystems used to tag the native memory allocations.
+/// </summary>
+API_ENUM() enum class MemoryTag : uint8
+{
+    /// <summary>
+    /// Untagged memory (not tracked).
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// Content assets loading and data.
+    /// </summary>
+    Content,
+
+    /// <summary>
+    /// Graphics and rendering.
+    /// </summary>
+    Rendering,
+
+    /// <summary>
+    /// Physics simulation.
+    /// </summary>
+    Physics,
+
+    /// <summary>
+    /// Animations update.
+    /// </summary>
+    Animation,
+
+    /// <summary>
+    /// Scripting and gameplay logic.
+    /// </summary>
+    Scripting,
+
+    /// <summary>
+    /// Audio playback.
+    /// </summary>
+    Audio,
+
+    /// <summary>
+    /// Navigation meshes building.
+    /// </summary>
+    Navigation,
+
+    /// <summary>
+    /// Networking and replication.
+    /// </summary>
+    Networking,
+
+    /// <summary>
+    /// Custom memory tag for the game code (not used by the engine).
+    /// </summary>
+    Custom,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
+
+/// <summary>
+/// The memory allocations stats of the single memory tag.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API MemoryTagStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(MemoryTagStats);
+
+    /// <summary>
+    /// The memory tag.
+    /// </summary>
+    API_FIELD() MemoryTag Tag = MemoryTag::None;
+
+    /// <summary>
+    /// The current amount of the allocated memory (in bytes).
+    /// </summary>
+    API_FIELD() int64 Current = 0;
+
+    /// <summary>
+    /// The peak amount of the allocated memory (in bytes).
+    /// </summary>
+    API_FIELD() int64 Peak = 0;
+
+    /// <summary>
+    /// The current amount of the allocations.
+    /// </summary>
+    API_FIELD() int64 Allocations = 0;
+
+    /// <summary>
+    /// The total amount of the allocations done since the tracking got enabled (including the freed ones).
+    /// </summary>
+    API_FIELD() int64 TotalAllocations = 0;
+
+    /// <summary>
+    /// The memory budget (in bytes). Value 0 if unlimited.
+    /// </summary>
+    API_FIELD() int64 Budget = 0;
+};
+
+/// <summary>
+/// Provides native memory allocations tracking per engine subsystem. Allocations done within the memory tag scope (see PROFILE_MEM) are recorded (with their size) so the current and peak memory usage can be reported for each tag.
+/// </summary>
+/// <remarks>
+/// Tags are stored on a per-thread stack. Only allocations done while any tag is active are tracked, the memory is accounted to the tag that was active when it got allocated (even if it's freed in other scope or thread).
+/// Tracking is disabled by default since it records every tagged allocation and looks up every free. Enable it with the -profilememory command line switch or SetEnabled.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ProfilerMemory
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerMemory);
+
+    /// <summary>
+    /// True if assert when memory budget gets exceeded, otherwise the error is logged.
+    /// </summary>
+    API_FIELD() static bool AssertOnBudgetExceeded;
+
+public:
+    /// <summary>
+    /// Pushes the memory tag on the current thread tags stack.
+    /// </summary>
+    /// <param name="tag">The memory tag.</param>
+    static void PushTag(MemoryTag tag);
+
+    /// <summary>
+    /// Pops the memory tag from the current thread tags stack.
+    /// </summary>
+    static void PopTag();
+
+    /// <summary>
+    /// Gets the memory tag active on the current thread.
+    /// </summary>
+    static MemoryTag GetCurrentTag();
+
+    /// <summary>
+    /// Sets the memory budget for the tag. The error is logged (or assert if AssertOnBudgetExceeded is set) when the tag memory usage exceeds the budget.
+    /// </summary>
+    /// <param name="tag">The memory tag.</param>
+    /// <param name="budget">The memory budget (in bytes). Use 0 to disable the budget.</param>
+    API_FUNCTION() static void SetBudget(MemoryTag tag, int64 budget);
+
+    /// <summary>
+    /// Gets the memory stats of the tag.
+    /// </summary>
+    /// <param name="tag">The memory tag.</param>
+    /// <returns>The stats.</returns>
+    API_FUNCTION() static MemoryTagStats GetStats(MemoryTag tag);
+
+    /// <summary>
+    /// Gets the memory stats of all tags (except None).
+    /// </summary>
+    /// <param name="result">The result stats.</param>
+    API_FUNCTION() static void GetStats(API_PARAM(Out) Array<MemoryTagStats>& result);
+
+    /// <summary>
+    /// Resets the peak memory usage of all tags to the current memory usage.
+    /// </summary>
+    API_FUNCTION() static void ResetPeaks();
+
+    /// <summary>
+    /// Gets a value indicating whether the memory allocations tracking is enabled.
+    /// </summary>
+    API_PROPERTY() static bool GetEnabled();
+
+    /// <summary>
+    /// Enables or disables the memory allocations tracking. Disabling resets the tags memory stats (except budgets) since the tracked allocations get forgotten.
+    /// </summary>
+    /// <param name="enable">True if enable tracking, otherwise false.</param>
+    API_PROPERTY() static void SetEnabled(bool enable);
+
+public:
+
+    static void OnMemoryAlloc(void* ptr, uint64 size);
+    static void OnMemoryFree(void* ptr);
+};
+
+/// <summary>
+/// Helper structure used to call PushTag/PopTag within single code block.
+/// </summary>
+struct ScopeMemoryTag
+{
+    FORCE_INLINE ScopeMemoryTag(MemoryTag tag)
+    {
+        ProfilerMemory::PushTag(tag);
+    }
+
+    FORCE_INLINE ~ScopeMemoryTag()
+    {
+        ProfilerMemory::PopTag();
+    }
+};
+
+// Shortcut macro for tagging the native memory allocations within a single code block
+#define PROFILE_MEM(tag) ScopeMemoryTag ProfileMemoryTag(MemoryTag::tag)
+
+#else
+
+// Empty macro for disabled profiler
+#define PROFILE_MEM(tag)
+
+#endif
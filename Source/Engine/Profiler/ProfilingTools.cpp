@@ -3,14 +3,140 @@
 #if COMPILE_WITH_PROFILER
 
 #include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Formatting.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Engine/CommandLine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Scripting/Enums.h"
+#include "Engine/Serialization/FileWriteStream.h"
 
 ProfilingTools::MainStats ProfilingTools::Stats;
 Array<ProfilingTools::ThreadStats, InlinedAllocation<64>> ProfilingTools::EventsCPU;
 Array<ProfilerGPU::Event> ProfilingTools::EventsGPU;
+Array<MemoryTagStats> ProfilingTools::MemoryTags;
+
+namespace
+{
+    FileWriteStream* TraceFile = nullptr;
+    Array<StringAnsi> TraceNames;
+    int32 TraceThreads = 0;
+    fmt_flax::memory_buffer_ansi TraceBuffer;
+
+    StringAnsi EscapeJson(const String& str)
+    {
+        const StringAnsi ansi = str.ToStringAnsi();
+        Array<char, InlinedAllocation<128>> result;
+        for (int32 i = 0; i < ansi.Length(); i++)
+        {
+            const char c = ansi[i];
+            if (c == '"' || c == '\\')
+                result.Add('\\');
+            result.Add((unsigned char)c < ' ' ? ' ' : c);
+        }
+        return StringAnsi(result.Get(), result.Count());
+    }
+
+    const StringAnsi& GetTraceName(int32 nameId)
+    {
+        if (nameId >= TraceNames.Count())
+        {
+            // Cache the escaped names to skip names lookup and conversion for every event
+            const int32 start = TraceNames.Count();
+            TraceNames.Resize(ProfilerCPU::GetEventNamesCount());
+            for (int32 i = start; i < TraceNames.Count(); i++)
+                TraceNames[i] = EscapeJson(ProfilerCPU::GetEventName(i));
+            if (nameId >= TraceNames.Count())
+                return TraceNames[0];
+        }
+        return TraceNames[nameId];
+    }
+
+    void WriteTrace()
+    {
+        PROFILE_CPU_NAMED("ProfilingTools.WriteTrace");
+
+        // Stream the extracted events (complete events with the time in microseconds, thread index is used as a thread id)
+        TraceBuffer.clear();
+        const auto& threads = ProfilerCPU::Threads;
+        for (; TraceThreads < threads.Count(); TraceThreads++)
+        {
+            const auto t = threads[TraceThreads];
+            if (t)
+                fmt_flax::format(TraceBuffer, "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{0},\"args\":{{\"name\":\"{1}\"}}}},\n", TraceThreads, EscapeJson(t->GetName()).Get());
+        }
+        for (const auto& pt : ProfilingTools::EventsCPU)
+        {
+            int32 tid = 0;
+            for (; tid < threads.Count(); tid++)
+            {
+                if (threads[tid] && threads[tid]->GetName() == pt.Name)
+                    break;
+            }
+            for (const auto& e : pt.Events)
+            {
+                if (e.End <= 0.0)
+                    continue;
+                fmt_flax::format(TraceBuffer, "{{\"name\":\"{0}\",\"ph\":\"X\",\"ts\":{1:.3f},\"dur\":{2:.3f},\"pid\":0,\"tid\":{3}}},\n", GetTraceName(e.NameId).Get(), e.Start * 1000.0, (e.End - e.Start) * 1000.0, tid);
+            }
+        }
+
+        // Stream the memory tags usage as counters (in kilobytes)
+        if (ProfilingTools::MemoryTags.HasItems())
+        {
+            fmt_flax::format(TraceBuffer, "{{\"name\":\"Memory\",\"ph\":\"C\",\"ts\":{0:.3f},\"pid\":0,\"args\":{{", Platform::GetTimeSeconds() * 1000000.0);
+            for (int32 i = 0; i < ProfilingTools::MemoryTags.Count(); i++)
+            {
+                const auto& e = ProfilingTools::MemoryTags[i];
+                fmt_flax::format(TraceBuffer, "{0}\"{1}\":{2}", i != 0 ? "," : "", ScriptingEnum::ToString(e.Tag).ToStringAnsi().Get(), e.Current / 1024);
+            }
+            fmt_flax::format(TraceBuffer, "}}}},\n");
+        }
+        if (TraceBuffer.size() != 0)
+            TraceFile->WriteBytes(TraceBuffer.data(), (uint32)TraceBuffer.size());
+    }
+}
+
+bool ProfilingTools::StartTrace(const StringView& path)
+{
+    StopTrace();
+    TraceFile = FileWriteStream::Open(path);
+    if (!TraceFile)
+    {
+        LOG(Error, "Failed to open trace file {0}", path);
+        return true;
+    }
+    TraceThreads = 0;
+    const char header[] = "[\n";
+    TraceFile->WriteBytes(header, ARRAY_COUNT(header) - 1);
+    LOG(Info, "Started profiler trace capture to {0}", path);
+    return false;
+}
+
+void ProfilingTools::StopTrace()
+{
+    if (!TraceFile)
+        return;
+
+    // Close the events array (Chrome tracing accepts the unterminated array in case of a crash)
+    TraceBuffer.clear();
+    fmt_flax::format(TraceBuffer, "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{{\"name\":\"{0}\"}}}}\n]\n", EscapeJson(Globals::ProductName).Get());
+    TraceFile->WriteBytes(TraceBuffer.data(), (uint32)TraceBuffer.size());
+    TraceFile->Close();
+    Delete(TraceFile);
+    TraceFile = nullptr;
+    TraceNames.Clear();
+    TraceBuffer.clear();
+    LOG(Info, "Stopped profiler trace capture");
+}
+
+bool ProfilingTools::IsTracing()
+{
+    return TraceFile != nullptr;
+}
 
 class ProfilingToolsService : public EngineService
 {
@@ -21,12 +147,22 @@ class ProfilingToolsService : public EngineService
         Platform::MemoryClear(&ProfilingTools::Stats, sizeof(ProfilingTools::MainStats));
     }
 
+    bool Init() override;
     void Update() override;
     void Dispose() override;
 };
 
 ProfilingToolsService ProfilingToolsServiceInstance;
 
+bool ProfilingToolsService::Init()
+{
+    if (CommandLine::Options.ProfileMemory.IsTrue())
+        ProfilerMemory::SetEnabled(true);
+    if (CommandLine::Options.Trace.HasValue())
+        ProfilingTools::StartTrace(CommandLine::Options.Trace.GetValue());
+    return false;
+}
+
 void ProfilingToolsService::Update()
 {
     // Capture stats
@@ -44,6 +180,8 @@ void ProfilingToolsService::Update()
         stats.DrawCPUTimeMs = static_cast<float>(Time::Draw.LastLength * 1000.0);
 
         ProfilerGPU::GetLastFrameData(stats.DrawGPUTimeMs, stats.DrawStats);
+
+        ProfilerMemory::GetStats(ProfilingTools::MemoryTags);
     }
 
     // Extract CPU profiler events
@@ -75,6 +213,8 @@ void ProfilingToolsService::Update()
 
         t->Buffer.Extract(pt->Events, true);
     }
+    if (TraceFile)
+        WriteTrace();
 
 #if 0
     // Print CPU threads events to the log
@@ -91,7 +231,7 @@ void ProfilingToolsService::Update()
                 String prev;
                 for (int d = 0; d < e.Depth; d++)
                     prev += TEXT("\t");
-                LOG(Warning, "{2}{0}, Time: {1} ms", e.Name, ((int)((e.End - e.Start) * 1000.0f) / 1000.0f), prev);
+                LOG(Warning, "{2}{0}, Time: {1} ms", ProfilerCPU::GetEventName(e.NameId), ((int)((e.End - e.Start) * 1000.0f) / 1000.0f), prev);
             }
             LOG(Info, "");
             LOG_FLOOR();
@@ -135,7 +275,7 @@ void ProfilingToolsService::Update()
                     for (int32 d = 0; d < e.Depth; d++)
                         prev += TEXT("\t");
                     const double time = e.End - e.Start;
-                    LOG(Warning, "\t{2}{0}, Time: {1} ms", e.Name, ((int32)(time * 1000.0f) / 1000.0f), prev);
+                    LOG(Warning, "\t{2}{0}, Time: {1} ms", ProfilerCPU::GetEventName(e.NameId), ((int32)(time * 1000.0f) / 1000.0f), prev);
                 }
             }
             LOG(Info, "");
@@ -168,9 +308,12 @@ void ProfilingToolsService::Update()
 
 void ProfilingToolsService::Dispose()
 {
+    ProfilingTools::StopTrace();
     ProfilingTools::EventsCPU.Clear();
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
+    ProfilingTools::MemoryTags.SetCapacity(0);
+    ProfilerMemory::SetEnabled(false);
 }
 
 #endif
@@ -8,6 +8,7 @@
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 
 /// <summary>
 /// Profiler tools for development. Allows to gather profiling data and events from the engine.
@@ -120,6 +121,29 @@ API_CLASS(Static) class ProfilingTools
     /// The GPU rendering profiler events.
     /// </summary>
     API_FIELD(ReadOnly) static Array<ProfilerGPU::Event> EventsGPU;
+
+    /// <summary>
+    /// The native memory stats of the engine subsystems (see ProfilerMemory). Updated every frame.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<MemoryTagStats> MemoryTags;
+
+public:
+    /// <summary>
+    /// Starts capturing the CPU profiler events into the trace file. Events are streamed to the file every frame using the Chrome Trace Event format (JSON) that can be opened with chrome://tracing or Perfetto UI. Can be used to profile the headless builds without the Editor (see -trace command line option).
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartTrace(const StringView& path);
+
+    /// <summary>
+    /// Stops capturing the CPU profiler events and closes the trace file.
+    /// </summary>
+    API_FUNCTION() static void StopTrace();
+
+    /// <summary>
+    /// Returns true if the CPU profiler events are captured into the trace file.
+    /// </summary>
+    API_PROPERTY() static bool IsTracing();
 };
 
 #endif
@@ -38,6 +38,31 @@ API_STRUCT() struct RenderStatsData
     /// </summary>
     API_FIELD() int64 PipelineStateChanges;
 
+    /// <summary>
+    /// The data uploaded to the GPU resources (in bytes).
+    /// </summary>
+    API_FIELD() int64 UploadBytes;
+
+    /// <summary>
+    /// The data uploads count that could not use the upload ring buffer (it was full) and had to use the separate staging memory.
+    /// </summary>
+    API_FIELD() int64 UploadStalls;
+
+    /// <summary>
+    /// The data uploads count that used the separate staging memory because the upload ring buffer is not available (eg. failed to create it).
+    /// </summary>
+    API_FIELD() int64 UploadFallbacks;
+
+    /// <summary>
+    /// The skinned meshes bone matrices data uploaded to the GPU (in bytes). Included in the UploadBytes.
+    /// </summary>
+    API_FIELD() int64 SkinningUploadBytes;
+
+    /// <summary>
+    /// The skinned meshes bone matrices updates that skipped the upload because the pose didn't change.
+    /// </summary>
+    API_FIELD() int64 SkinningSkippedUploads;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="RenderStatsData"/> struct.
     /// </summary>
@@ -47,6 +72,11 @@ API_STRUCT() struct RenderStatsData
         , Vertices(0)
         , Triangles(0)
         , PipelineStateChanges(0)
+        , UploadBytes(0)
+        , UploadStalls(0)
+        , UploadFallbacks(0)
+        , SkinningUploadBytes(0)
+        , SkinningSkippedUploads(0)
     {
     }
 
@@ -67,6 +97,11 @@ API_STRUCT() struct RenderStatsData
         MIX(Vertices);
         MIX(Triangles);
         MIX(PipelineStateChanges);
+        MIX(UploadBytes);
+        MIX(UploadStalls);
+        MIX(UploadFallbacks);
+        MIX(SkinningUploadBytes);
+        MIX(SkinningSkippedUploads);
 #undef MIX
     }
 };
@@ -77,11 +112,21 @@ API_STRUCT() struct RenderStatsData
 	Platform::InterlockedIncrement(&RenderStatsData::Counter.DrawCalls); \
 	Platform::InterlockedAdd(&RenderStatsData::Counter.Vertices, vertices); \
 	Platform::InterlockedAdd(&RenderStatsData::Counter.Triangles, triangles)
+#define RENDER_STAT_UPLOAD(size) Platform::InterlockedAdd(&RenderStatsData::Counter.UploadBytes, (int64)(size))
+#define RENDER_STAT_UPLOAD_STALL() Platform::InterlockedIncrement(&RenderStatsData::Counter.UploadStalls)
+#define RENDER_STAT_UPLOAD_FALLBACK() Platform::InterlockedIncrement(&RenderStatsData::Counter.UploadFallbacks)
+#define RENDER_STAT_SKINNING_UPLOAD(size) Platform::InterlockedAdd(&RenderStatsData::Counter.SkinningUploadBytes, (int64)(size))
+#define RENDER_STAT_SKINNING_SKIP() Platform::InterlockedIncrement(&RenderStatsData::Counter.SkinningSkippedUploads)
 
 #else
 
 #define RENDER_STAT_DISPATCH_CALL()
 #define RENDER_STAT_PS_STATE_CHANGE()
 #define RENDER_STAT_DRAW_CALL(vertices, primitives)
+#define RENDER_STAT_UPLOAD(size)
+#define RENDER_STAT_UPLOAD_STALL()
+#define RENDER_STAT_UPLOAD_FALLBACK()
+#define RENDER_STAT_SKINNING_UPLOAD(size)
+#define RENDER_STAT_SKINNING_SKIP()
 
 #endif
@@ -3,6 +3,8 @@
 #include "Font.h"
 #include "FontAsset.h"
 #include "FontManager.h"
+#include "Render2DCommandList.h"
+#include "TextLayoutCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Threading/Threading.h"
 #include "IncludeFreeType.h"
@@ -24,16 +26,29 @@ Font::Font(FontAsset* parentAsset, int32 size)
     _ascender = Convert26Dot6ToRoundedPixel<int16>(face->size->metrics.ascender);
     _descender = Convert26Dot6ToRoundedPixel<int16>(face->size->metrics.descender);
     _lineGap = _height - _ascender + _descender;
+
+    // Mark all characters in the flat table as missing (entry is valid only if it's character matches the table index)
+    for (int32 i = 0; i < FONT_CHARACTERS_TABLE_SIZE; i++)
+        _charactersTable[i].Character = (Char)MAX_uint16;
 }
 
 Font::~Font()
 {
     if (_asset)
         _asset->_fonts.Remove(this);
+    TextLayoutCache::Invalidate(this);
+    Render2DCommandList::InvalidateAll();
 }
 
 void Font::GetCharacter(Char c, FontCharacterEntry& result)
 {
+    // Use the flat table for the most common characters
+    if (c < FONT_CHARACTERS_TABLE_SIZE && _charactersTable[c].Character == c)
+    {
+        result = _charactersTable[c];
+        return;
+    }
+
     // Try to get the character or cache it if cannot be found
     if (!_characters.TryGet(c, result))
     {
@@ -50,6 +65,22 @@ void Font::GetCharacter(Char c, FontCharacterEntry& result)
         // Add to the dictionary
         _characters.Add(c, result);
     }
+
+    if (c < FONT_CHARACTERS_TABLE_SIZE)
+    {
+        ScopeLock lock(_asset->Locker);
+
+        // Publish the table entry after it's fully written because it's read without locking (character is written last so readers never match the partially written entry)
+        FontCharacterEntry& entry = _charactersTable[c];
+        if (entry.Character != c)
+        {
+            FontCharacterEntry value = result;
+            value.Character = (Char)MAX_uint16;
+            entry = value;
+            Platform::MemoryBarrier();
+            entry.Character = c;
+        }
+    }
 }
 
 int32 Font::GetKerning(Char first, Char second) const
@@ -100,9 +131,78 @@ void Font::Invalidate()
         FontManager::Invalidate(i->Value);
     }
     _characters.Clear();
+    for (int32 i = 0; i < FONT_CHARACTERS_TABLE_SIZE; i++)
+        _charactersTable[i].Character = (Char)MAX_uint16;
+    TextLayoutCache::Invalidate(this);
+    Render2DCommandList::InvalidateAll();
 }
 
 void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
+{
+    ProcessTextLayout(text, outputLines, nullptr, layout);
+}
+
+void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, Array<Float2>& outputGlyphs, const TextLayoutOptions& layout)
+{
+    ProcessTextLayout(text, outputLines, &outputGlyphs, layout);
+}
+
+void Font::ProcessTextLayout(const StringView& text, Array<FontLineCache>& outputLines, Array<Float2>* outputGlyphs, const TextLayoutOptions& layout)
+{
+    // Reuse the layout of the same text processed before
+    if (TextLayoutCache::TryGet(this, text, layout, outputLines, outputGlyphs))
+        return;
+    if (outputGlyphs == nullptr && !TextLayoutCache::CanCache(text))
+    {
+        ProcessTextLines(text, outputLines, layout);
+        return;
+    }
+
+    // Process text and cache the layout with glyph positions
+    const double startTime = Platform::GetTimeSeconds();
+    const int32 firstLine = outputLines.Count();
+    Array<Float2> glyphs;
+    Array<Float2>& glyphsResult = outputGlyphs ? *outputGlyphs : glyphs;
+    ProcessTextLines(text, outputLines, layout);
+    ProcessTextGlyphs(text, outputLines.Get() + firstLine, outputLines.Count() - firstLine, glyphsResult, layout);
+    TextLayoutCache::Add(this, text, layout, outputLines.Get() + firstLine, outputLines.Count() - firstLine, glyphsResult, Platform::GetTimeSeconds() - startTime);
+}
+
+void Font::ProcessTextGlyphs(const StringView& text, const FontLineCache* lines, int32 linesCount, Array<Float2>& outputGlyphs, const TextLayoutOptions& layout)
+{
+    outputGlyphs.Resize(text.Length(), false);
+    const float scale = layout.Scale / FontManager::FontScale;
+    FontCharacterEntry entry;
+    FontCharacterEntry previous;
+    for (int32 lineIndex = 0; lineIndex < linesCount; lineIndex++)
+    {
+        const FontLineCache& line = lines[lineIndex];
+        Float2 pointer = line.Location;
+        for (int32 charIndex = line.FirstCharIndex; charIndex <= line.LastCharIndex; charIndex++)
+        {
+            const Char c = text[charIndex];
+            if (c == '\n')
+            {
+                outputGlyphs[charIndex] = pointer;
+                continue;
+            }
+            GetCharacter(c, entry);
+
+            // Apply kerning
+            if (!StringUtils::IsWhitespace(c) && previous.IsValid)
+            {
+                pointer.X += (float)GetKerning(previous.Character, entry.Character) * scale;
+            }
+            previous = entry;
+            outputGlyphs[charIndex] = pointer;
+
+            // Move
+            pointer.X += entry.AdvanceX * scale;
+        }
+    }
+}
+
+void Font::ProcessTextLines(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
 {
     float cursorX = 0;
     int32 kerning;
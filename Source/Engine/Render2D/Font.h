@@ -14,6 +14,9 @@ class FontAsset;
 // The default DPI that engine is using
 #define DefaultDPI 96
 
+// The amount of the most common characters (from the beginning of the Unicode range) cached in the flat table to skip dictionary lookups
+#define FONT_CHARACTERS_TABLE_SIZE 256
+
 /// <summary>
 /// The text range.
 /// </summary>
@@ -229,6 +232,7 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     int32 _lineGap;
     bool _hasKerning;
     Dictionary<Char, FontCharacterEntry> _characters;
+    FontCharacterEntry _charactersTable[FONT_CHARACTERS_TABLE_SIZE];
     mutable Dictionary<uint32, int32> _kerningTable;
 
 public:
@@ -333,6 +337,15 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     /// <param name="outputLines">The output lines list.</param>
     void ProcessText(const StringView& text, Array<FontLineCache>& outputLines, API_PARAM(Ref) const TextLayoutOptions& layout);
 
+    /// <summary>
+    /// Processes text to get cached lines and glyph positions for rendering.
+    /// </summary>
+    /// <param name="text">The input text.</param>
+    /// <param name="outputLines">The output lines list.</param>
+    /// <param name="outputGlyphs">The output glyph positions (pen position of each text character, including the kerning, relative to the layout bounds location). Characters not included in any line (eg. whitespace at the wrapped line break) are undefined.</param>
+    /// <param name="layout">The layout properties.</param>
+    void ProcessText(const StringView& text, Array<FontLineCache>& outputLines, Array<Float2>& outputGlyphs, const TextLayoutOptions& layout);
+
     /// <summary>
     /// Processes text to get cached lines for rendering.
     /// </summary>
@@ -517,6 +530,12 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     /// </summary>
     void FlushFaceSize() const;
 
+private:
+
+    void ProcessTextLayout(const StringView& text, Array<FontLineCache>& outputLines, Array<Float2>* outputGlyphs, const TextLayoutOptions& layout);
+    void ProcessTextLines(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout);
+    void ProcessTextGlyphs(const StringView& text, const FontLineCache* lines, int32 linesCount, Array<Float2>& outputGlyphs, const TextLayoutOptions& layout);
+
 public:
 
     // [Object]
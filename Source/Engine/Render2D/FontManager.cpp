@@ -4,6 +4,7 @@
 #include "FontTextureAtlas.h"
 #include "FontAsset.h"
 #include "Font.h"
+#include "TextLayoutCache.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Content.h"
@@ -93,6 +94,9 @@ bool FontManagerService::Init()
 
 void FontManagerService::Dispose()
 {
+    // Release cached text layouts
+    TextLayoutCache::Clear();
+
     // Release font atlases
     Atlases.Resize(0);
 
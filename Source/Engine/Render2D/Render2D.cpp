@@ -1,7 +1,9 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Render2D.h"
+#include "Render2DCommandList.h"
 #include "Font.h"
+#include "FontAsset.h"
 #include "FontManager.h"
 #include "FontTextureAtlas.h"
 #include "RotatedRectangle.h"
@@ -179,6 +181,24 @@ struct ClipMask
     Rectangle Bounds;
 };
 
+// Command list recording
+struct RecordingState
+{
+    Render2DCommandList* List;
+    int32 VBStart;
+    int32 IBStart;
+    uint32 VBIndex;
+    uint32 IBIndex;
+    int32 DrawCallsStart;
+    int32 TransformLayers;
+    int32 ClipLayers;
+    int32 TintLayers;
+};
+
+// The clipping used during command list recording (unique value to detect it during replay and use the actual clipping)
+const Rectangle RecordingClipBounds(-1e8f, -1e8f, 2e8f, 2e8f);
+const RotatedRectangle RecordingClipMask(RecordingClipBounds);
+
 Render2D::RenderingFeatures Render2D::Features = RenderingFeatures::VertexSnapping;
 
 namespace
@@ -193,6 +213,7 @@ namespace
     // Drawing
     Array<Render2DDrawCall> DrawCalls;
     Array<FontLineCache> Lines;
+    Array<Float2> Glyphs;
     Array<Float2> Lines2;
     bool IsScissorsRectEmpty;
     bool IsScissorsRectEnabled;
@@ -209,6 +230,7 @@ namespace
 
     Array<ClipMask, InlinedAllocation<64>> ClipLayersStack;
     Array<Color, InlinedAllocation<64>> TintLayersStack;
+    Array<RecordingState, InlinedAllocation<8>> RecordingStack;
 
     // Shader
     AssetReference<Shader> GUIShader;
@@ -593,6 +615,13 @@ void OnGUIShaderReloading(Asset* obj)
 
 #endif
 
+void OnAssetChanged(Asset* asset)
+{
+    // Recorded command lists reference the textures and materials directly
+    if (ScriptingObject::Cast<TextureBase>(asset) || ScriptingObject::Cast<MaterialBase>(asset) || ScriptingObject::Cast<FontAsset>(asset))
+        Render2DCommandList::InvalidateAll();
+}
+
 bool Render2DService::Init()
 {
     // GUI Shader
@@ -605,16 +634,23 @@ bool Render2DService::Init()
 
     DrawCalls.EnsureCapacity(RENDER2D_INITIAL_DRAW_CALL_CAPACITY);
 
+    Content::AssetDisposing.Bind<OnAssetChanged>();
+    Content::AssetReloading.Bind<OnAssetChanged>();
+
     return false;
 }
 
 void Render2DService::Dispose()
 {
+    Content::AssetDisposing.Unbind<OnAssetChanged>();
+    Content::AssetReloading.Unbind<OnAssetChanged>();
     TintLayersStack.Resize(0);
     ClipLayersStack.Resize(0);
     DrawCalls.Resize(0);
     Lines.Resize(0);
+    Glyphs.Resize(0);
     Lines2.Resize(0);
+    RecordingStack.Resize(0);
 
     GUIShader = nullptr;
 
@@ -690,6 +726,8 @@ void Render2D::Begin(GPUContext* context, GPUTextureView* output, GPUTextureView
     // Scissors can be enabled only for 2D orthographic projections
     IsScissorsRectEnabled = false;
 
+    RecordingStack.Clear();
+
     // Reset geometry buffer
     VB.Clear();
     IB.Clear();
@@ -702,6 +740,11 @@ void Render2D::End()
     RENDER2D_CHECK_RENDERING_STATE;
     ASSERT(Context != nullptr && Output != nullptr);
     ASSERT(GUIShader != nullptr);
+    if (RecordingStack.HasItems())
+    {
+        LOG(Error, "Missing Render2D::EndRecording call.");
+        RecordingStack.Clear();
+    }
 
     // Skip if has nothing to draw
     if (DrawCalls.IsEmpty())
@@ -881,6 +924,192 @@ void Render2D::PopTint()
     TintLayersStack.Pop();
 }
 
+volatile int64 Render2DCommandList::ResourcesVersion = 1;
+
+Render2DCommandList::Render2DCommandList(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+bool Render2DCommandList::IsOutdated() const
+{
+    return _resourcesVersion != Platform::AtomicRead(&ResourcesVersion) || _fontScale != FontManager::FontScale;
+}
+
+void Render2DCommandList::InvalidateAll()
+{
+    Platform::InterlockedIncrement(&ResourcesVersion);
+}
+
+void Render2DCommandList::Clear()
+{
+    _vertices.Clear();
+    _indices.Clear();
+    _drawCalls.Clear();
+    _verticesCount = 0;
+    _drawCallsCount = 0;
+}
+
+void Render2D::BeginRecording(Render2DCommandList* list)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(list);
+
+    RecordingState& state = RecordingStack.AddOne();
+    state.List = list;
+    state.VBStart = VB.Data.Count();
+    state.IBStart = IB.Data.Count();
+    state.VBIndex = VBIndex;
+    state.IBIndex = IBIndex;
+    state.DrawCallsStart = DrawCalls.Count();
+    state.TransformLayers = TransformLayersStack.Count();
+    state.ClipLayers = ClipLayersStack.Count();
+    state.TintLayers = TintLayersStack.Count();
+
+    // Record drawing in the local space
+    TransformLayersStack.Push(Matrix3x3::Identity);
+    TransformCached = Matrix3x3::Identity;
+    ClipLayersStack.Push({ RecordingClipMask, RecordingClipBounds });
+    TintLayersStack.Push(Color::White);
+}
+
+void Render2D::EndRecording()
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    if (RecordingStack.IsEmpty())
+    {
+        LOG(Error, "Missing Render2D::BeginRecording call.");
+        return;
+    }
+    const RecordingState state = RecordingStack.Pop();
+    Render2DCommandList* list = state.List;
+
+    // Move the recorded geometry from the frame buffers into the list
+    list->_resourcesVersion = Platform::AtomicRead(&Render2DCommandList::ResourcesVersion);
+    list->_fontScale = FontManager::FontScale;
+    list->_vertices.Set(VB.Data.Get() + state.VBStart, VB.Data.Count() - state.VBStart);
+    list->_verticesCount = list->_vertices.Count() / sizeof(Render2DVertex);
+    const uint32* indices = (const uint32*)(IB.Data.Get() + state.IBStart);
+    list->_indices.Resize(IBIndex - state.IBIndex, false);
+    for (int32 i = 0; i < list->_indices.Count(); i++)
+        list->_indices.Get()[i] = indices[i] - state.VBIndex;
+
+    // Move the recorded draw calls into the list and merge the ones that can be batched together
+    list->_drawCalls.Clear();
+    Render2DDrawCall* prev = nullptr;
+    for (int32 i = state.DrawCallsStart; i < DrawCalls.Count(); i++)
+    {
+        Render2DDrawCall drawCall = DrawCalls.Get()[i];
+        drawCall.StartIB -= state.IBIndex;
+        if (prev && CanBatchDrawCalls(*prev, drawCall) && prev->StartIB + prev->CountIB == drawCall.StartIB)
+        {
+            prev->CountIB += drawCall.CountIB;
+            continue;
+        }
+        list->_drawCalls.Add((const byte*)&drawCall, sizeof(Render2DDrawCall));
+        prev = (Render2DDrawCall*)(list->_drawCalls.Get() + list->_drawCalls.Count() - sizeof(Render2DDrawCall));
+    }
+    list->_drawCallsCount = list->_drawCalls.Count() / sizeof(Render2DDrawCall);
+
+    // Restore the state from the recording start
+    VB.Data.Resize(state.VBStart);
+    IB.Data.Resize(state.IBStart);
+    VBIndex = state.VBIndex;
+    IBIndex = state.IBIndex;
+    DrawCalls.Resize(state.DrawCallsStart);
+    TransformLayersStack.Resize(state.TransformLayers);
+    TransformCached = TransformLayersStack.Peek();
+    ClipLayersStack.Resize(state.ClipLayers);
+    TintLayersStack.Resize(state.TintLayers);
+
+    // Draw the recorded list with the actual state
+    DrawCommandList(list);
+}
+
+void Render2D::DrawCommandList(Render2DCommandList* list)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    if (list == nullptr || list->IsEmpty() || list->IsOutdated())
+        return;
+    PROFILE_CPU();
+    const Color tint = TintLayersStack.Peek();
+    const ClipMask clip = ClipLayersStack.Peek();
+
+    // Write geometry transformed into the current space
+    const Render2DVertex* srcVertices = (const Render2DVertex*)list->_vertices.Get();
+    Render2DVertex* vertices = VB.WriteReserve<Render2DVertex>(list->_verticesCount);
+    RotatedRectangle srcMask = RecordingClipMask, mask = clip.Mask;
+    for (int32 i = 0; i < list->_verticesCount; i++)
+    {
+        const Render2DVertex& src = srcVertices[i];
+        Render2DVertex& dst = vertices[i];
+        ApplyTransform(src.Position, dst.Position);
+        dst.TexCoord = src.TexCoord;
+        dst.Color = src.Color * tint;
+        dst.CustomData = src.CustomData;
+
+        // Clip mask is shared by many vertices so transform it only when it changes
+        if (Platform::MemoryCompare(&src.ClipMask, &srcMask, sizeof(RotatedRectangle)) != 0)
+        {
+            srcMask = src.ClipMask;
+            if (Platform::MemoryCompare(&srcMask, &RecordingClipMask, sizeof(RotatedRectangle)) == 0)
+            {
+                mask = clip.Mask;
+            }
+            else
+            {
+                Matrix3x3::Transform2DPoint(srcMask.TopLeft, TransformCached, mask.TopLeft);
+                Matrix3x3::Transform2DVector(srcMask.ExtentX, TransformCached, mask.ExtentX);
+                Matrix3x3::Transform2DVector(srcMask.ExtentY, TransformCached, mask.ExtentY);
+            }
+        }
+        dst.ClipMask = mask;
+    }
+    const uint32* srcIndices = list->_indices.Get();
+    uint32* indices = IB.WriteReserve<uint32>(list->_indices.Count());
+    for (int32 i = 0; i < list->_indices.Count(); i++)
+        indices[i] = srcIndices[i] + VBIndex;
+
+    // Add draw calls
+    const Render2DDrawCall* srcDrawCalls = (const Render2DDrawCall*)list->_drawCalls.Get();
+    DrawCalls.EnsureCapacity(DrawCalls.Count() + list->_drawCallsCount);
+    for (int32 i = 0; i < list->_drawCallsCount; i++)
+    {
+        Render2DDrawCall drawCall = srcDrawCalls[i];
+        drawCall.StartIB += IBIndex;
+        if (drawCall.Type == DrawCallType::ClipScissors)
+        {
+            if (!IsScissorsRectEnabled)
+                continue;
+            Rectangle& bounds = *(Rectangle*)&drawCall.AsClipScissors.X;
+            if (bounds == RecordingClipBounds)
+            {
+                bounds = clip.Bounds;
+            }
+            else
+            {
+                RotatedRectangle boundsTransformed;
+                ApplyTransform(bounds, boundsTransformed);
+                bounds = Rectangle::Shared(boundsTransformed.ToBoundingRect(), clip.Bounds);
+            }
+        }
+        else if (drawCall.Type == DrawCallType::Blur)
+        {
+            Float2 p;
+            ApplyTransform(Float2(drawCall.AsBlur.UpperLeftX, drawCall.AsBlur.UpperLeftY), p);
+            drawCall.AsBlur.UpperLeftX = p.X;
+            drawCall.AsBlur.UpperLeftY = p.Y;
+            ApplyTransform(Float2(drawCall.AsBlur.BottomRightX, drawCall.AsBlur.BottomRightY), p);
+            drawCall.AsBlur.BottomRightX = p.X;
+            drawCall.AsBlur.BottomRightY = p.Y;
+        }
+        DrawCalls.Add(drawCall);
+    }
+
+    VBIndex += list->_verticesCount;
+    IBIndex += list->_indices.Count();
+}
+
 void CalculateKernelSize(float strength, int32& kernelSize, int32& downSample)
 {
     kernelSize = Math::RoundToInt(strength * 3.0f);
@@ -992,7 +1221,7 @@ void DrawBatch(int32 startIndex, int32 count)
         material->Bind(bindParams);
 
         // Bind font atlas as a material parameter
-        static StringView FontParamName = TEXT("Font");
+        static const Name FontParamName(TEXT("Font"));
         auto param = material->Params.Get(FontParamName);
         if (param && param->GetParameterType() == MaterialParameterType::Texture)
         {
@@ -1020,6 +1249,7 @@ void DrawBatch(int32 startIndex, int32 count)
     {
         // Bind material
         auto material = (MaterialBase*)d.AsMaterial.Mat;
+        material->Params.RequestTexturesFullQuality(); // UI doesn't limit the textures quality by the on-screen size
         MaterialBase::BindParameters bindParams(Context, *(RenderContext*)nullptr);
         Render2D::CustomData customData;
         customData.ViewProjection = ViewProjection;
@@ -1267,13 +1497,12 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
     uint32 fontAtlasIndex = 0;
     FontTextureAtlas* fontAtlas = nullptr;
     Float2 invAtlasSize = Float2::One;
-    FontCharacterEntry previous;
-    int32 kerning;
     float scale = layout.Scale / FontManager::FontScale;
+    const float baseLineY = Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-    // Process text to get lines
+    // Process text to get lines and glyph positions
     Lines.Clear();
-    font->ProcessText(text, Lines, layout);
+    font->ProcessText(text, Lines, Glyphs, layout);
 
     // Render all lines
     FontCharacterEntry entry;
@@ -1291,13 +1520,12 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
     for (int32 lineIndex = 0; lineIndex < Lines.Count(); lineIndex++)
     {
         const FontLineCache& line = Lines[lineIndex];
-        Float2 pointer = line.Location;
 
-        // Render all characters from the line
+        // Render all characters from the line (omit whitespace characters)
         for (int32 charIndex = line.FirstCharIndex; charIndex <= line.LastCharIndex; charIndex++)
         {
             const Char c = text[charIndex];
-            if (c != '\n')
+            if (c != '\n' && !StringUtils::IsWhitespace(c))
             {
                 font->GetCharacter(c, entry);
 
@@ -1320,41 +1548,22 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     }
                 }
 
-                // Get kerning
-                const bool isWhitespace = StringUtils::IsWhitespace(c);
-                if (!isWhitespace && previous.IsValid)
-                {
-                    kerning = font->GetKerning(previous.Character, entry.Character);
-                }
-                else
-                {
-                    kerning = 0;
-                }
-                pointer.X += (float)kerning * scale;
-                previous = entry;
-
-                // Omit whitespace characters
-                if (!isWhitespace)
-                {
-                    // Calculate character size and atlas coordinates
-                    const float x = pointer.X + entry.OffsetX * scale;
-                    const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
-
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
-                    charRect.Offset(layout.Bounds.Location);
+                // Calculate character size and atlas coordinates
+                const Float2& pointer = Glyphs[charIndex];
+                const float x = pointer.X + entry.OffsetX * scale;
+                const float y = pointer.Y - entry.OffsetY * scale + baseLineY;
 
-                    Float2 upperLeftUV = entry.UV * invAtlasSize;
-                    Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
+                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                charRect.Offset(layout.Bounds.Location);
 
-                    // Add draw call
-                    drawCall.StartIB = IBIndex;
-                    drawCall.CountIB = 6;
-                    DrawCalls.Add(drawCall);
-                    WriteRect(charRect, color, upperLeftUV, rightBottomUV);
-                }
+                Float2 upperLeftUV = entry.UV * invAtlasSize;
+                Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
-                // Move
-                pointer.X += entry.AdvanceX * scale;
+                // Add draw call
+                drawCall.StartIB = IBIndex;
+                drawCall.CountIB = 6;
+                DrawCalls.Add(drawCall);
+                WriteRect(charRect, color, upperLeftUV, rightBottomUV);
             }
         }
     }
@@ -1588,6 +1797,8 @@ void Render2D::DrawTexture(TextureBase* t, const Rectangle& rect, const Color& c
     drawCall.AsTexture.Ptr = t ? t->GetTexture() : nullptr;
     DrawCalls.Add(drawCall);
     WriteRect(rect, color);
+    if (t)
+        t->StreamingTexture()->RequestMip(0); // UI doesn't limit the textures quality by the on-screen size
 }
 
 void Render2D::DrawSprite(const SpriteHandle& spriteHandle, const Rectangle& rect, const Color& color)
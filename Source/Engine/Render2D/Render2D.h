@@ -15,6 +15,7 @@ struct Matrix3x3;
 struct Viewport;
 struct TextRange;
 class Font;
+class Render2DCommandList;
 class GPUPipelineState;
 class GPUTexture;
 class GPUTextureView;
@@ -172,6 +173,24 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
     /// </summary>
     API_FUNCTION() static void PopTint();
 
+public:
+    /// <summary>
+    /// Begins recording the drawing into the command list (replaces its contents). Drawing is recorded relative to the current transformation, tint and clipping so the list can be replayed later with different ones. Recordings can be nested and can replay other command lists.
+    /// </summary>
+    /// <param name="list">The command list to record to.</param>
+    API_FUNCTION() static void BeginRecording(Render2DCommandList* list);
+
+    /// <summary>
+    /// Ends recording the drawing into the command list started with BeginRecording. The recorded drawing is also drawn (using the current transformation, tint and clipping).
+    /// </summary>
+    API_FUNCTION() static void EndRecording();
+
+    /// <summary>
+    /// Draws the recorded command list using the current transformation, tint and clipping. Skips emitting the geometry and batching the draw calls again.
+    /// </summary>
+    /// <param name="list">The command list to draw.</param>
+    API_FUNCTION() static void DrawCommandList(Render2DCommandList* list);
+
 public:
     /// <summary>
     /// Draws a text.
@@ -0,0 +1,83 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+/// <summary>
+/// The recorded Render2D drawing (geometry, batched draw calls and clipping) that can be replayed many times with only the transformation, tint and clipping update. Used to cache drawing of the static UI.
+/// </summary>
+/// <remarks>
+/// Drawing is recorded relative to the transformation, tint and clipping active when the recording started (see Render2D.BeginRecording). The recorded draw calls reference the used textures, materials and font atlases directly, so the list gets outdated (and is not drawn) when the font characters get invalidated, the font scale changes or any texture, material or font asset gets unloaded or reloaded. Then it has to be recorded again. Use InvalidateAll after modifying or destroying the GPU textures used directly.
+/// </remarks>
+API_CLASS(Sealed) class FLAXENGINE_API Render2DCommandList : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE(Render2DCommandList);
+    friend class Render2D;
+private:
+    Array<byte> _vertices;
+    Array<uint32> _indices;
+    Array<byte> _drawCalls;
+    int32 _verticesCount = 0;
+    int32 _drawCallsCount = 0;
+    int64 _resourcesVersion = 0;
+    float _fontScale = 0.0f;
+    static volatile int64 ResourcesVersion;
+
+public:
+    /// <summary>
+    /// Returns true if list has nothing to draw.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsEmpty() const
+    {
+        return _drawCallsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if the resources used by the recorded drawing have been changed since the recording (eg. font characters invalidated or texture asset reloaded) so the list has to be recorded again. Outdated list is not drawn.
+    /// </summary>
+    API_PROPERTY() bool IsOutdated() const;
+
+    /// <summary>
+    /// Gets the amount of the recorded vertices.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetVerticesCount() const
+    {
+        return _verticesCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the recorded indices.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetIndicesCount() const
+    {
+        return _indices.Count();
+    }
+
+    /// <summary>
+    /// Gets the amount of the recorded draw calls (after merging the ones that can be batched together).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetDrawCallsCount() const
+    {
+        return _drawCallsCount;
+    }
+
+    /// <summary>
+    /// Gets the recorded vertices data (in Render2D vertex buffer layout, relative to the recording start state).
+    /// </summary>
+    FORCE_INLINE const Array<byte>& GetVertices() const
+    {
+        return _vertices;
+    }
+
+    /// <summary>
+    /// Clears the recorded drawing.
+    /// </summary>
+    API_FUNCTION() void Clear();
+
+    /// <summary>
+    /// Marks all the recorded command lists as outdated. Use it after modifying or destroying the GPU textures used by the recorded drawing.
+    /// </summary>
+    API_FUNCTION() static void InvalidateAll();
+};
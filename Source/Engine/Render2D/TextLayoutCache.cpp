@@ -0,0 +1,241 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "TextLayoutCache.h"
+#include "Font.h"
+#include "FontManager.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/Threading.h"
+
+namespace
+{
+    struct TextLayoutKey
+    {
+        const Font* FontObject;
+        uint32 TextHash;
+        int32 TextLength;
+        float FontScale;
+        TextLayoutOptions Layout;
+
+        bool operator==(const TextLayoutKey& other) const
+        {
+            // Exact comparison to be consistent with the hash (bounds location is skipped since the lines and glyphs are relative to the bounds)
+            return FontObject == other.FontObject
+                    && TextHash == other.TextHash
+                    && TextLength == other.TextLength
+                    && FontScale == other.FontScale
+                    && Layout.Bounds.Size == other.Layout.Bounds.Size
+                    && Layout.HorizontalAlignment == other.Layout.HorizontalAlignment
+                    && Layout.VerticalAlignment == other.Layout.VerticalAlignment
+                    && Layout.TextWrapping == other.Layout.TextWrapping
+                    && Layout.Scale == other.Layout.Scale
+                    && Layout.BaseLinesGapScale == other.Layout.BaseLinesGapScale;
+        }
+    };
+
+    uint32 GetHash(const TextLayoutKey& key)
+    {
+        uint32 hash = key.TextHash;
+        CombineHash(hash, ::GetHash(key.FontObject));
+        CombineHash(hash, ::GetHash(key.FontScale));
+        CombineHash(hash, ::GetHash(key.Layout.Bounds.Size.X));
+        CombineHash(hash, ::GetHash(key.Layout.Bounds.Size.Y));
+        CombineHash(hash, (uint32)key.Layout.HorizontalAlignment | (uint32)key.Layout.VerticalAlignment << 8 | (uint32)key.Layout.TextWrapping << 16);
+        CombineHash(hash, ::GetHash(key.Layout.Scale));
+        CombineHash(hash, ::GetHash(key.Layout.BaseLinesGapScale));
+        return hash;
+    }
+
+    struct TextLayoutEntry
+    {
+        TextLayoutKey Key;
+        Array<Char> Text;
+        Array<FontLineCache> Lines;
+        Array<Float2> Glyphs;
+        double Time;
+        int32 Prev;
+        int32 Next;
+
+        int64 GetMemoryUsage() const
+        {
+            return Text.Capacity() * sizeof(Char) + Lines.Capacity() * sizeof(FontLineCache) + Glyphs.Capacity() * sizeof(Float2);
+        }
+    };
+
+    CriticalSection Locker;
+    Array<TextLayoutEntry> Entries;
+    Array<int32> FreeEntries;
+    Dictionary<TextLayoutKey, int32> EntriesLookup;
+    int32 First = INVALID_INDEX; // Most recently used
+    int32 Last = INVALID_INDEX; // Least recently used
+    TextLayoutCacheStats Stats;
+
+    TextLayoutKey GetKey(const Font* font, const StringView& text, const TextLayoutOptions& layout)
+    {
+        TextLayoutKey key;
+        key.FontObject = font;
+        key.TextHash = ::GetHash(text);
+        key.TextLength = text.Length();
+        key.FontScale = FontManager::FontScale;
+        key.Layout = layout;
+        return key;
+    }
+
+    void Unlink(int32 index)
+    {
+        TextLayoutEntry& entry = Entries[index];
+        if (entry.Prev != INVALID_INDEX)
+            Entries[entry.Prev].Next = entry.Next;
+        else
+            First = entry.Next;
+        if (entry.Next != INVALID_INDEX)
+            Entries[entry.Next].Prev = entry.Prev;
+        else
+            Last = entry.Prev;
+    }
+
+    void LinkFirst(int32 index)
+    {
+        TextLayoutEntry& entry = Entries[index];
+        entry.Prev = INVALID_INDEX;
+        entry.Next = First;
+        if (First != INVALID_INDEX)
+            Entries[First].Prev = index;
+        First = index;
+        if (Last == INVALID_INDEX)
+            Last = index;
+    }
+
+    void ClearEntries()
+    {
+        Entries.Resize(0);
+        FreeEntries.Clear();
+        EntriesLookup.Clear();
+        First = Last = INVALID_INDEX;
+        Stats.MemoryUsage = 0;
+    }
+}
+
+int32 TextLayoutCache::Capacity = 1024;
+int32 TextLayoutCache::MaxTextLength = 8 * 1024;
+
+TextLayoutCacheStats TextLayoutCache::GetStats()
+{
+    ScopeLock lock(Locker);
+    TextLayoutCacheStats stats = Stats;
+    stats.Count = EntriesLookup.Count();
+    return stats;
+}
+
+void TextLayoutCache::ResetStats()
+{
+    ScopeLock lock(Locker);
+    Stats.Hits = 0;
+    Stats.Misses = 0;
+    Stats.Evictions = 0;
+    Stats.TimeSavedMs = 0;
+}
+
+void TextLayoutCache::Clear()
+{
+    ScopeLock lock(Locker);
+    ClearEntries();
+}
+
+void TextLayoutCache::Invalidate(const Font* font)
+{
+    ScopeLock lock(Locker);
+    for (int32 index = First; index != INVALID_INDEX;)
+    {
+        TextLayoutEntry& entry = Entries[index];
+        const int32 next = entry.Next;
+        if (entry.Key.FontObject == font)
+        {
+            Unlink(index);
+            EntriesLookup.Remove(entry.Key);
+            Stats.MemoryUsage -= entry.GetMemoryUsage();
+            entry.Text.SetCapacity(0, false);
+            entry.Lines.SetCapacity(0, false);
+            entry.Glyphs.SetCapacity(0, false);
+            FreeEntries.Add(index);
+        }
+        index = next;
+    }
+}
+
+bool TextLayoutCache::TryGet(const Font* font, const StringView& text, const TextLayoutOptions& layout, Array<FontLineCache>& outputLines, Array<Float2>* outputGlyphs)
+{
+    if (!CanCache(text))
+        return false;
+    const TextLayoutKey key = GetKey(font, text, layout);
+    ScopeLock lock(Locker);
+    int32 index;
+    if (EntriesLookup.TryGet(key, index))
+    {
+        // Skip on the text hash collision
+        TextLayoutEntry& entry = Entries[index];
+        if (Platform::MemoryCompare(entry.Text.Get(), text.Get(), text.Length() * sizeof(Char)) == 0)
+        {
+            Unlink(index);
+            LinkFirst(index);
+            outputLines.Add(entry.Lines.Get(), entry.Lines.Count());
+            if (outputGlyphs)
+                outputGlyphs->Set(entry.Glyphs.Get(), entry.Glyphs.Count());
+            Stats.Hits++;
+            Stats.TimeSavedMs += entry.Time * 1000.0;
+            return true;
+        }
+    }
+    Stats.Misses++;
+    return false;
+}
+
+void TextLayoutCache::Add(const Font* font, const StringView& text, const TextLayoutOptions& layout, const FontLineCache* lines, int32 linesCount, const Array<Float2>& glyphs, double time)
+{
+    if (!CanCache(text))
+        return;
+    const TextLayoutKey key = GetKey(font, text, layout);
+    ScopeLock lock(Locker);
+
+    // Capacity can be changed at runtime
+    if (Entries.Count() > Capacity)
+        ClearEntries();
+
+    int32 index;
+    if (EntriesLookup.TryGet(key, index))
+    {
+        // Replace the existing entry (text hash collision or added by other thread)
+        Unlink(index);
+    }
+    else
+    {
+        if (FreeEntries.HasItems())
+        {
+            index = FreeEntries.Pop();
+        }
+        else if (Entries.Count() < Capacity)
+        {
+            index = Entries.Count();
+            Entries.AddDefault(1);
+        }
+        else
+        {
+            // Reuse the least recently used entry
+            index = Last;
+            Unlink(index);
+            EntriesLookup.Remove(Entries[index].Key);
+            Stats.Evictions++;
+        }
+        EntriesLookup.Add(key, index);
+    }
+
+    TextLayoutEntry& entry = Entries[index];
+    Stats.MemoryUsage -= entry.GetMemoryUsage();
+    entry.Key = key;
+    entry.Text.Set(text.Get(), text.Length());
+    entry.Lines.Set(lines, linesCount);
+    entry.Glyphs.Set(glyphs.Get(), glyphs.Count());
+    entry.Time = time;
+    Stats.MemoryUsage += entry.GetMemoryUsage();
+    LinkFirst(index);
+}
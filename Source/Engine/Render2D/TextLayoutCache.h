@@ -0,0 +1,126 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Scripting/ScriptingType.h"
+#include "TextLayoutOptions.h"
+
+class Font;
+struct FontLineCache;
+
+/// <summary>
+/// The text layouts cache statistics.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API TextLayoutCacheStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(TextLayoutCacheStats);
+
+    /// <summary>
+    /// The amount of text layouts reused from the cache.
+    /// </summary>
+    API_FIELD() int64 Hits = 0;
+
+    /// <summary>
+    /// The amount of text layouts that were processed because the cache didn't contain them. Hit rate is Hits divided by the sum of Hits and Misses.
+    /// </summary>
+    API_FIELD() int64 Misses = 0;
+
+    /// <summary>
+    /// The amount of cached text layouts removed to make space for the new ones (least recently used first).
+    /// </summary>
+    API_FIELD() int64 Evictions = 0;
+
+    /// <summary>
+    /// The current amount of the cached text layouts.
+    /// </summary>
+    API_FIELD() int32 Count = 0;
+
+    /// <summary>
+    /// The current memory used by the cached text layouts (in bytes).
+    /// </summary>
+    API_FIELD() int64 MemoryUsage = 0;
+
+    /// <summary>
+    /// The estimated time saved by reusing the cached text layouts (in milliseconds). Sum of the time it took to process each layout multiplied by the amount of its reuses.
+    /// </summary>
+    API_FIELD() double TimeSavedMs = 0;
+};
+
+/// <summary>
+/// The bounded cache of the processed text layouts (lines and glyph positions) used by the fonts. UI redraws the same texts with the same layout every frame so the text processing is done once and then reused until the layout gets evicted (least recently used first).
+/// </summary>
+/// <remarks>
+/// The layouts are keyed by the font, the text and the layout options. The cached font layouts are invalidated when the font characters get invalidated.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API TextLayoutCache
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(TextLayoutCache);
+
+    /// <summary>
+    /// The maximum amount of the cached text layouts. Use 0 to disable caching.
+    /// </summary>
+    API_FIELD() static int32 Capacity;
+
+    /// <summary>
+    /// The maximum length of the text (in characters) to cache. Longer texts are always processed.
+    /// </summary>
+    API_FIELD() static int32 MaxTextLength;
+
+public:
+    /// <summary>
+    /// Gets the cache statistics.
+    /// </summary>
+    API_FUNCTION() static TextLayoutCacheStats GetStats();
+
+    /// <summary>
+    /// Resets the cache statistics counters (hits, misses, evictions and time saved).
+    /// </summary>
+    API_FUNCTION() static void ResetStats();
+
+    /// <summary>
+    /// Removes all the cached text layouts.
+    /// </summary>
+    API_FUNCTION() static void Clear();
+
+    /// <summary>
+    /// Removes all the cached text layouts of the given font.
+    /// </summary>
+    /// <param name="font">The font.</param>
+    static void Invalidate(const Font* font);
+
+public:
+    /// <summary>
+    /// Checks if the text layout can be cached.
+    /// </summary>
+    /// <param name="text">The text.</param>
+    /// <returns>True if the text layout can be cached, otherwise false.</returns>
+    FORCE_INLINE static bool CanCache(const StringView& text)
+    {
+        return Capacity > 0 && text.Length() <= MaxTextLength;
+    }
+
+    /// <summary>
+    /// Tries to get the cached text layout.
+    /// </summary>
+    /// <param name="font">The font.</param>
+    /// <param name="text">The text.</param>
+    /// <param name="layout">The layout options.</param>
+    /// <param name="outputLines">The output lines list (cached lines are appended to it).</param>
+    /// <param name="outputGlyphs">The output glyph positions (one per text character). Optional.</param>
+    /// <returns>True if layout has been found, otherwise false.</returns>
+    static bool TryGet(const Font* font, const StringView& text, const TextLayoutOptions& layout, Array<FontLineCache>& outputLines, Array<Float2>* outputGlyphs);
+
+    /// <summary>
+    /// Adds the processed text layout to the cache.
+    /// </summary>
+    /// <param name="font">The font.</param>
+    /// <param name="text">The text.</param>
+    /// <param name="layout">The layout options.</param>
+    /// <param name="lines">The text lines.</param>
+    /// <param name="linesCount">The text lines count.</param>
+    /// <param name="glyphs">The glyph positions (one per text character).</param>
+    /// <param name="time">The time it took to process the text (in seconds).</param>
+    static void Add(const Font* font, const StringView& text, const TextLayoutOptions& layout, const FontLineCache* lines, int32 linesCount, const Array<Float2>& glyphs, double time);
+};
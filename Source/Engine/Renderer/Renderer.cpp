@@ -32,6 +32,7 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #include "Editor/QuadOverdrawPass.h"
@@ -163,6 +164,7 @@ bool Renderer::IsReady()
 void Renderer::Render(SceneRenderTask* task)
 {
     PROFILE_GPU_CPU_NAMED("Render Frame");
+    PROFILE_MEM(Rendering);
 
     auto context = GPUDevice::Instance->GetMainContext();
 
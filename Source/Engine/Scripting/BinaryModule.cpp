@@ -589,10 +589,10 @@ ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const S
     module->Types.AddUninitialized();
     new(module->Types.Get() + TypeIndex)ScriptingType(fullname, module, size, initRuntime, spawn, baseType, setupScriptVTable, setupScriptObjectVTable, interfaces);
 #if BUILD_DEBUG
-    if (module->TypeNameToTypeIndex.ContainsKey(fullname))
+    if (module->TypeNameToTypeIndex.ContainsKey(Name(fullname)))
         LOG(Error, "Duplicated native typename {0} from module {1}.", String(fullname), String(module->GetName()));
 #endif
-    module->TypeNameToTypeIndex[fullname] = TypeIndex;
+    module->TypeNameToTypeIndex[Name(fullname)] = TypeIndex;
 }
 
 ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const StringAnsiView& fullname, int32 size, ScriptingType::InitRuntimeHandler initRuntime, ScriptingType::Ctor ctor, ScriptingType::Dtor dtor, ScriptingTypeInitializer* baseType, const ScriptingType::InterfaceImplementation* interfaces)
@@ -602,10 +602,10 @@ ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const S
     module->Types.AddUninitialized();
     new(module->Types.Get() + TypeIndex)ScriptingType(fullname, module, size, initRuntime, ctor, dtor, baseType, interfaces);
 #if BUILD_DEBUG
-    if (module->TypeNameToTypeIndex.ContainsKey(fullname))
+    if (module->TypeNameToTypeIndex.ContainsKey(Name(fullname)))
         LOG(Error, "Duplicated native typename {0} from module {1}.", String(fullname), String(module->GetName()));
 #endif
-    module->TypeNameToTypeIndex[fullname] = TypeIndex;
+    module->TypeNameToTypeIndex[Name(fullname)] = TypeIndex;
 }
 
 ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const StringAnsiView& fullname, int32 size, ScriptingType::InitRuntimeHandler initRuntime, ScriptingType::Ctor ctor, ScriptingType::Dtor dtor, ScriptingType::Copy copy, ScriptingType::Box box, ScriptingType::Unbox unbox, ScriptingType::GetField getField, ScriptingType::SetField setField, ScriptingTypeInitializer* baseType, const ScriptingType::InterfaceImplementation* interfaces)
@@ -615,10 +615,10 @@ ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const S
     module->Types.AddUninitialized();
     new(module->Types.Get() + TypeIndex)ScriptingType(fullname, module, size, initRuntime, ctor, dtor, copy, box, unbox, getField, setField, baseType, interfaces);
 #if BUILD_DEBUG
-    if (module->TypeNameToTypeIndex.ContainsKey(fullname))
+    if (module->TypeNameToTypeIndex.ContainsKey(Name(fullname)))
         LOG(Error, "Duplicated native typename {0} from module {1}.", String(fullname), String(module->GetName()));
 #endif
-    module->TypeNameToTypeIndex[fullname] = TypeIndex;
+    module->TypeNameToTypeIndex[Name(fullname)] = TypeIndex;
 }
 
 ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const StringAnsiView& fullname, int32 size, ScriptingType::EnumItem* items)
@@ -628,10 +628,10 @@ ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const S
     module->Types.AddUninitialized();
     new(module->Types.Get() + TypeIndex)ScriptingType(fullname, module, size, items);
 #if BUILD_DEBUG
-    if (module->TypeNameToTypeIndex.ContainsKey(fullname))
+    if (module->TypeNameToTypeIndex.ContainsKey(Name(fullname)))
         LOG(Error, "Duplicated native typename {0} from module {1}.", String(fullname), String(module->GetName()));
 #endif
-    module->TypeNameToTypeIndex[fullname] = TypeIndex;
+    module->TypeNameToTypeIndex[Name(fullname)] = TypeIndex;
 }
 
 ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const StringAnsiView& fullname, ScriptingType::InitRuntimeHandler initRuntime, ScriptingType::SetupScriptVTableHandler setupScriptVTable, ScriptingType::SetupScriptObjectVTableHandler setupScriptObjectVTable, ScriptingType::GetInterfaceWrapper getInterfaceWrapper)
@@ -641,10 +641,10 @@ ScriptingTypeInitializer::ScriptingTypeInitializer(BinaryModule* module, const S
     module->Types.AddUninitialized();
     new(module->Types.Get() + TypeIndex)ScriptingType(fullname, module, initRuntime, setupScriptVTable, setupScriptObjectVTable, getInterfaceWrapper);
 #if BUILD_DEBUG
-    if (module->TypeNameToTypeIndex.ContainsKey(fullname))
+    if (module->TypeNameToTypeIndex.ContainsKey(Name(fullname)))
         LOG(Error, "Duplicated native typename {0} from module {1}.", String(fullname), String(module->GetName()));
 #endif
-    module->TypeNameToTypeIndex[fullname] = TypeIndex;
+    module->TypeNameToTypeIndex[Name(fullname)] = TypeIndex;
 }
 
 BinaryModule::BinaryModulesList& BinaryModule::GetModules()
@@ -956,7 +956,7 @@ void ManagedBinaryModule::InitType(MClass* mclass)
 #if !COMPILE_WITHOUT_CSHARP
     // Skip if already initialized
     const MString& typeName = mclass->GetFullName();
-    if (TypeNameToTypeIndex.ContainsKey(typeName))
+    if (TypeNameToTypeIndex.ContainsKey(Name(typeName)))
         return;
 
     // Find first native base C++ class of this C# class
@@ -982,7 +982,7 @@ void ManagedBinaryModule::InitType(MClass* mclass)
     }
     if (baseType.Module == this)
         InitType(baseClass); // Ensure base is initialized before
-    baseType.Module->TypeNameToTypeIndex.TryGet(baseClass->GetFullName(), *(int32*)&baseType.TypeIndex);
+    baseType.Module->TypeNameToTypeIndex.TryGet(Name(baseClass->GetFullName()), *(int32*)&baseType.TypeIndex);
     if (!baseType)
     {
         LOG(Error, "Missing base class for managed class {0} from assembly {1}.", String(typeName), Assembly->ToString());
@@ -1047,7 +1047,7 @@ void ManagedBinaryModule::InitType(MClass* mclass)
     const int32 typeIndex = Types.Count();
     Types.AddUninitialized();
     new(Types.Get() + Types.Count() - 1)ScriptingType(typeName, this, baseType.GetType().Size, ScriptingType::DefaultInitRuntime, ManagedObjectSpawn, baseType, nullptr, nullptr, interfaces);
-    TypeNameToTypeIndex[typeName] = typeIndex;
+    TypeNameToTypeIndex[Name(typeName)] = typeIndex;
     auto& type = Types[typeIndex];
     type.ManagedClass = mclass;
 
@@ -1104,8 +1104,7 @@ void ManagedBinaryModule::OnUnloading(MAssembly* assembly)
     for (int32 i = _firstManagedTypeIndex; i < Types.Count(); i++)
     {
         const ScriptingType& type = Types[i];
-        const MString typeName(type.Fullname.Get(), type.Fullname.Length());
-        TypeNameToTypeIndex.Remove(typeName);
+        TypeNameToTypeIndex.Remove(Name(type.Fullname));
     }
 }
 
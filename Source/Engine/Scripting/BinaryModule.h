@@ -5,6 +5,7 @@
 #include "ScriptingType.h"
 #include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Name.h"
 #include "Engine/Core/Types/Variant.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/Array.h"
@@ -87,7 +88,7 @@ class FLAXENGINE_API BinaryModule
     /// <summary>
     /// The scripting types cache that maps the full typename to the scripting type index. Build after adding the type to the assembly.
     /// </summary>
-    Dictionary<StringAnsi, int32> TypeNameToTypeIndex;
+    Dictionary<Name, int32> TypeNameToTypeIndex;
 
 public:
 
@@ -108,9 +109,23 @@ class FLAXENGINE_API BinaryModule
     /// <param name="typeName">The full name of the type eg: System.Int64.MaxInt.</param>
     /// <param name="typeIndex">The result type index in Types array of this module. Valid only if method returns true.</param>
     /// <returns>True if found a type, otherwise false.</returns>
-    virtual bool FindScriptingType(const StringAnsiView& typeName, int32& typeIndex)
+    bool FindScriptingType(const StringAnsiView& typeName, int32& typeIndex)
     {
-        return TypeNameToTypeIndex.TryGet(typeName, typeIndex);
+        Name name;
+        Name::Find(typeName, name);
+        return FindScriptingType(typeName, name, typeIndex);
+    }
+
+    /// <summary>
+    /// Tries to find a given scripting type by the full name.
+    /// </summary>
+    /// <param name="typeName">The full name of the type eg: System.Int64.MaxInt.</param>
+    /// <param name="name">The interned full name of the type (empty if the name has not been interned so none of the registered types uses it). Used to look up the name once for all modules.</param>
+    /// <param name="typeIndex">The result type index in Types array of this module. Valid only if method returns true.</param>
+    /// <returns>True if found a type, otherwise false.</returns>
+    virtual bool FindScriptingType(const StringAnsiView& typeName, const Name& name, int32& typeIndex)
+    {
+        return name.HasChars() && TypeNameToTypeIndex.TryGet(name, typeIndex);
     }
 
     /// <summary>
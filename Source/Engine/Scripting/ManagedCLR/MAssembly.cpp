@@ -156,6 +156,9 @@ void MAssembly::Unload(bool isReloading)
     _isLoaded = false;
     _hasCachedClasses = false;
     _classes.ClearDelete();
+#if COMPILE_WITH_PROFILER
+    ProfilerCPU::InvalidateNamesCache();
+#endif
 
     Unloaded(this);
 }
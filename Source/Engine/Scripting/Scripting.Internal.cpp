@@ -42,7 +42,7 @@ namespace ProfilerInternal
     {
 #if COMPILE_WITH_PROFILER
         const StringView name((const Char*)mono_string_chars(nameObj), mono_string_length(nameObj));
-        ProfilerCPU::BeginEvent(*name);
+        ProfilerCPU::BeginEvent(ProfilerCPU::GetNameId(name));
 #if TRACY_ENABLE
 #if PROFILE_CPU_USE_TRANSIENT_DATA
         tracy::ScopedZone::Begin(__LINE__, __FILE__, strlen( __FILE__ ), __FUNCTION__, strlen( __FUNCTION__ ), name.Get(), name.Length() );
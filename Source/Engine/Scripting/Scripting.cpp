@@ -24,6 +24,7 @@
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
@@ -198,6 +199,7 @@ bool ScriptingService::Init()
 void ScriptingService::Update()
 {
     PROFILE_CPU_NAMED("Scripting::Update");
+    PROFILE_MEM(Scripting);
 
     INVOKE_EVENT(Update);
 }
@@ -205,6 +207,7 @@ void ScriptingService::Update()
 void ScriptingService::LateUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateUpdate");
+    PROFILE_MEM(Scripting);
 
     INVOKE_EVENT(LateUpdate);
 }
@@ -212,6 +215,7 @@ void ScriptingService::LateUpdate()
 void ScriptingService::FixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::FixedUpdate");
+    PROFILE_MEM(Scripting);
 
     INVOKE_EVENT(FixedUpdate);
 }
@@ -219,6 +223,7 @@ void ScriptingService::FixedUpdate()
 void ScriptingService::Draw()
 {
     PROFILE_CPU_NAMED("Scripting::Draw");
+    PROFILE_MEM(Scripting);
 
     INVOKE_EVENT(Draw);
 }
@@ -721,10 +726,14 @@ ScriptingTypeHandle Scripting::FindScriptingType(const StringAnsiView& fullname)
         return ScriptingTypeHandle();
     PROFILE_CPU();
     auto& modules = BinaryModule::GetModules();
+    int32 typeIndex;
+
+    // Lookup the interned name once for all modules
+    Name name;
+    Name::Find(fullname, name);
     for (auto module : modules)
     {
-        int32 typeIndex;
-        if (module->FindScriptingType(fullname, typeIndex))
+        if (module->FindScriptingType(fullname, name, typeIndex))
         {
             return ScriptingTypeHandle(module, typeIndex);
         }
@@ -5,6 +5,7 @@
 #include "SerializationFwd.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/Name.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Utilities/Encryption.h"
 
@@ -274,6 +275,20 @@ namespace Serialization
         v = stream.GetTextAnsi();
     }
 
+    inline bool ShouldSerialize(const Name& v, const void* otherObj)
+    {
+        return !otherObj || v != *(Name*)otherObj;
+    }
+    inline void Serialize(ISerializable::SerializeStream& stream, const Name& v, const void* otherObj)
+    {
+        const StringView text = v.ToStringView();
+        stream.String(text.Get(), text.Length());
+    }
+    inline void Deserialize(ISerializable::DeserializeStream& stream, Name& v, ISerializeModifier* modifier)
+    {
+        v = Name(stream.GetText());
+    }
+
     FLAXENGINE_API bool ShouldSerialize(const Version& v, const void* otherObj);
     FLAXENGINE_API void Serialize(ISerializable::SerializeStream& stream, const Version& v, const void* otherObj);
     FLAXENGINE_API void Deserialize(ISerializable::DeserializeStream& stream, Version& v, ISerializeModifier* modifier);
@@ -30,9 +30,9 @@ bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildC
     // Switch actor type
     if (auto staticModel = dynamic_cast<StaticModel*>(actor))
     {
-        // Check if model has been linked and is loaded
+        // Check if model has been linked and is loaded (with the first LOD streamed in)
         auto model = staticModel->Model.Get();
-        if (model && !model->WaitForLoaded())
+        if (model && !model->WaitForLoaded() && !model->WaitForLOD(0))
         {
             entry.Type = ShadowsOfMordor::Builder::GeometryType::StaticModel;
             entry.UVsBox = Rectangle(Float2::Zero, Float2::One);
@@ -120,7 +120,7 @@ bool cacheStaticGeometryTree(Actor* actor, ShadowsOfMordor::Builder::SceneBuildC
                     && canUseMaterialWithLightmap(type.Entries[0].Material, scene)
                     && entry.Scale > ZeroTolerance;
             auto model = type.Model.Get();
-            if (canUseLightmap && model && !model->WaitForLoaded())
+            if (canUseLightmap && model && !model->WaitForLoaded() && !model->WaitForLOD(0))
             {
                 BoundingBox::FromSphere(instance.Bounds, entry.Box);
                 const int32 lodIndex = 0;
@@ -116,6 +116,19 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
             // Render entry
             auto& entry = scene->Entries[lightmapEntry.Entries[_workerStagePosition1]];
             auto cb = _shader->GetShader()->GetCB(0);
+
+            // Keep the first LOD resident during baking (streaming evicts the LODs not used for drawing), wait for it if it got evicted
+            Model* model = nullptr;
+            if (entry.Type == GeometryType::StaticModel)
+                model = entry.AsStaticModel.Actor->Model.Get();
+            else if (entry.Type == GeometryType::Foliage)
+                model = entry.AsFoliage.Actor->FoliageTypes[entry.AsFoliage.TypeIndex].Model.Get();
+            if (model)
+            {
+                model->RequestLOD(0);
+                if (model->HighestResidentLODIndex() != 0)
+                    break;
+            }
             switch (entry.Type)
             {
             case GeometryType::StaticModel:
@@ -52,10 +52,14 @@ namespace
 StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
+float Streaming::ModelLODsTimeout = 10.0f;
+int32 Streaming::ModelLODsMargin = 1;
 
 void StreamingSettings::Apply()
 {
     Streaming::TextureGroups = TextureGroups;
+    Streaming::ModelLODsTimeout = ModelLODsTimeout;
+    Streaming::ModelLODsMargin = ModelLODsMargin;
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(TextureGroups.Count(), false);
 }
@@ -63,6 +67,8 @@ void StreamingSettings::Apply()
 void StreamingSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
 {
     DESERIALIZE(TextureGroups);
+    DESERIALIZE(ModelLODsTimeout);
+    DESERIALIZE(ModelLODsMargin);
 }
 
 StreamableResource::StreamableResource(StreamingGroup* group)
@@ -273,10 +279,18 @@ StreamingStats Streaming::GetStats()
     StreamingStats stats;
     ResourcesLock.Lock();
     stats.ResourcesCount = Resources.Count();
+    StreamingGroup* models = StreamingGroups::Instance()->Models();
+    StreamingGroup* skinnedModels = StreamingGroups::Instance()->SkinnedModels();
     for (auto e : Resources)
     {
         if (e->Streaming.TargetResidency > e->GetCurrentResidency())
             stats.StreamingResourcesCount++;
+        if (e->GetGroup() == models || e->GetGroup() == skinnedModels)
+        {
+            stats.ModelsCount++;
+            stats.ModelLODsResident += e->GetCurrentResidency();
+            stats.ModelLODsTotal += e->GetMaxResidency();
+        }
     }
     ResourcesLock.Unlock();
     return stats;
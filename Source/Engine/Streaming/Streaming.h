@@ -16,6 +16,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 ResourcesCount = 0;
     // Amount of resources that are during streaming in (target residency is higher that the current). Zero if all resources are streamed in.
     API_FIELD() int32 StreamingResourcesCount = 0;
+    // Amount of the streamable models (including skinned models).
+    API_FIELD() int32 ModelsCount = 0;
+    // Amount of the LODs loaded by all the streamable models.
+    API_FIELD() int32 ModelLODsResident = 0;
+    // Amount of the LODs of all the streamable models.
+    API_FIELD() int32 ModelLODsTotal = 0;
 };
 
 /// <summary>
@@ -30,6 +36,16 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The time (in seconds) after which the unused higher quality model LODs are streamed out. Set to 0 to keep all the model LODs loaded.
+    /// </summary>
+    API_FIELD() static float ModelLODsTimeout;
+
+    /// <summary>
+    /// The amount of the higher quality model LODs to keep loaded above the one used for rendering (streamed in ahead of the need).
+    /// </summary>
+    API_FIELD() static int32 ModelLODsMargin;
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
@@ -29,6 +29,25 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
         {
             result *= group.QualityIfInvisible;
         }
+
+        // Limit quality to the most detailed mip requested by the rendering
+        int32 requestedMip = texture.FlushRequestedMip();
+        if (requestedMip != MAX_int32)
+        {
+            texture._lastRequestedMip = requestedMip;
+            texture._lastRequestedMipTime = currentTime;
+        }
+        else if (currentTime - texture._lastRequestedMipTime < 1.0)
+        {
+            // Keep the last request for a while to not bump the quality if there was no frame drawn since the last update
+            requestedMip = texture._lastRequestedMip;
+        }
+        if (group.UseScreenSize && requestedMip != MAX_int32)
+        {
+            const int32 totalMipLevels = texture.TotalMipLevels();
+            const int32 requiredMipLevels = Math::Max(totalMipLevels - requestedMip, 1);
+            result = Math::Min(result, ((float)requiredMipLevels - 0.5f) / (float)totalMipLevels); // Half-mip offset to match rounding up in CalculateResidency
+        }
     }
     return result;
 }
@@ -93,10 +112,28 @@ int32 TexturesStreamingHandler::CalculateRequestedResidency(StreamableResource*
     return residency;
 }
 
+namespace
+{
+    float CalculateModelQuality(int32 usedLOD, int32 lodCount)
+    {
+        // Keep the lowest LOD always loaded (model has to be drawable to request higher LODs) and a margin of higher LODs to stream them in ahead of the need
+        usedLOD = Math::Min(usedLOD, lodCount - 1);
+        const int32 highestLOD = Math::Max(usedLOD - Streaming::ModelLODsMargin, 0);
+        return ((float)(lodCount - highestLOD) - 0.5f) / (float)lodCount; // Half-LOD offset to match rounding up in CalculateResidency
+    }
+}
+
 float ModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
-    // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
-    return 1.0f;
+    ASSERT(resource);
+    auto& model = *(Model*)resource;
+    const int32 lodCount = model.GetLODsCount();
+    if (Streaming::ModelLODsTimeout <= 0.0f || lodCount <= 1)
+        return 1.0f;
+
+    // Quality based on the LODs used for rendering
+    const int32 usedLOD = model.UpdateUsedLOD(currentTime, Streaming::ModelLODsTimeout);
+    return CalculateModelQuality(usedLOD, lodCount);
 }
 
 int32 ModelsStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
@@ -136,8 +173,15 @@ int32 ModelsStreamingHandler::CalculateRequestedResidency(StreamableResource* re
 
 float SkinnedModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
-    // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
-    return 1.0f;
+    ASSERT(resource);
+    auto& model = *(SkinnedModel*)resource;
+    const int32 lodCount = model.GetLODsCount();
+    if (Streaming::ModelLODsTimeout <= 0.0f || lodCount <= 1)
+        return 1.0f;
+
+    // Quality based on the LODs used for rendering
+    const int32 usedLOD = model.UpdateUsedLOD(currentTime, Streaming::ModelLODsTimeout);
+    return CalculateModelQuality(usedLOD, lodCount);
 }
 
 int32 SkinnedModelsStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
@@ -19,6 +19,18 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSettings);
     API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Textures\")")
     Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The time (in seconds) after which the unused higher quality model LODs are streamed out (model was not drawn with them for a certain amount of time). Set to 0 to keep all the model LODs loaded.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(200), Limit(0), EditorDisplay(\"Models\", \"LODs Timeout\")")
+    float ModelLODsTimeout = 10.0f;
+
+    /// <summary>
+    /// The amount of the higher quality model LODs to keep loaded above the one used for rendering. Streams LODs in ahead of the need when the camera gets closer to the model.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(210), Limit(0, 6), EditorDisplay(\"Models\", \"LODs Margin\")")
+    int32 ModelLODsMargin = 1;
+
 public:
 
     /// <summary>
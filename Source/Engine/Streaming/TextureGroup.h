@@ -53,6 +53,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(26), Limit(0)")
     float TimeToInvisible = 20.0f;
 
+    /// <summary>
+    /// If checked, the quality of textures in this group is limited by their on-screen size. Meshes compute the mip level required by their projected size and UVs density when drawn, which reduces memory usage of textures on small or distant objects. Disable it for textures used by UI or materials with custom UVs tiling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(27)")
+    bool UseScreenSize = true;
+
     /// <summary>
     /// The minimum amount of loaded mip levels for textures in this group. Defines the amount of the mips that should be always loaded. Higher values decrease streaming usage and keep more mips loaded.
     /// </summary>
@@ -3,6 +3,8 @@
 #include "Terrain.h"
 #include "TerrainPatch.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Color.h"
 #include "Engine/Core/Math/Ray.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Serialization/Serialization.h"
@@ -23,6 +25,7 @@ Terrain::Terrain(const SpawnParams& params)
     , _collisionLod(-1)
     , _lodCount(0)
     , _chunkSize(0)
+    , _retainHeightData(false)
     , _scaleInLightmap(0.1f)
     , _lodDistribution(0.6f)
     , _boundsExtent(Vector3::Zero)
@@ -204,6 +207,207 @@ void Terrain::ClosestPoint(const Vector3& position, Vector3& result) const
     }
 }
 
+TerrainPatch* Terrain::GetCPUDataPatch(const Vector3& localPosition) const
+{
+    if (!_retainHeightData)
+        return nullptr;
+    const float patchSize = _chunkSize * TERRAIN_UNITS_PER_VERTEX * TerrainPatch::CHUNKS_COUNT_EDGE;
+    return GetPatch((int32)Math::Floor((float)localPosition.X / patchSize), (int32)Math::Floor((float)localPosition.Z / patchSize));
+}
+
+bool Terrain::GetHeight(const Vector3& position, float& result) const
+{
+    Vector3 localPosition;
+    _transform.WorldToLocal(position, localPosition);
+    const auto patch = GetCPUDataPatch(localPosition);
+    if (!patch)
+        return false;
+
+    // Keep the CPU data locked during the query so it cannot be released by the other thread
+    ScopeLock lock(patch->_cpuDataLocker);
+    int32 index;
+    Float2 fraction;
+    if (!patch->EnsureCPUData() || !patch->GetCPUDataCell(localPosition, index, fraction))
+        return false;
+
+    // Bilinear filtering of the quantized heights
+    const int32 heightMapSize = _chunkSize * TerrainPatch::CHUNKS_COUNT_EDGE + 1;
+    const uint16* heights = patch->_cpuHeights.Get() + index;
+    const float top = Math::Lerp<float>(heights[0], heights[1], fraction.X);
+    const float bottom = Math::Lerp<float>(heights[heightMapSize], heights[heightMapSize + 1], fraction.X);
+    localPosition.Y = Math::Lerp(top, bottom, fraction.Y) * (patch->_yHeight / MAX_uint16) + patch->_yOffset;
+
+    result = (float)_transform.LocalToWorld(localPosition).Y;
+    return true;
+}
+
+int32 Terrain::GetHeights(const Span<Vector3>& positions, Span<float> heights) const
+{
+    PROFILE_CPU();
+    ASSERT(positions.Length() == heights.Length());
+    const int32 heightMapSize = _chunkSize * TerrainPatch::CHUNKS_COUNT_EDGE + 1;
+    const bool isAxisAligned = _transform.Orientation.IsIdentity();
+    const float worldScale = _transform.Scale.Y;
+    const float worldOffset = (float)_transform.Translation.Y;
+    int32 result = 0;
+
+    // Gather the bilinear filtering inputs for the batch of 4 samples and filter them at once with SIMD
+    float h00[4], h10[4], h01[4], h11[4], fractionX[4], fractionZ[4], scale[4], offset[4];
+    int32 sampleIndices[4];
+    Vector3 localPositions[4];
+    int32 count = 0;
+    TerrainPatch* lockedPatch = nullptr;
+    const auto flush = [&]
+    {
+        const SimdVector4 fx = SIMD::Load(fractionX[0], fractionX[1], fractionX[2], fractionX[3]);
+        const SimdVector4 fz = SIMD::Load(fractionZ[0], fractionZ[1], fractionZ[2], fractionZ[3]);
+        const SimdVector4 a = SIMD::Load(h00[0], h00[1], h00[2], h00[3]);
+        const SimdVector4 b = SIMD::Load(h10[0], h10[1], h10[2], h10[3]);
+        const SimdVector4 c = SIMD::Load(h01[0], h01[1], h01[2], h01[3]);
+        const SimdVector4 d = SIMD::Load(h11[0], h11[1], h11[2], h11[3]);
+        const SimdVector4 top = SIMD::Add(a, SIMD::Mul(SIMD::Sub(b, a), fx));
+        const SimdVector4 bottom = SIMD::Add(c, SIMD::Mul(SIMD::Sub(d, c), fx));
+        const SimdVector4 height = SIMD::Add(top, SIMD::Mul(SIMD::Sub(bottom, top), fz));
+        const SimdVector4 value = SIMD::Add(SIMD::Mul(height, SIMD::Load(scale[0], scale[1], scale[2], scale[3])), SIMD::Load(offset[0], offset[1], offset[2], offset[3]));
+        float values[4];
+        Platform::MemoryCopy(values, &value, sizeof(values));
+        for (int32 i = 0; i < count; i++)
+        {
+            if (isAxisAligned)
+            {
+                // Scale and offset are already in world-space
+                heights[sampleIndices[i]] = values[i];
+            }
+            else
+            {
+                localPositions[i].Y = values[i];
+                heights[sampleIndices[i]] = (float)_transform.LocalToWorld(localPositions[i]).Y;
+            }
+        }
+        count = 0;
+    };
+    for (int32 i = 0; i < positions.Length(); i++)
+    {
+        Vector3 localPosition;
+        _transform.WorldToLocal(positions[i], localPosition);
+        const auto patch = GetCPUDataPatch(localPosition);
+        if (patch != lockedPatch)
+        {
+            // Keep the CPU data of the sampled patch locked so it cannot be released by the other thread (samples data is copied so flush doesn't need it)
+            if (lockedPatch)
+                lockedPatch->_cpuDataLocker.Unlock();
+            lockedPatch = patch;
+            if (patch)
+                patch->_cpuDataLocker.Lock();
+        }
+        int32 index;
+        Float2 fraction;
+        if (!patch || !patch->EnsureCPUData() || !patch->GetCPUDataCell(localPosition, index, fraction))
+        {
+            heights[i] = MIN_float;
+            continue;
+        }
+        result++;
+        const uint16* samples = patch->_cpuHeights.Get() + index;
+        h00[count] = samples[0];
+        h10[count] = samples[1];
+        h01[count] = samples[heightMapSize];
+        h11[count] = samples[heightMapSize + 1];
+        fractionX[count] = fraction.X;
+        fractionZ[count] = fraction.Y;
+        scale[count] = patch->_yHeight / MAX_uint16;
+        offset[count] = patch->_yOffset;
+        if (isAxisAligned)
+        {
+            scale[count] *= worldScale;
+            offset[count] = offset[count] * worldScale + worldOffset;
+        }
+        sampleIndices[count] = i;
+        localPositions[count] = localPosition;
+        if (++count == 4)
+            flush();
+    }
+    if (lockedPatch)
+        lockedPatch->_cpuDataLocker.Unlock();
+    if (count != 0)
+    {
+        for (int32 i = count; i < 4; i++)
+        {
+            h00[i] = h10[i] = h01[i] = h11[i] = 0.0f;
+            fractionX[i] = fractionZ[i] = scale[i] = offset[i] = 0.0f;
+        }
+        flush();
+    }
+
+    return result;
+}
+
+bool Terrain::GetNormal(const Vector3& position, Float3& result) const
+{
+    Vector3 localPosition;
+    _transform.WorldToLocal(position, localPosition);
+    const auto patch = GetCPUDataPatch(localPosition);
+    if (!patch)
+        return false;
+
+    // Keep the CPU data locked during the query so it cannot be released by the other thread
+    ScopeLock lock(patch->_cpuDataLocker);
+    int32 index;
+    Float2 fraction;
+    if (!patch->EnsureCPUData() || !patch->GetCPUDataCell(localPosition, index, fraction))
+        return false;
+
+    // Calculate the height derivatives within the cell
+    const int32 heightMapSize = _chunkSize * TerrainPatch::CHUNKS_COUNT_EDGE + 1;
+    const uint16* heights = patch->_cpuHeights.Get() + index;
+    const float h00 = heights[0], h10 = heights[1], h01 = heights[heightMapSize], h11 = heights[heightMapSize + 1];
+    const float scale = patch->_yHeight / MAX_uint16 / TERRAIN_UNITS_PER_VERTEX;
+    const float dx = Math::Lerp(h10 - h00, h11 - h01, fraction.Y) * scale;
+    const float dz = Math::Lerp(h01 - h00, h11 - h10, fraction.X) * scale;
+
+    // Transform the normal to world-space (using inverse scale to handle non-uniform scaling)
+    Float3 normal(-dx, 1.0f, -dz);
+    normal /= _transform.Scale;
+    result = Float3::Transform(normal, _transform.Orientation);
+    result.Normalize();
+    return true;
+}
+
+bool Terrain::GetSplatWeights(const Vector3& position, Color& splatmap0, Color& splatmap1) const
+{
+    static_assert(TERRAIN_MAX_SPLATMAPS_COUNT == 2, "Please update the code below to match the maximum terrain splatmaps amount.");
+    Vector3 localPosition;
+    _transform.WorldToLocal(position, localPosition);
+    const auto patch = GetCPUDataPatch(localPosition);
+    if (!patch)
+        return false;
+
+    // Keep the CPU data locked during the query so it cannot be released by the other thread
+    ScopeLock lock(patch->_cpuDataLocker);
+    int32 index;
+    Float2 fraction;
+    if (!patch->EnsureCPUData() || !patch->GetCPUDataCell(localPosition, index, fraction))
+        return false;
+
+    // Bilinear filtering of the layer weights (missing splatmap uses the first layer only)
+    const int32 heightMapSize = _chunkSize * TerrainPatch::CHUNKS_COUNT_EDGE + 1;
+    Color* results[TERRAIN_MAX_SPLATMAPS_COUNT] = { &splatmap0, &splatmap1 };
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+    {
+        const auto& splatMap = patch->_cpuSplatMaps[i];
+        if (splatMap.IsEmpty())
+        {
+            *results[i] = i == 0 ? Color(1.0f, 0.0f, 0.0f, 0.0f) : Color::Transparent;
+            continue;
+        }
+        const Color32* weights = splatMap.Get() + index;
+        const Color top = Color::Lerp(Color(weights[0]), Color(weights[1]), fraction.X);
+        const Color bottom = Color::Lerp(Color(weights[heightMapSize]), Color(weights[heightMapSize + 1]), fraction.X);
+        *results[i] = Color::Lerp(top, bottom, fraction.Y);
+    }
+    return true;
+}
+
 void Terrain::DrawPatch(const RenderContext& renderContext, const Int2& patchCoord, MaterialBase* material, int32 lodIndex) const
 {
     auto patch = GetPatch(patchCoord);
@@ -294,6 +498,28 @@ void Terrain::SetCollisionLOD(int32 value)
 #endif
 }
 
+void Terrain::SetRetainHeightData(bool value)
+{
+    if (value == _retainHeightData)
+        return;
+    _retainHeightData = value;
+
+    // Data is cached on the first query so just release it when disabled
+    if (!value)
+    {
+        for (int32 i = 0; i < _patches.Count(); i++)
+            _patches[i]->ClearCPUData();
+    }
+}
+
+uint64 Terrain::GetHeightDataMemoryUsage() const
+{
+    uint64 result = 0;
+    for (int32 i = 0; i < _patches.Count(); i++)
+        result += _patches[i]->GetCPUDataMemoryUsage();
+    return result;
+}
+
 TerrainPatch* Terrain::GetPatch(const Int2& patchCoord) const
 {
     return GetPatch(patchCoord.X, patchCoord.Y);
@@ -665,6 +891,7 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     SERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     SERIALIZE_MEMBER(CollisionLOD, _collisionLod);
+    SERIALIZE_MEMBER(RetainHeightData, _retainHeightData);
     SERIALIZE(Material);
     SERIALIZE(PhysicalMaterial);
     SERIALIZE(DrawModes);
@@ -712,6 +939,11 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
     DESERIALIZE_MEMBER(LODDistribution, _lodDistribution);
     DESERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     DESERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
+    member = stream.FindMember("RetainHeightData");
+    if (member != stream.MemberEnd() && member->value.IsBool())
+    {
+        SetRetainHeightData(member->value.GetBool());
+    }
     DESERIALIZE(Material);
     DESERIALIZE(PhysicalMaterial);
     DESERIALIZE(DrawModes);
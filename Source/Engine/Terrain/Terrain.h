@@ -53,6 +53,7 @@ DECLARE_SCENE_OBJECT(Terrain);
     char _collisionLod;
     byte _lodCount;
     uint16 _chunkSize;
+    bool _retainHeightData;
     int32 _sceneRenderingKey = -1;
     float _scaleInLightmap;
     float _lodDistribution;
@@ -179,6 +180,25 @@ DECLARE_SCENE_OBJECT(Terrain);
     /// </summary>
     API_PROPERTY() void SetCollisionLOD(int32 value);
 
+    /// <summary>
+    /// Gets the value indicating whether terrain keeps a compressed copy of the heightmap (16-bit per sample) and splatmaps in CPU memory to support the height, normal and layer weights queries without physics (eg. for AI, foliage placement or gameplay on server).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(130), DefaultValue(false), EditorDisplay(\"Terrain\")")
+    FORCE_INLINE bool GetRetainHeightData() const
+    {
+        return _retainHeightData;
+    }
+
+    /// <summary>
+    /// Sets the value indicating whether terrain keeps a compressed copy of the heightmap (16-bit per sample) and splatmaps in CPU memory to support the height, normal and layer weights queries without physics (eg. for AI, foliage placement or gameplay on server).
+    /// </summary>
+    API_PROPERTY() void SetRetainHeightData(bool value);
+
+    /// <summary>
+    /// Gets the amount of CPU memory (in bytes) used by the retained heightmap and splatmaps copy (see RetainHeightData).
+    /// </summary>
+    API_PROPERTY() uint64 GetHeightDataMemoryUsage() const;
+
     /// <summary>
     /// Gets the terrain Level Of Detail count.
     /// </summary>
@@ -411,6 +431,40 @@ DECLARE_SCENE_OBJECT(Terrain);
     /// <param name="result">The result point on the collider that is closest to the specified location.</param>
     API_FUNCTION() void ClosestPoint(const Vector3& position, API_PARAM(Out) Vector3& result) const;
 
+    /// <summary>
+    /// Gets the terrain surface height at the given location (bilinear filtered). Uses the heightmap copy retained in CPU memory (see RetainHeightData), doesn't require physics. Thread-safe.
+    /// </summary>
+    /// <remarks>Terrain surface is sampled along the terrain up axis, the result is the world-space Y coordinate of the sampled surface point.</remarks>
+    /// <param name="position">The world-space location (only X and Z are used).</param>
+    /// <param name="result">The result height. Valid only when method returns true.</param>
+    /// <returns>True if location is over the terrain (excluding holes), otherwise false.</returns>
+    API_FUNCTION() bool GetHeight(const Vector3& position, API_PARAM(Out) float& result) const;
+
+    /// <summary>
+    /// Gets the terrain surface heights at the given locations (bilinear filtered, processed in batches with SIMD). Uses the heightmap copy retained in CPU memory (see RetainHeightData), doesn't require physics. Thread-safe.
+    /// </summary>
+    /// <param name="positions">The world-space locations (only X and Z are used).</param>
+    /// <param name="heights">The result heights (the same length as positions). Locations outside the terrain or over holes get MIN_float.</param>
+    /// <returns>The amount of locations that are over the terrain.</returns>
+    int32 GetHeights(const Span<Vector3>& positions, Span<float> heights) const;
+
+    /// <summary>
+    /// Gets the terrain surface normal vector at the given location. Uses the heightmap copy retained in CPU memory (see RetainHeightData), doesn't require physics. Thread-safe.
+    /// </summary>
+    /// <param name="position">The world-space location (only X and Z are used).</param>
+    /// <param name="result">The result world-space normal vector. Valid only when method returns true.</param>
+    /// <returns>True if location is over the terrain (excluding holes), otherwise false.</returns>
+    API_FUNCTION() bool GetNormal(const Vector3& position, API_PARAM(Out) Float3& result) const;
+
+    /// <summary>
+    /// Gets the terrain layer weights at the given location (bilinear filtered). Uses the splatmaps copy retained in CPU memory (see RetainHeightData), doesn't require physics. Thread-safe.
+    /// </summary>
+    /// <param name="position">The world-space location (only X and Z are used).</param>
+    /// <param name="splatmap0">The result weights of the layers 0-3 (in RGBA channels). Valid only when method returns true.</param>
+    /// <param name="splatmap1">The result weights of the layers 4-7 (in RGBA channels). Valid only when method returns true.</param>
+    /// <returns>True if location is over the terrain (excluding holes), otherwise false.</returns>
+    API_FUNCTION() bool GetSplatWeights(const Vector3& position, API_PARAM(Out) Color& splatmap0, API_PARAM(Out) Color& splatmap1) const;
+
     /// <summary>
     /// Draws the terrain patch.
     /// </summary>
@@ -433,6 +487,7 @@ DECLARE_SCENE_OBJECT(Terrain);
 private:
 
     void OnPhysicalMaterialChanged();
+    TerrainPatch* GetCPUDataPatch(const Vector3& localPosition) const;
 #if TERRAIN_USE_PHYSICS_DEBUG
 	void DrawPhysicsDebug(RenderView& view);
 #endif
@@ -68,6 +68,10 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
     if (!material || !material->IsReady() || !material->IsTerrain())
         return false;
 
+    // Terrain doesn't compute the on-screen UVs density so don't limit the textures
+    if (renderContext.View.Pass & (DrawPass::GBuffer | DrawPass::Forward))
+        material->Params.RequestTexturesFullQuality();
+
     // Cache data
     _cachedDrawLOD = lod;
     _cachedDrawMaterial = material;
@@ -81,6 +81,7 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
     _collisionTriangles.Resize(0);
 #endif
     _collisionVertices.Resize(0);
+    ClearCPUData();
 }
 
 TerrainPatch::~TerrainPatch()
@@ -938,6 +939,7 @@ bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap,
     _cachedHolesMask.Resize(0);
     _wasHeightModified = false;
 #endif
+    ClearCPUData();
 
     return false;
 }
@@ -1102,6 +1104,7 @@ bool TerrainPatch::SetupSplatMap(int32 index, int32 splatMapLength, const Color3
     _cachedSplatMap[index].Resize(0);
     _wasSplatmapModified[index] = false;
 #endif
+    ClearCPUData();
 
     return false;
 }
@@ -1691,6 +1694,7 @@ bool TerrainPatch::ModifySplatMap(int32 index, const Color32* samples, const Int
 
     // Mark as modified (need to save texture data during scene saving)
     _wasSplatmapModified[index] = true;
+    ClearCPUData();
 
     // Note: if terrain is using virtual storage then it won't be updated, we could synchronize that data...
 
@@ -1803,6 +1807,7 @@ bool TerrainPatch::UpdateHeightData(const TerrainDataUpdateInfo& info, const Int
     _collisionTriangles.Resize(0);
 #endif
     _collisionVertices.Resize(0);
+    ClearCPUData();
 
     // Mark as modified (need to save texture data during scene saving)
     _wasHeightModified = true;
@@ -2047,6 +2052,167 @@ void TerrainPatch::ClosestPoint(const Vector3& position, Vector3& result) const
         result = position;
 }
 
+uint64 TerrainPatch::GetCPUDataMemoryUsage() const
+{
+    uint64 result = _cpuHeights.Capacity() * sizeof(uint16) + _cpuHoles.Capacity() * sizeof(byte);
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+        result += _cpuSplatMaps[i].Capacity() * sizeof(Color32);
+    return result;
+}
+
+// Extracts the top mip of the terrain patch texture into the heightmap layout (texture has the samples on the chunk edges duplicated)
+static bool ReadTerrainTextureData(Texture* texture, int32 chunkSize, Array<Color32>& result)
+{
+    if (texture->WaitForLoaded())
+        return true;
+    auto lock = texture->LockData();
+    BytesContainer mipLOD0;
+    texture->GetMipDataWithLoading(0, mipLOD0);
+    const int32 vertexCountEdge = chunkSize + 1;
+    const int32 textureSize = vertexCountEdge * TerrainPatch::CHUNKS_COUNT_EDGE;
+    const int32 heightMapSize = chunkSize * TerrainPatch::CHUNKS_COUNT_EDGE + 1;
+    if (mipLOD0.Length() < textureSize * textureSize * (int32)sizeof(Color32))
+        return true;
+    result.Resize(heightMapSize * heightMapSize, false);
+    const Color32* src = mipLOD0.Get<Color32>();
+    Color32* dst = result.Get();
+    for (int32 chunkIndex = 0; chunkIndex < TerrainPatch::CHUNKS_COUNT; chunkIndex++)
+    {
+        const int32 chunkX = chunkIndex % TerrainPatch::CHUNKS_COUNT_EDGE;
+        const int32 chunkZ = chunkIndex / TerrainPatch::CHUNKS_COUNT_EDGE;
+        for (int32 z = 0; z < vertexCountEdge; z++)
+        {
+            const Color32* srcRow = src + (chunkZ * vertexCountEdge + z) * textureSize + chunkX * vertexCountEdge;
+            Color32* dstRow = dst + (chunkZ * chunkSize + z) * heightMapSize + chunkX * chunkSize;
+            Platform::MemoryCopy(dstRow, srcRow, vertexCountEdge * sizeof(Color32));
+        }
+    }
+    return false;
+}
+
+bool TerrainPatch::EnsureCPUData()
+{
+    if (Platform::AtomicRead(&_cpuDataState) == 0)
+    {
+        ScopeLock lock(_cpuDataLocker);
+        if (Platform::AtomicRead(&_cpuDataState) == 0)
+            Platform::AtomicStore(&_cpuDataState, CacheCPUData() ? 2 : 1);
+    }
+    return Platform::AtomicRead(&_cpuDataState) == 1;
+}
+
+bool TerrainPatch::CacheCPUData()
+{
+    PROFILE_CPU_NAMED("Terrain.CacheCPUData");
+    const int32 chunkSize = _terrain->_chunkSize;
+    const int32 heightMapSize = chunkSize * CHUNKS_COUNT_EDGE + 1;
+    const int32 heightMapLength = heightMapSize * heightMapSize;
+    _cpuHeights.Resize(heightMapLength, false);
+    _cpuHoles.Resize(0);
+#define SET_HOLE(index) \
+    if (_cpuHoles.IsEmpty()) \
+    { \
+        _cpuHoles.Resize(heightMapLength, false); \
+        _cpuHoles.SetAll(0); \
+    } \
+    _cpuHoles[index] = 1
+
+    // Cache heightmap (quantized the same way as the heightmap texture)
+#if TERRAIN_UPDATING
+    if (_cachedHeightMap.Count() == heightMapLength)
+    {
+        // Use the editor cache of the heightmap that is up to date with the terrain modifications
+        const float heightScale = MAX_uint16 / _yHeight;
+        for (int32 i = 0; i < heightMapLength; i++)
+            _cpuHeights[i] = (uint16)Math::Clamp((_cachedHeightMap[i] - _yOffset) * heightScale, 0.0f, (float)MAX_uint16);
+        if (_cachedHolesMask.Count() == heightMapLength)
+        {
+            for (int32 i = 0; i < heightMapLength; i++)
+            {
+                if (_cachedHolesMask[i] == 0)
+                {
+                    SET_HOLE(i);
+                }
+            }
+        }
+    }
+    else
+#endif
+    {
+        Array<Color32> samples;
+        if (Heightmap == nullptr || ReadTerrainTextureData(Heightmap, chunkSize, samples))
+        {
+            LOG(Warning, "Failed to get patch {0}x{1} heightmap data.", _x, _z);
+            _cpuHeights.SetCapacity(0, false);
+            return true;
+        }
+        for (int32 i = 0; i < heightMapLength; i++)
+        {
+            const Color32 raw = samples[i];
+            _cpuHeights[i] = raw.R | (raw.G << 8);
+            if ((raw.B + raw.A) >= (int32)(1.9f * MAX_uint8))
+            {
+                SET_HOLE(i);
+            }
+        }
+    }
+#undef SET_HOLE
+
+    // Cache splatmaps
+    for (int32 index = 0; index < TERRAIN_MAX_SPLATMAPS_COUNT; index++)
+    {
+        auto& splatMap = _cpuSplatMaps[index];
+#if TERRAIN_UPDATING
+        if (_cachedSplatMap[index].Count() == heightMapLength)
+        {
+            splatMap = _cachedSplatMap[index];
+            continue;
+        }
+#endif
+        if (Splatmap[index] == nullptr)
+        {
+            splatMap.SetCapacity(0, false);
+        }
+        else if (ReadTerrainTextureData(Splatmap[index], chunkSize, splatMap))
+        {
+            LOG(Warning, "Failed to get patch {0}x{1} splatmap data.", _x, _z);
+            splatMap.SetCapacity(0, false);
+        }
+    }
+
+    return false;
+}
+
+void TerrainPatch::ClearCPUData()
+{
+    ScopeLock lock(_cpuDataLocker);
+    Platform::AtomicStore(&_cpuDataState, 0);
+    _cpuHeights.SetCapacity(0, false);
+    _cpuHoles.SetCapacity(0, false);
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+        _cpuSplatMaps[i].SetCapacity(0, false);
+}
+
+bool TerrainPatch::GetCPUDataCell(const Vector3& localPosition, int32& index, Float2& fraction) const
+{
+    const int32 heightMapSize = _terrain->_chunkSize * CHUNKS_COUNT_EDGE + 1;
+    const float x = (float)(localPosition.X - _offset.X) * (1.0f / TERRAIN_UNITS_PER_VERTEX);
+    const float z = (float)(localPosition.Z - _offset.Z) * (1.0f / TERRAIN_UNITS_PER_VERTEX);
+    if (x < 0.0f || z < 0.0f || x > (float)(heightMapSize - 1) || z > (float)(heightMapSize - 1))
+        return false;
+    const int32 cellX = Math::Min((int32)x, heightMapSize - 2);
+    const int32 cellZ = Math::Min((int32)z, heightMapSize - 2);
+    fraction = Float2(x - (float)cellX, z - (float)cellZ);
+    index = cellZ * heightMapSize + cellX;
+    if (_cpuHoles.HasItems())
+    {
+        const byte* holes = _cpuHoles.Get() + index;
+        if (holes[0] | holes[1] | holes[heightMapSize] | holes[heightMapSize + 1])
+            return false;
+    }
+    return true;
+}
+
 #if USE_EDITOR
 
 void TerrainPatch::UpdatePostManualDeserialization()
@@ -2522,6 +2688,7 @@ void TerrainPatch::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
     // Update offset (x or/and z may be modified)
     const float size = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX * CHUNKS_COUNT_EDGE;
     _offset = Vector3(_x * size, 0.0f, _z * size);
+    ClearCPUData();
 
     auto member = stream.FindMember("Chunks");
     if (member != stream.MemberEnd() && member->value.IsArray())
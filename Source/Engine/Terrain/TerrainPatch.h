@@ -58,6 +58,11 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     Array<Vector3> _collisionTriangles; // TODO: large-worlds
 #endif
     Array<Float3> _collisionVertices; // TODO: large-worlds
+    CriticalSection _cpuDataLocker;
+    int64 _cpuDataState = 0; // 0 - not cached, 1 - cached, 2 - failed
+    Array<uint16> _cpuHeights; // Normalized to the patch height range (the same quantization as heightmap texture)
+    Array<byte> _cpuHoles; // Empty if patch has no holes
+    Array<Color32> _cpuSplatMaps[TERRAIN_MAX_SPLATMAPS_COUNT]; // Empty if splatmap is missing
 
     void Init(Terrain* terrain, int16 x, int16 z);
 
@@ -332,6 +337,11 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     /// <param name="result">The result point on the collider that is closest to the specified location.</param>
     void ClosestPoint(const Vector3& position, Vector3& result) const;
 
+    /// <summary>
+    /// Gets the amount of CPU memory (in bytes) used by the retained heightmap and splatmaps copy used by the terrain height queries (see Terrain::RetainHeightData).
+    /// </summary>
+    uint64 GetCPUDataMemoryUsage() const;
+
 #if USE_EDITOR
 
     /// <summary>
@@ -410,6 +420,33 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     bool UpdateCollision();
 
     void OnPhysicsSceneChanged(PhysicsScene* previous);
+
+    /// <summary>
+    /// Ensures that the retained CPU copy of the heightmap and splatmaps is cached. Thread-safe.
+    /// </summary>
+    /// <returns>True if data is valid, otherwise false.</returns>
+    bool EnsureCPUData();
+
+    /// <summary>
+    /// Caches the retained CPU copy of the heightmap and splatmaps.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CacheCPUData();
+
+    /// <summary>
+    /// Releases the retained CPU copy of the heightmap and splatmaps (it will be cached again on the next query).
+    /// </summary>
+    void ClearCPUData();
+
+    /// <summary>
+    /// Gets the CPU heightmap cell that contains the given location.
+    /// </summary>
+    /// <param name="localPosition">The terrain-local position.</param>
+    /// <param name="index">The index of the cell top-left sample.</param>
+    /// <param name="fraction">The location within the cell (normalized, for bilinear filtering).</param>
+    /// <returns>True if location is within the patch and is not over the hole, otherwise false.</returns>
+    bool GetCPUDataCell(const Vector3& localPosition, int32& index, Float2& fraction) const;
+
 public:
 
     // [ISerializable]
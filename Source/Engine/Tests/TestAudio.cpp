@@ -0,0 +1,181 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/Platform.h"
+#if AUDIO_API_SOFTWARE
+#include "Engine/Audio/Software/AudioMixer.h"
+#endif
+#include <ThirdParty/catch2/catch.hpp>
+
+#if AUDIO_API_SOFTWARE
+
+namespace
+{
+    uint32 CreateToneBuffer(AudioMixer& mixer, float frequency, int32 frames, int32 sampleRate)
+    {
+        Array<int16> samples;
+        samples.Resize(frames);
+        for (int32 i = 0; i < frames; i++)
+            samples[i] = (int16)(Math::Sin(2.0f * PI * frequency * (float)i / (float)sampleRate) * 16000.0f);
+        AudioDataInfo info;
+        info.NumSamples = frames;
+        info.SampleRate = sampleRate;
+        info.NumChannels = 1;
+        info.BitDepth = 16;
+        const uint32 bufferId = mixer.CreateBuffer();
+        mixer.WriteBuffer(bufferId, (const byte*)samples.Get(), info);
+        return bufferId;
+    }
+
+    float GetPeak(const Array<float>& samples)
+    {
+        float peak = 0.0f;
+        for (const float e : samples)
+            peak = Math::Max(peak, Math::Abs(e));
+        return peak;
+    }
+}
+
+TEST_CASE("Audio")
+{
+    SECTION("Test Software Mixer")
+    {
+        AudioMixer mixer;
+        mixer.DopplerFactor = 0.0f;
+        mixer.Listener.IsActive = true;
+        const uint32 bufferId = CreateToneBuffer(mixer, 440.0f, 44100, 44100);
+
+        // 2D voice plays at full volume
+        const uint32 voiceId = mixer.CreateVoice();
+        mixer.QueueBuffer(voiceId, bufferId);
+        mixer.Play(voiceId);
+        Array<float> output;
+        output.Resize(4800 * 2);
+        mixer.Mix(output.Get(), 4800);
+        CHECK(mixer.LastStats.RealVoices == 1);
+        CHECK(GetPeak(output) > 0.4f);
+        CHECK(Math::NearEqual(mixer.GetTime(voiceId), 0.1f, 0.001f));
+
+        // 3D voice on the right side
+        AudioMixer::Voice* voice = mixer.GetVoice(voiceId);
+        voice->Is3D = true;
+        voice->Position = Vector3(1000, 0, 0);
+        for (int32 i = 0; i < 2; i++)
+            mixer.Mix(output.Get(), 4800);
+        float left = 0.0f, right = 0.0f;
+        for (int32 i = 0; i < 4800; i++)
+        {
+            left = Math::Max(left, Math::Abs(output[i * 2]));
+            right = Math::Max(right, Math::Abs(output[i * 2 + 1]));
+        }
+        CHECK(right > left * 4.0f);
+
+        // Buffer end (not looped)
+        mixer.Mix(output.Get(), 44100);
+        CHECK(voice->ProcessedBuffers == 1);
+        mixer.Mix(output.Get(), 256);
+        CHECK(mixer.LastStats.PlayingVoices == 0);
+
+        // Streaming (queued buffers)
+        mixer.Stop(voiceId);
+        const uint32 bufferId2 = CreateToneBuffer(mixer, 220.0f, 22050, 44100);
+        mixer.QueueBuffer(voiceId, bufferId2);
+        mixer.QueueBuffer(voiceId, bufferId);
+        mixer.Play(voiceId);
+        mixer.Mix(output.Get(), 4800 * 6);
+        CHECK(voice->ProcessedBuffers == 1);
+        CHECK(Math::NearEqual(mixer.GetTime(voiceId), 0.1f, 0.001f));
+        mixer.DequeueProcessedBuffers(voiceId);
+        CHECK(voice->Queue.Count() == 1);
+        CHECK(voice->Queue[0] == bufferId);
+    }
+
+    SECTION("Test Voice Virtualization")
+    {
+        AudioMixer mixer;
+        mixer.MaxRealVoices = 2;
+        mixer.Listener.IsActive = true;
+        const uint32 bufferId = CreateToneBuffer(mixer, 440.0f, 44100, 44100);
+        uint32 voices[4];
+        for (int32 i = 0; i < 4; i++)
+        {
+            voices[i] = mixer.CreateVoice();
+            AudioMixer::Voice* voice = mixer.GetVoice(voices[i]);
+            voice->Is3D = true;
+            voice->IsLooping = true;
+            voice->Position = Vector3(0, 0, 100.0f * (i + 1));
+            mixer.QueueBuffer(voices[i], bufferId);
+            mixer.Play(voices[i]);
+        }
+        mixer.GetVoice(voices[3])->Priority = 1;
+        mixer.Mix(nullptr, 4800);
+        CHECK(mixer.LastStats.PlayingVoices == 4);
+        CHECK(mixer.LastStats.RealVoices == 2);
+        CHECK(mixer.LastStats.VirtualVoices == 2);
+        CHECK(!mixer.GetVoice(voices[3])->IsVirtual); // Highest priority
+        CHECK(!mixer.GetVoice(voices[0])->IsVirtual); // Closest
+        CHECK(mixer.GetVoice(voices[1])->IsVirtual);
+        CHECK(mixer.GetVoice(voices[2])->IsVirtual);
+
+        // Virtual voices keep the playback time
+        CHECK(Math::NearEqual(mixer.GetTime(voices[1]), mixer.GetTime(voices[0]), 0.001f));
+        mixer.Mix(nullptr, 44100);
+        CHECK(Math::NearEqual(mixer.GetTime(voices[1]), mixer.GetTime(voices[0]), 0.001f));
+    }
+
+    SECTION("Test Offline Render Benchmark")
+    {
+        // Setup 1000 looped sources around the listener with 64 real voices
+        const int32 count = 1000;
+        const int32 seconds = 5;
+        AudioMixer mixer;
+        mixer.Listener.IsActive = true;
+        mixer.MaxRealVoices = 64;
+        const uint32 bufferIds[2] = { CreateToneBuffer(mixer, 440.0f, 44100, 44100), CreateToneBuffer(mixer, 330.0f, 22050, 22050) };
+        RandomStream random(0);
+        for (int32 i = 0; i < count; i++)
+        {
+            const uint32 voiceId = mixer.CreateVoice();
+            AudioMixer::Voice* voice = mixer.GetVoice(voiceId);
+            voice->Is3D = true;
+            voice->IsLooping = true;
+            voice->Volume = 0.2f;
+            voice->Pitch = 0.5f + random.GetFraction() * 1.5f;
+            voice->MinDistance = 2.0f;
+            voice->Position = Vector3(random.GetFraction() * 20000.0f - 10000.0f, 0, random.GetFraction() * 20000.0f - 10000.0f);
+            voice->Velocity = Vector3(random.GetFraction() * 1000.0f - 500.0f, 0, 0);
+            mixer.QueueBuffer(voiceId, bufferIds[i % 2]);
+            mixer.Play(voiceId);
+        }
+
+        // Render offline in 60 FPS updates
+        const int32 framesPerUpdate = mixer.SampleRate / 60;
+        const int32 updates = seconds * 60;
+        Array<float> output;
+        output.Resize(framesPerUpdate * updates * 2);
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < updates; i++)
+            mixer.Mix(output.Get() + i * framesPerUpdate * 2, framesPerUpdate);
+        const double mixTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(mixer.LastStats.PlayingVoices == count);
+        CHECK(mixer.LastStats.RealVoices == 64);
+        CHECK(mixer.LastStats.VirtualVoices == count - 64);
+        const float peak = GetPeak(output);
+        CHECK(peak > 0.0f);
+        CHECK(peak <= 1.0f);
+
+        // Save to file
+        const String path = Globals::TemporaryFolder / TEXT("TestAudioMixer.wav");
+        CHECK(!AudioMixer::SaveWav(path, output.Get(), framesPerUpdate * updates, mixer.SampleRate));
+        CHECK(FileSystem::GetFileSize(path) == 44 + framesPerUpdate * updates * 4);
+        FileSystem::DeleteFile(path);
+
+        LOG(Info, "Audio mixer benchmark: {0} sources, {1} s of audio mixed in {2} ms ({3} us/update)", count, seconds, mixTime * 1000.0, mixTime * 1000000.0 / updates);
+    }
+}
+
+#endif
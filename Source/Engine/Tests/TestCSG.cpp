@@ -0,0 +1,96 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Level/Actors/BoxBrush.h"
+#include "Engine/Level/Actors/EmptyActor.h"
+#include "Engine/Platform/Platform.h"
+#if COMPILE_WITH_CSG_BUILDER
+#include "Engine/CSG/CSGBuildCache.h"
+#include "Engine/CSG/CSGData.h"
+#endif
+#include <ThirdParty/catch2/catch.hpp>
+
+#if COMPILE_WITH_CSG_BUILDER
+
+namespace
+{
+    BoxBrush* SpawnBrush(Actor* parent, const Vector3& position, float size, BrushMode mode)
+    {
+        auto brush = BoxBrush::Spawn(ScriptingObject::SpawnParams(Guid::New(), BoxBrush::TypeInitializer));
+        brush->SetMode(mode);
+        brush->SetSize(Vector3(size));
+        brush->SetPosition(position);
+        brush->SetParent(parent, false);
+        return brush;
+    }
+
+    double Build(CSG::BuildCache& cache, Actor* root)
+    {
+        const double startTime = Platform::GetTimeSeconds();
+        CSG::BuildCache::Snapshot snapshot;
+        CSG::BuildCache::Capture(root, snapshot);
+        CSG::RawData data;
+        cache.Build(snapshot, data);
+        CHECK(data.Slots.HasItems());
+        return (Platform::GetTimeSeconds() - startTime) * 1000.0;
+    }
+}
+
+TEST_CASE("CSG")
+{
+    SECTION("Test Incremental Build")
+    {
+        // Setup 2k brushes (1k islands of additive box with subtractive box in the corner)
+        const int32 sizeX = 40, sizeZ = 25;
+        auto root = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        Array<BoxBrush*> brushes;
+        for (int32 x = 0; x < sizeX; x++)
+        {
+            for (int32 z = 0; z < sizeZ; z++)
+            {
+                const Vector3 position(x * 200.0f, 0, z * 200.0f);
+                brushes.Add(SpawnBrush(root, position, 150.0f, BrushMode::Additive));
+                brushes.Add(SpawnBrush(root, position + Vector3(50, 0, 50), 60.0f, BrushMode::Subtractive));
+            }
+        }
+        CSG::BuildCache cache;
+
+        // Full build
+        const double fullTime = Build(cache, root);
+        CHECK(cache.LastStats.Brushes == 2000);
+        CHECK(cache.LastStats.BuiltBrushes == 2000);
+        CHECK(cache.LastStats.Islands == 1000);
+        CHECK(cache.LastStats.CombinedIslands == 1000);
+
+        // No changes
+        const double noChangesTime = Build(cache, root);
+        CHECK(cache.LastStats.BuiltBrushes == 0);
+        CHECK(cache.LastStats.CombinedIslands == 0);
+
+        // Modify a single brush
+        brushes[100]->SetSize(Vector3(160.0f));
+        const double modifyTime = Build(cache, root);
+        CHECK(cache.LastStats.BuiltBrushes == 1);
+        CHECK(cache.LastStats.Islands == 1000);
+        CHECK(cache.LastStats.CombinedIslands == 1);
+
+        // Move subtractive brush to the neighbour island (both islands are affected)
+        brushes[1]->SetPosition(Vector3(-50, 0, 200.0f));
+        Build(cache, root);
+        CHECK(cache.LastStats.BuiltBrushes == 1);
+        CHECK(cache.LastStats.Islands == 1000);
+        CHECK(cache.LastStats.CombinedIslands == 2);
+
+        // Remove brush
+        brushes[10]->DeleteObjectNow();
+        Build(cache, root);
+        CHECK(cache.LastStats.Brushes == 1999);
+        CHECK(cache.LastStats.BuiltBrushes == 0);
+        CHECK(cache.LastStats.CombinedIslands == 1);
+
+        LOG(Info, "CSG build benchmark: {0} brushes, full build {1} ms, no changes {2} ms, single brush modified {3} ms", 2000, fullTime, noChangesTime, modifyTime);
+        root->DeleteObjectNow();
+    }
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Content/Content.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Renderer/RenderList.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Foliage")
+{
+    SECTION("Test Draw Benchmark")
+    {
+        // Setup box model
+        AssetReference<Model> model = Content::CreateVirtualAsset<Model>();
+        REQUIRE(model);
+        int32 meshesCount = 1;
+        REQUIRE(!model->SetupLODs(ToSpan(&meshesCount, 1)));
+        Float3 vertices[8] =
+        {
+            Float3(-50, 0, -50), Float3(50, 0, -50), Float3(50, 0, 50), Float3(-50, 0, 50),
+            Float3(-50, 100, -50), Float3(50, 100, -50), Float3(50, 100, 50), Float3(-50, 100, 50),
+        };
+        uint16 triangles[36] =
+        {
+            0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4,
+            1, 2, 6, 1, 6, 5, 2, 3, 7, 2, 7, 6, 3, 0, 4, 3, 4, 7,
+        };
+        REQUIRE(!model->LODs[0].Meshes[0].UpdateMesh(8, 12, vertices, triangles));
+
+        // Setup 1M foliage instances over 20x20km area
+        const int32 count = 1000000;
+        auto foliage = Foliage::Spawn(ScriptingObject::SpawnParams(Guid::New(), Foliage::TypeInitializer));
+        foliage->SetStaticFlags(StaticFlags::None);
+        foliage->AddFoliageType(model);
+        foliage->GetFoliageType(0)->CullDistance = 20000.0f;
+        RandomStream random(0);
+        FoliageInstance instance;
+        instance.Type = 0;
+        instance.Transform = Transform::Identity;
+        double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < count; i++)
+        {
+            instance.Transform.Translation = Vector3(random.GetFraction() * 20000.0f - 10000.0f, 0, random.GetFraction() * 20000.0f - 10000.0f);
+            instance.Transform.Orientation = Quaternion::Euler(0, random.GetFraction() * 360.0f, 0);
+            foliage->AddInstance(instance);
+        }
+        foliage->RebuildClusters();
+        const double setupTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(foliage->GetInstancesCount() == count);
+
+        // Draw the foliage from the view in the center (run tests with -null to measure only the CPU work without GPU device)
+        RenderContext renderContext;
+        renderContext.List = RenderList::GetFromPool();
+        renderContext.View.Pass = DrawPass::GBuffer | DrawPass::Depth;
+        renderContext.View.SetProjector(10.0f, 20000.0f, Float3(0, 200, 0), Float3::Forward, Float3::Up, 90.0f);
+        const int32 frames = 10;
+        int32 drawCalls = 0;
+        startTime = Platform::GetTimeSeconds();
+        for (int32 frame = 0; frame < frames; frame++)
+        {
+            renderContext.List->Clear();
+            foliage->Draw(renderContext);
+            drawCalls = renderContext.List->BatchedDrawCalls.Count();
+        }
+        const double drawTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(drawCalls != 0);
+        int32 drawnInstances = 0;
+        for (const auto& batch : renderContext.List->BatchedDrawCalls)
+            drawnInstances += batch.Instances.Count();
+        CHECK(drawnInstances != 0);
+        CHECK(drawnInstances < count);
+        LOG(Info, "Foliage draw benchmark: {0} instances, setup {1} ms, draw {2} ms ({3} instances visible)", count, setupTime * 1000.0, drawTime * 1000.0 / frames, drawnInstances);
+
+        RenderList::ReturnToPool(renderContext.List);
+        foliage->DeleteObjectNow();
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/RenderStats.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Graphics")
+{
+    SECTION("Test Upload Ring Buffer")
+    {
+        // Upload ring buffer is used only by the Vulkan backend (run tests with the software ICD such as lavapipe to cover it on headless machines)
+        if (GPUDevice::Instance == nullptr || GPUDevice::Instance->GetRendererType() != RendererType::Vulkan)
+            return;
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        const uint32 size = 64 * 1024;
+        GPUBuffer* buffer = GPUDevice::Instance->CreateBuffer(TEXT("Test Upload"));
+        REQUIRE(!buffer->Init(GPUBufferDescription::Raw(size)));
+        GPUBuffer* readback = GPUDevice::Instance->CreateBuffer(TEXT("Test Upload Readback"));
+        REQUIRE(!readback->Init(GPUBufferDescription::Buffer(size, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, GPUResourceUsage::StagingReadback)));
+        Array<byte> data;
+        data.Resize(size);
+        for (uint32 i = 0; i < size; i++)
+            data[i] = (byte)(i * 7);
+#if COMPILE_WITH_PROFILER
+        const RenderStatsData before = RenderStatsData::Counter;
+#endif
+
+        // Upload from the regular memory (written into the ring buffer) and from the memory allocated from the ring buffer
+        const uint32 halfSize = size / 2;
+        context->UpdateBuffer(buffer, data.Get(), halfSize, 0);
+        void* uploadMemory = context->AllocateUploadMemory(halfSize);
+        REQUIRE(uploadMemory);
+        Platform::MemoryCopy(uploadMemory, data.Get() + halfSize, halfSize);
+        context->UpdateBuffer(buffer, uploadMemory, halfSize, halfSize);
+        context->CopyBuffer(readback, buffer, size, 0, 0);
+        context->Flush();
+        GPUDevice::Instance->WaitForGPU();
+
+        BytesContainer result;
+        REQUIRE(!readback->GetData(result));
+        REQUIRE(result.Length() >= (int32)size);
+        CHECK(Platform::MemoryCompare(result.Get(), data.Get(), size) == 0);
+#if COMPILE_WITH_PROFILER
+        CHECK(RenderStatsData::Counter.UploadBytes - before.UploadBytes == size);
+        CHECK(RenderStatsData::Counter.UploadStalls == before.UploadStalls);
+        CHECK(RenderStatsData::Counter.UploadFallbacks == before.UploadFallbacks);
+#endif
+
+        SAFE_DELETE_GPU_RESOURCE(readback);
+        SAFE_DELETE_GPU_RESOURCE(buffer);
+    }
+    SECTION("Test Skinned Mesh Pose History")
+    {
+        if (GPUDevice::Instance == nullptr)
+            return;
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        Matrix bones[2] = { Matrix::Identity, Matrix::Identity };
+        SkinnedMeshDrawData data;
+        data.Setup(2);
+        data.SetData(bones, false);
+        CHECK(data.IsDirty());
+        CHECK(data.PrevBoneMatrices == nullptr);
+        data.Flush(context);
+        CHECK(!data.IsPrevPoseSame());
+
+        // Unchanged pose is uploaded once more to match the history and then skipped
+        data.SetData(bones, false);
+        CHECK(data.IsDirty());
+        CHECK(data.PrevBoneMatrices != nullptr);
+        data.Flush(context);
+        CHECK(data.IsPrevPoseSame());
+        GPUBuffer* boneMatrices = data.BoneMatrices;
+        data.SetData(bones, false);
+        CHECK(!data.IsDirty());
+        CHECK(data.BoneMatrices == boneMatrices);
+
+        // Updates without a flush are merged and don't swap the history again
+        bones[0] = Matrix::Translation(Float3(1.0f, 0.0f, 0.0f));
+        data.SetData(bones, false);
+        CHECK(data.IsDirty());
+        CHECK(!data.IsPrevPoseSame());
+        boneMatrices = data.BoneMatrices;
+        GPUBuffer* prevBoneMatrices = data.PrevBoneMatrices;
+        bones[0] = Matrix::Translation(Float3(2.0f, 0.0f, 0.0f));
+        data.SetData(bones, false);
+        CHECK(data.BoneMatrices == boneMatrices);
+        CHECK(data.PrevBoneMatrices == prevBoneMatrices);
+        data.SetData(bones, false);
+        data.Flush(context);
+        CHECK(!data.IsPrevPoseSame());
+        data.SetData(bones, false);
+        CHECK(data.IsDirty());
+        CHECK(data.BoneMatrices == prevBoneMatrices);
+        data.Flush(context);
+        CHECK(data.IsPrevPoseSame());
+
+        // Dropping the history releases the previous bones and skips the unchanged pose
+        data.SetData(bones, true);
+        CHECK(!data.IsDirty());
+        CHECK(!data.IsPrevPoseSame());
+        CHECK(data.PrevBoneMatrices == nullptr);
+        GPUDevice::Instance->WaitForGPU();
+    }
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    int32 ParseNumber(const String& text, int32& position)
+    {
+        int32 result = 0;
+        while (position < text.Length() && text[position] >= '0' && text[position] <= '9')
+            result = result * 10 + (text[position++] - '0');
+        return result;
+    }
+}
+
+TEST_CASE("Log")
+{
+    SECTION("Test Multi-threaded Logging Benchmark")
+    {
+        // Log from many threads at once
+        const int32 threadsCount = 16;
+        const int32 messagesCount = 2000;
+        Thread* threads[threadsCount];
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            Function<int32()> f = [i]()
+            {
+                for (int32 j = 0; j < messagesCount; j++)
+                    LOG(Info, "TestLog thread {0} message {1}", i, j);
+                return 0;
+            };
+            threads[i] = ThreadSpawner::Start(f, String::Format(TEXT("Test Log {0}"), i));
+        }
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            threads[i]->Join();
+            Delete(threads[i]);
+        }
+        const double writeTime = Platform::GetTimeSeconds() - startTime;
+        Log::Logger::Flush();
+        const double flushTime = Platform::GetTimeSeconds() - startTime;
+
+        // Verify that all messages were written in order
+        String text;
+        if (Log::Logger::LogFilePath.HasChars() && !File::ReadAllText(Log::Logger::LogFilePath, text))
+        {
+            const String prefix(TEXT("TestLog thread "));
+            int32 next[threadsCount] = {};
+            bool isOrdered = true;
+            int32 position = text.Find(*prefix);
+            while (position != -1)
+            {
+                position += prefix.Length();
+                const int32 thread = ParseNumber(text, position);
+                position += 9; // " message "
+                const int32 message = ParseNumber(text, position);
+                if (thread >= 0 && thread < threadsCount)
+                {
+                    isOrdered &= next[thread] == message;
+                    next[thread] = message + 1;
+                }
+                position = text.Find(*prefix, StringSearchCase::CaseSensitive, position);
+            }
+            CHECK(isOrdered);
+            for (int32 i = 0; i < threadsCount; i++)
+                CHECK(next[i] == messagesCount);
+        }
+
+        LOG(Info, "Log benchmark: {0} threads, {1} messages logged in {2} ms (flushed after {3} ms)", threadsCount, threadsCount * messagesCount, writeTime * 1000.0, flushTime * 1000.0);
+    }
+}
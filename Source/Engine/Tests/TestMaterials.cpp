@@ -0,0 +1,42 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/MaterialInstance.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Terrain/Terrain.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Materials")
+{
+    SECTION("Test Scene Materials Prewarm")
+    {
+        auto materialA = Content::CreateVirtualAsset<MaterialInstance>();
+        auto materialB = Content::CreateVirtualAsset<MaterialInstance>();
+        REQUIRE(materialA);
+        REQUIRE(materialB);
+
+        // Setup scene with the models and terrain that share the materials
+        auto scene = Scene::Spawn(ScriptingObject::SpawnParams(Guid::New(), Scene::TypeInitializer));
+        CHECK(scene->PrewarmMaterials() == 0);
+        for (int32 i = 0; i < 2; i++)
+        {
+            auto model = StaticModel::Spawn(ScriptingObject::SpawnParams(Guid::New(), StaticModel::TypeInitializer));
+            model->Entries.Resize(1);
+            model->Entries[0].Material = materialA;
+            model->SetParent(scene, false);
+        }
+        auto terrain = Terrain::Spawn(ScriptingObject::SpawnParams(Guid::New(), Terrain::TypeInitializer));
+        terrain->Material = materialB;
+        terrain->SetParent(scene, false);
+
+        // Each material is prewarmed once
+        CHECK(scene->PrewarmMaterials() == 2);
+        terrain->Material = materialA;
+        CHECK(scene->PrewarmMaterials() == 1);
+
+        scene->DeleteObjectNow();
+        Content::DeleteAsset(materialA);
+        Content::DeleteAsset(materialB);
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Name.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerMemory.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Name")
+{
+    SECTION("Test Interning")
+    {
+        const Name a(TEXT("TestName.Node"));
+        const Name b(String(TEXT("TestName.Node")));
+        const Name c("TestName.Node");
+        const Name d(TEXT("TestName.node"));
+        CHECK(a.HasChars());
+        CHECK(a == b);
+        CHECK(a == c);
+        CHECK(a != d);
+        CHECK(a.ToStringView() == TEXT("TestName.Node"));
+        CHECK(a.ToString() == TEXT("TestName.Node"));
+        CHECK(Name().IsEmpty());
+        CHECK(Name(StringView::Empty).IsEmpty());
+        CHECK(Name().ToStringView().IsEmpty());
+
+        // Case-insensitive comparison
+        CHECK(a.EqualsIgnoreCase(d));
+        CHECK(!a.EqualsIgnoreCase(Name(TEXT("TestName.Node2"))));
+        Dictionary<NameIgnoreCase, int32> ignoreCase;
+        ignoreCase[a] = 1;
+        CHECK(ignoreCase.ContainsKey(NameIgnoreCase(d)));
+
+        // Lookup doesn't add names
+        const int32 count = Name::GetCount();
+        Name found;
+        CHECK(Name::Find(TEXT("TestName.Node"), found));
+        CHECK(found == a);
+        CHECK(Name::Find("TestName.Node", found));
+        CHECK(found == a);
+        CHECK(!Name::Find(TEXT("TestName.Missing"), found));
+        CHECK(found.IsEmpty());
+        CHECK(Name::GetCount() == count);
+    }
+
+    SECTION("Test Multi-threaded Interning")
+    {
+        const int32 threadsCount = 8;
+        const int32 namesCount = 1000;
+        Thread* threads[threadsCount];
+        Name names[threadsCount][4];
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            Function<int32()> f = [i, &names]()
+            {
+                for (int32 j = 0; j < namesCount; j++)
+                {
+                    const Name name(String::Format(TEXT("TestName.Thread.{0}"), j));
+                    if (j % 250 == 0)
+                        names[i][j / 250] = name;
+                }
+                return 0;
+            };
+            threads[i] = ThreadSpawner::Start(f, String::Format(TEXT("Test Name {0}"), i));
+        }
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            threads[i]->Join();
+            Delete(threads[i]);
+        }
+        bool isMatching = true;
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            for (int32 j = 0; j < 4; j++)
+                isMatching &= names[i][j] == names[0][j] && names[i][j].ToString() == String::Format(TEXT("TestName.Thread.{0}"), j * 250);
+        }
+        CHECK(isMatching);
+    }
+
+    SECTION("Test Lookup Benchmark")
+    {
+        // Typical skeleton nodes or parameters names
+        const int32 count = 200;
+        const int32 lookups = 1000;
+        Array<String> strings;
+        Array<Name> names;
+        Dictionary<String, int32> stringToIndex;
+        Dictionary<Name, int32> nameToIndex;
+        for (int32 i = 0; i < count; i++)
+        {
+            strings.Add(String::Format(TEXT("Armature|mixamorig:Bone_{0}"), i));
+            names.Add(Name(strings.Last()));
+            stringToIndex[strings.Last()] = i;
+            nameToIndex[names.Last()] = i;
+        }
+        const int32 namesCount = Name::GetCount();
+
+        // Count the allocations done by the lookups (custom memory tag is not used by the engine, lookup loops are tagged with it)
+#if COMPILE_WITH_PROFILER
+        const bool wasEnabled = ProfilerMemory::GetEnabled();
+        ProfilerMemory::SetEnabled(true);
+        const auto getAllocations = []()
+        {
+            return ProfilerMemory::GetStats(MemoryTag::Custom).TotalAllocations;
+        };
+#else
+        const auto getAllocations = []()
+        {
+            return (int64)0;
+        };
+#endif
+
+        int64 startAllocations = getAllocations();
+        double startTime = Platform::GetTimeSeconds();
+        int32 stringHits = 0, index;
+        {
+            PROFILE_MEM(Custom);
+            for (int32 j = 0; j < lookups; j++)
+            {
+                for (int32 i = 0; i < count; i++)
+                    stringHits += stringToIndex.TryGet(strings[i], index) && index == i ? 1 : 0;
+            }
+        }
+        const double stringTime = Platform::GetTimeSeconds() - startTime;
+        const int64 stringAllocations = getAllocations() - startAllocations;
+        startAllocations = getAllocations();
+        startTime = Platform::GetTimeSeconds();
+        int32 nameHits = 0;
+        {
+            PROFILE_MEM(Custom);
+            for (int32 j = 0; j < lookups; j++)
+            {
+                for (int32 i = 0; i < count; i++)
+                    nameHits += nameToIndex.TryGet(names[i], index) && index == i ? 1 : 0;
+            }
+        }
+        const double nameTime = Platform::GetTimeSeconds() - startTime;
+        const int64 nameAllocations = getAllocations() - startAllocations;
+
+        // Lookup from the text (eg. name passed from scripts) finds the interned name without locking
+        startAllocations = getAllocations();
+        startTime = Platform::GetTimeSeconds();
+        int32 textHits = 0;
+        Name name;
+        {
+            PROFILE_MEM(Custom);
+            for (int32 j = 0; j < lookups; j++)
+            {
+                for (int32 i = 0; i < count; i++)
+                    textHits += Name::Find(strings[i], name) && nameToIndex.TryGet(name, index) && index == i ? 1 : 0;
+            }
+        }
+        const double textTime = Platform::GetTimeSeconds() - startTime;
+        const int64 textAllocations = getAllocations() - startAllocations;
+#if COMPILE_WITH_PROFILER
+        if (!wasEnabled)
+            ProfilerMemory::SetEnabled(false);
+#endif
+        CHECK(stringHits == count * lookups);
+        CHECK(nameHits == count * lookups);
+        CHECK(textHits == count * lookups);
+        CHECK(nameAllocations == 0);
+        CHECK(textAllocations == 0);
+        CHECK(Name::GetCount() == namesCount);
+
+        LOG(Info, "Name lookup benchmark: {0} lookups, strings: {1} ms ({2} allocations), names: {3} ms ({4} allocations), names from text: {5} ms ({6} allocations), {7} names interned", count * lookups, stringTime * 1000.0, stringAllocations, nameTime * 1000.0, nameAllocations, textTime * 1000.0, textAllocations, namesCount);
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Navigation/Navigation.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Navigation")
+{
+    SECTION("Test Multi-threaded Obstacles")
+    {
+        // Obstacles can be added and removed from different threads (eg. by the gameplay jobs)
+        const int32 threadsCount = 8;
+        const int32 obstaclesCount = 500;
+        Thread* threads[threadsCount];
+        Array<uint32> ids[threadsCount];
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            Function<int32()> f = [i, &ids]()
+            {
+                for (int32 j = 0; j < obstaclesCount; j++)
+                {
+                    const Vector3 position((float)i * 100.0f, 0.0f, (float)j * 100.0f);
+                    const uint32 id = j % 2 == 0 ? Navigation::AddCylinderObstacle(position, 50.0f, 200.0f) : Navigation::AddBoxObstacle(OrientedBoundingBox(Vector3(50.0f), Transform(position)));
+                    ids[i].Add(id);
+                    if (j % 4 == 0)
+                        Navigation::RemoveObstacle(id);
+                }
+                return 0;
+            };
+            threads[i] = ThreadSpawner::Start(f, String::Format(TEXT("Test Navigation {0}"), i));
+        }
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            threads[i]->Join();
+            Delete(threads[i]);
+        }
+
+        // Each obstacle gets a unique identifier
+        HashSet<uint32> uniqueIds;
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            for (const uint32 id : ids[i])
+            {
+                CHECK(id != 0);
+                uniqueIds.Add(id);
+            }
+        }
+        CHECK(uniqueIds.Count() == threadsCount * obstaclesCount);
+
+        // Cleanup
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            for (const uint32 id : ids[i])
+                Navigation::RemoveObstacle(id);
+        }
+    }
+}
@@ -0,0 +1,568 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Networking/NetworkPeer.h"
+#include "Engine/Networking/NetworkEvent.h"
+#include "Engine/Networking/NetworkChannelType.h"
+#include "Engine/Networking/NetworkReplicator.h"
+#include "Engine/Networking/Drivers/LoopbackDriver.h"
+#include "Engine/Level/Actors/EmptyActor.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Core/Math/Transform.h"
+
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    NetworkPeer* CreateLoopbackPeer(uint16 port, uint16 connectionsLimit = 32, uint16 messagePoolSize = 2048, uint16 messageSize = 1500)
+    {
+        NetworkConfig config;
+        config.NetworkDriver = New<LoopbackDriver>();
+        config.Address = TEXT("127.0.0.1");
+        config.Port = port;
+        config.ConnectionsLimit = connectionsLimit;
+        config.MessagePoolSize = messagePoolSize;
+        config.MessageSize = messageSize;
+        return NetworkPeer::CreatePeer(config);
+    }
+
+    LoopbackDriver* GetDriver(NetworkPeer* peer)
+    {
+        return (LoopbackDriver*)peer->Config.NetworkDriver;
+    }
+
+    int32 PumpEvents(NetworkPeer* peer, NetworkEventType type, uint32* bytes = nullptr)
+    {
+        int32 result = 0;
+        NetworkEvent e;
+        while (peer->PopEvent(e))
+        {
+            if (e.EventType == type)
+                result++;
+            if (e.EventType == NetworkEventType::Message)
+            {
+                if (bytes)
+                    *bytes += e.Message.Length;
+                peer->RecycleMessage(e.Message);
+            }
+        }
+        return result;
+    }
+
+    // Typical replicated actor state
+    struct ActorState
+    {
+        Transform Transform;
+        Vector3 Velocity;
+        int32 AnimState;
+        int32 Health;
+        bool IsGrounded;
+    };
+}
+
+TEST_CASE("Networking")
+{
+    SECTION("Loopback Driver")
+    {
+        NetworkPeer* server = CreateLoopbackPeer(17001);
+        NetworkPeer* client = CreateLoopbackPeer(17001);
+        REQUIRE(server);
+        REQUIRE(client);
+        REQUIRE(server->Listen());
+        REQUIRE(client->Connect());
+        CHECK(PumpEvents(server, NetworkEventType::Connected) == 1);
+        CHECK(PumpEvents(client, NetworkEventType::Connected) == 1);
+
+        // Client to server
+        NetworkMessage msg = client->BeginSendMessage();
+        msg.WriteInt32(1234);
+        client->EndSendMessage(NetworkChannelType::ReliableOrdered, msg);
+        NetworkEvent e;
+        REQUIRE(server->PopEvent(e));
+        CHECK(e.EventType == NetworkEventType::Message);
+        CHECK(e.Message.ReadInt32() == 1234);
+        const NetworkConnection connection = e.Sender;
+        server->RecycleMessage(e.Message);
+
+        // Server to client
+        msg = server->BeginSendMessage();
+        msg.WriteInt32(4321);
+        server->EndSendMessage(NetworkChannelType::Reliable, msg, connection);
+        REQUIRE(client->PopEvent(e));
+        CHECK(e.EventType == NetworkEventType::Message);
+        CHECK(e.Message.ReadInt32() == 4321);
+        client->RecycleMessage(e.Message);
+
+        // Simulated packet loss affects only unreliable channels
+        GetDriver(client)->PacketLoss = 1.0f;
+        for (int32 i = 0; i < 10; i++)
+        {
+            msg = client->BeginSendMessage();
+            msg.WriteInt32(i);
+            client->EndSendMessage(i % 2 == 0 ? NetworkChannelType::Unreliable : NetworkChannelType::Reliable, msg);
+        }
+        CHECK(PumpEvents(server, NetworkEventType::Message) == 5);
+        CHECK(GetDriver(client)->DroppedMessages == 5);
+
+        client->Disconnect();
+        CHECK(PumpEvents(server, NetworkEventType::Disconnected) == 1);
+
+        NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+    }
+    SECTION("Loopback Latency")
+    {
+        // Drive the simulated network with a manual clock to not depend on the real time
+        double time = 0.0;
+        LoopbackDriver::TimeSource.Bind([&time] { return time; });
+        NetworkPeer* server = CreateLoopbackPeer(17002);
+        NetworkPeer* client = CreateLoopbackPeer(17002);
+        REQUIRE(server);
+        REQUIRE(client);
+        REQUIRE(server->Listen());
+        REQUIRE(client->Connect());
+        PumpEvents(server, NetworkEventType::Connected);
+        PumpEvents(client, NetworkEventType::Connected);
+
+        // Ordered messages arrive in order despite the jitter
+        GetDriver(client)->Latency = 50.0f;
+        GetDriver(client)->Jitter = 20.0f;
+        for (int32 i = 0; i < 100; i++)
+        {
+            NetworkMessage msg = client->BeginSendMessage();
+            msg.WriteInt32(i);
+            client->EndSendMessage(NetworkChannelType::UnreliableOrdered, msg);
+        }
+        NetworkEvent e;
+        CHECK(!server->PopEvent(e));
+        time += 0.049;
+        CHECK(!server->PopEvent(e));
+        time += 0.022;
+        for (int32 i = 0; i < 100; i++)
+        {
+            REQUIRE(server->PopEvent(e));
+            CHECK(e.Message.ReadInt32() == i);
+            server->RecycleMessage(e.Message);
+        }
+
+        NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+        LoopbackDriver::TimeSource.Unbind();
+    }
+    SECTION("Loopback Flow Control")
+    {
+        NetworkPeer* server = CreateLoopbackPeer(17006, 32, 8);
+        NetworkPeer* client = CreateLoopbackPeer(17006);
+        REQUIRE(server);
+        REQUIRE(client);
+        REQUIRE(server->Listen());
+        REQUIRE(client->Connect());
+        PumpEvents(server, NetworkEventType::Connected);
+        PumpEvents(client, NetworkEventType::Connected);
+
+        // In-flight messages don't use the receiver pool so sending more than its size is fine
+        for (int32 i = 0; i < 32; i++)
+        {
+            NetworkMessage msg = client->BeginSendMessage();
+            msg.WriteInt32(i);
+            client->EndSendMessage(NetworkChannelType::ReliableOrdered, msg);
+        }
+        CHECK(GetDriver(client)->DroppedMessages == 0);
+
+        // Receiver gets no more messages than its pool size until it recycles them
+        NetworkEvent e;
+        Array<NetworkMessage> received;
+        while (server->PopEvent(e))
+            received.Add(e.Message);
+        CHECK(received.Count() == 8);
+        for (int32 i = 0; i < received.Count(); i++)
+        {
+            CHECK(received[i].ReadInt32() == i);
+            server->RecycleMessage(received[i]);
+        }
+        int32 index = received.Count();
+        while (server->PopEvent(e))
+        {
+            CHECK(e.Message.ReadInt32() == index++);
+            server->RecycleMessage(e.Message);
+        }
+        CHECK(index == 32);
+
+        NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+    }
+    SECTION("Loopback Message Size")
+    {
+        NetworkPeer* server = CreateLoopbackPeer(17007, 32, 2048, 100);
+        NetworkPeer* client = CreateLoopbackPeer(17007, 32, 2048, 200);
+        REQUIRE(server);
+        REQUIRE(client);
+        REQUIRE(server->Listen());
+        REQUIRE(client->Connect());
+        PumpEvents(server, NetworkEventType::Connected);
+        PumpEvents(client, NetworkEventType::Connected);
+
+        // Messages larger than the receiver message size are dropped
+        byte data[150] = {};
+        NetworkMessage msg = client->BeginSendMessage();
+        msg.WriteBytes(data, 150);
+        client->EndSendMessage(NetworkChannelType::Reliable, msg);
+        msg = client->BeginSendMessage();
+        msg.WriteBytes(data, 50);
+        client->EndSendMessage(NetworkChannelType::Reliable, msg);
+        uint32 bytes = 0;
+        CHECK(PumpEvents(server, NetworkEventType::Message, &bytes) == 1);
+        CHECK(bytes == 50);
+        CHECK(GetDriver(client)->DroppedMessages == 1);
+
+        NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+    }
+    SECTION("Bit Packing")
+    {
+        byte buffer[256];
+        NetworkMessage msg(buffer, 0, sizeof(buffer), 0, 0);
+        msg.WriteBits(5, 3);
+        msg.WriteBit(true);
+        msg.WriteInt32(1234);
+        msg.WriteRangedInt32(-3, -10, 10);
+        msg.WriteBits(0xABCDEF12, 32);
+        msg.WriteQuantizedSingle(0.25f, -1.0f, 1.0f, 12);
+        msg.WriteQuaternionSmallestThree(Quaternion::Euler(10.0f, 45.0f, -30.0f));
+        msg.WriteDeltaInt32(100, 100);
+        msg.WriteDeltaInt32(90, 100);
+        msg.WriteDeltaVector3(Vector3(1.0f, 2.0f, 3.0f), Vector3(1.0f, 1.5f, 3.0f), 0.01f);
+
+        msg.Position = 0;
+        msg.BitPosition = 0;
+        CHECK(msg.ReadBits(3) == 5);
+        CHECK(msg.ReadBit());
+        CHECK(msg.ReadInt32() == 1234);
+        CHECK(msg.ReadRangedInt32(-10, 10) == -3);
+        CHECK(msg.ReadBits(32) == 0xABCDEF12);
+        CHECK(Math::NearEqual(msg.ReadQuantizedSingle(-1.0f, 1.0f, 12), 0.25f, 0.001f));
+        const Quaternion q = msg.ReadQuaternionSmallestThree();
+        CHECK(Math::Abs(Quaternion::Dot(q, Quaternion::Euler(10.0f, 45.0f, -30.0f))) > 0.9999f);
+        CHECK(msg.ReadDeltaInt32(100) == 100);
+        CHECK(msg.ReadDeltaInt32(100) == 90);
+        CHECK(Vector3::NearEqual(msg.ReadDeltaVector3(Vector3(1.0f, 1.5f, 3.0f), 0.01f), Vector3(1.0f, 2.0f, 3.0f), 0.01f));
+        CHECK(msg.Position == msg.Length);
+    }
+    SECTION("Bit Packing Bandwidth")
+    {
+        // Compares the size of the typical actors state replication using raw values and bit-packed/quantized/delta encoding
+        const int32 actorsCount = 64;
+        const int32 framesCount = 60;
+        Array<ActorState> states, baselines;
+        states.Resize(actorsCount);
+        for (int32 i = 0; i < actorsCount; i++)
+        {
+            auto& state = states[i];
+            state.Transform = Transform(Vector3(i * 100.0f, 0.0f, i * -50.0f), Quaternion::Euler(0.0f, i * 10.0f, 0.0f));
+            state.Velocity = Vector3((float)(i % 5) * 100.0f, 0.0f, 0.0f);
+            state.AnimState = i % 6;
+            state.Health = 100;
+            state.IsGrounded = true;
+        }
+        baselines = states;
+        byte buffer[1024 * 16];
+        uint32 rawBytes = 0, packedBytes = 0;
+        for (int32 frame = 0; frame < framesCount; frame++)
+        {
+            // Simulate movement (some actors are idle)
+            for (int32 i = 0; i < actorsCount; i++)
+            {
+                auto& state = states[i];
+                state.Transform.Translation += state.Velocity * (1.0f / 60.0f);
+                if (i % 3 == 0)
+                    state.Transform.Orientation = Quaternion::Euler(0.0f, (float)(frame + i * 10), 0.0f);
+                if (frame % 20 == i % 20)
+                    state.Health--;
+            }
+
+            NetworkMessage raw(buffer, 0, sizeof(buffer), 0, 0);
+            for (const auto& state : states)
+            {
+                raw.WriteVector3(state.Transform.Translation);
+                raw.WriteQuaternion(state.Transform.Orientation);
+                raw.WriteVector3(state.Transform.Scale);
+                raw.WriteVector3(state.Velocity);
+                raw.WriteInt32(state.AnimState);
+                raw.WriteInt32(state.Health);
+                raw.WriteBoolean(state.IsGrounded);
+            }
+            rawBytes += raw.Length;
+
+            NetworkMessage packed(buffer, 0, sizeof(buffer), 0, 0);
+            for (int32 i = 0; i < actorsCount; i++)
+            {
+                const auto& state = states[i];
+                auto& baseline = baselines[i];
+                packed.WriteDeltaVector3(state.Transform.Translation, baseline.Transform.Translation, 0.1f);
+                packed.WriteDeltaQuaternion(state.Transform.Orientation, baseline.Transform.Orientation);
+                packed.WriteBit(state.Transform.Scale != baseline.Transform.Scale);
+                if (state.Transform.Scale != baseline.Transform.Scale)
+                    packed.WriteQuantizedVector3(state.Transform.Scale, Vector3::Zero, Vector3(10.0f), 12);
+                packed.WriteQuantizedVector3(state.Velocity, Vector3(-1000.0f), Vector3(1000.0f), 12);
+                packed.WriteRangedInt32(state.AnimState, 0, 5);
+                packed.WriteDeltaInt32(state.Health, baseline.Health);
+                packed.WriteBit(state.IsGrounded);
+            }
+            packedBytes += packed.Length;
+
+            // Decode to update the baseline the same way as receiver does
+            packed.Position = 0;
+            packed.BitPosition = 0;
+            for (int32 i = 0; i < actorsCount; i++)
+            {
+                auto& baseline = baselines[i];
+                baseline.Transform.Translation = packed.ReadDeltaVector3(baseline.Transform.Translation, 0.1f);
+                baseline.Transform.Orientation = packed.ReadDeltaQuaternion(baseline.Transform.Orientation);
+                if (packed.ReadBit())
+                    baseline.Transform.Scale = packed.ReadQuantizedVector3(Vector3::Zero, Vector3(10.0f), 12);
+                baseline.Velocity = packed.ReadQuantizedVector3(Vector3(-1000.0f), Vector3(1000.0f), 12);
+                baseline.AnimState = packed.ReadRangedInt32(0, 5);
+                baseline.Health = packed.ReadDeltaInt32(baseline.Health);
+                baseline.IsGrounded = packed.ReadBit();
+                CHECK(Vector3::NearEqual(baseline.Transform.Translation, states[i].Transform.Translation, 0.1f));
+                CHECK(baseline.Health == states[i].Health);
+            }
+        }
+        CHECK(packedBytes < rawBytes);
+        LOG(Info, "Bit packing benchmark: {0} actors, {1} frames, raw {2} B/frame, packed {3} B/frame ({4}%)",
+            actorsCount, framesCount, rawBytes / framesCount, packedBytes / framesCount, (int32)(packedBytes * 100.0f / rawBytes));
+    }
+    SECTION("Replication Benchmark")
+    {
+        // Replicates many moving actors to many clients (each with own viewer location) and measures the bandwidth and time
+        const int32 actorsCount = 1000;
+        const int32 clientsCount = 64;
+        const int32 ticksCount = 60;
+        const float tickTime = 1.0f / 30.0f;
+        NetworkPeer* server = CreateLoopbackPeer(17004, clientsCount);
+        REQUIRE(server);
+        REQUIRE(server->Listen());
+        NetworkReplicator serverReplicator(server, true);
+        Array<Actor*> actors;
+        for (int32 i = 0; i < actorsCount; i++)
+        {
+            auto actor = New<EmptyActor>();
+            actor->SetPosition(Vector3((float)(i % 32) * 1000.0f, 0.0f, (float)(i / 32) * 1000.0f));
+            REQUIRE(!serverReplicator.AddObject(actor, i % 10 == 0 ? 2.0f : 1.0f));
+            actors.Add(actor);
+        }
+        Array<NetworkPeer*> clients;
+        Array<NetworkReplicator*> clientReplicators;
+        for (int32 i = 0; i < clientsCount; i++)
+        {
+            NetworkPeer* client = CreateLoopbackPeer(17004, 32, 256);
+            REQUIRE(client);
+            REQUIRE(client->Connect());
+            PumpEvents(client, NetworkEventType::Connected);
+            clients.Add(client);
+            clientReplicators.Add(New<NetworkReplicator>(client, false));
+        }
+        NetworkEvent e;
+        int32 connectionIndex = 0;
+        while (server->PopEvent(e))
+        {
+            if (e.EventType == NetworkEventType::Connected)
+            {
+                serverReplicator.AddClient(e.Sender);
+                serverReplicator.SetClientViewer(e.Sender, Vector3((float)(connectionIndex % 8) * 4000.0f, 0.0f, (float)(connectionIndex / 8) * 4000.0f));
+                connectionIndex++;
+            }
+        }
+        REQUIRE(connectionIndex == clientsCount);
+
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 tick = 0; tick < ticksCount; tick++)
+        {
+            // Move some actors
+            for (int32 i = 0; i < actorsCount; i += 3)
+                actors[i]->SetPosition(actors[i]->GetPosition() + Vector3(10.0f, 0.0f, 0.0f));
+
+            serverReplicator.Update(tickTime);
+            for (int32 i = 0; i < clientsCount; i++)
+            {
+                while (clients[i]->PopEvent(e))
+                {
+                    if (e.EventType == NetworkEventType::Message)
+                    {
+                        clientReplicators[i]->ProcessMessage(e.Message, e.Sender);
+                        clients[i]->RecycleMessage(e.Message);
+                    }
+                }
+            }
+            while (server->PopEvent(e))
+            {
+                if (e.EventType == NetworkEventType::Message)
+                {
+                    serverReplicator.ProcessMessage(e.Message, e.Sender);
+                    server->RecycleMessage(e.Message);
+                }
+            }
+        }
+        const double time = Platform::GetTimeSeconds() - startTime;
+        uint64 receivedObjects = 0, failedDeltas = 0;
+        for (auto replicator : clientReplicators)
+        {
+            receivedObjects += replicator->Stats.ReceivedObjects;
+            failedDeltas += replicator->Stats.FailedDeltas;
+        }
+        const auto& stats = serverReplicator.Stats;
+        CHECK(stats.SentObjects == receivedObjects);
+        CHECK(failedDeltas == 0);
+        CHECK(stats.SentDeltas > 0);
+        LOG(Info, "Replication benchmark: {0} actors, {1} clients, {2} ticks in {3} ms ({4} ms/tick), sent {5} objects ({6} deltas, {7} skipped as up-to-date), {8} B/client/tick",
+            actorsCount, clientsCount, ticksCount, (int32)(time * 1000.0), (float)(time * 1000.0 / ticksCount), stats.SentObjects, stats.SentDeltas, stats.SkippedUpToDate, (int32)(stats.SentBytes / clientsCount / ticksCount));
+
+        clientReplicators.ClearDelete();
+        for (NetworkPeer* client : clients)
+            NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+        for (Actor* actor : actors)
+            actor->DeleteObject();
+    }
+    SECTION("Replication Snapshots Validation")
+    {
+        NetworkPeer* server = CreateLoopbackPeer(17005);
+        REQUIRE(server);
+        REQUIRE(server->Listen());
+        NetworkPeer* client = CreateLoopbackPeer(17005);
+        REQUIRE(client);
+        REQUIRE(client->Connect());
+        PumpEvents(client, NetworkEventType::Connected);
+        NetworkReplicator replicator(client, false);
+
+        // Writes the snapshot with a single full state entry (object id included)
+        byte buffer[2048];
+        const Guid objectId = Guid::New();
+        const auto writeSnapshot = [&](uint32 snapshotId, uint16 size, uint32 dataSize)
+        {
+            NetworkMessage msg(buffer, 0, sizeof(buffer), 0, 0);
+            msg.WriteUInt8((uint8)NetworkReplicatorMessageType::Snapshot);
+            msg.WriteUInt32(snapshotId);
+            msg.WriteUInt16(1);
+            msg.WriteUInt32(1);
+            msg.WriteUInt8(1); // HasObjectId
+            msg.WriteGuid(objectId);
+            msg.WriteUInt16(size);
+            byte data[1024] = {};
+            data[0] = (byte)snapshotId;
+            msg.WriteBytes(data, (int32)dataSize);
+            msg.Position = 0;
+            return msg;
+        };
+
+        // Snapshots arriving out of order don't roll the state back
+        NetworkMessage msg = writeSnapshot(2, 4, 4);
+        CHECK(replicator.ProcessMessage(msg, NetworkConnection()));
+        msg = writeSnapshot(1, 4, 4);
+        CHECK(replicator.ProcessMessage(msg, NetworkConnection()));
+        CHECK(replicator.Stats.ReceivedObjects == 1);
+        CHECK(replicator.Stats.StaleObjects == 1);
+        msg = writeSnapshot(3, 4, 4);
+        CHECK(replicator.ProcessMessage(msg, NetworkConnection()));
+        CHECK(replicator.Stats.ReceivedObjects == 2);
+
+        // State size larger than the limit or the received data is rejected
+        msg = writeSnapshot(4, NETWORK_REPLICATOR_MAX_STATE_SIZE + 1, 4);
+        CHECK(replicator.ProcessMessage(msg, NetworkConnection()));
+        CHECK(replicator.Stats.RejectedSnapshots == 1);
+        msg = writeSnapshot(5, 64, 4);
+        CHECK(replicator.ProcessMessage(msg, NetworkConnection()));
+        CHECK(replicator.Stats.RejectedSnapshots == 2);
+        CHECK(replicator.Stats.ReceivedObjects == 2);
+
+        NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+    }
+    SECTION("Loopback Benchmark")
+    {
+        // Drives many clients against a single server to measure the peer messages throughput without real sockets
+        const int32 clientsCount = 16;
+        const int32 framesCount = 200;
+        const int32 messagesPerFrame = 32;
+        const int32 messageSize = 200;
+        byte payload[messageSize] = {};
+        NetworkPeer* server = CreateLoopbackPeer(17003, clientsCount);
+        REQUIRE(server);
+        REQUIRE(server->Listen());
+        Array<NetworkPeer*> clients;
+        for (int32 i = 0; i < clientsCount; i++)
+        {
+            NetworkPeer* client = CreateLoopbackPeer(17003);
+            REQUIRE(client);
+            REQUIRE(client->Connect());
+            PumpEvents(client, NetworkEventType::Connected);
+            clients.Add(client);
+        }
+        Array<NetworkConnection> connections;
+        NetworkEvent e;
+        while (server->PopEvent(e))
+        {
+            if (e.EventType == NetworkEventType::Connected)
+                connections.Add(e.Sender);
+        }
+        REQUIRE(connections.Count() == clientsCount);
+
+#if COMPILE_WITH_PROFILER
+        const int32 profilerEvent = ProfilerCPU::BeginEvent(TEXT("Networking.LoopbackBenchmark"));
+#endif
+        const double startTime = Platform::GetTimeSeconds();
+        uint32 serverBytes = 0, clientsBytes = 0;
+        int32 serverMessages = 0, clientsMessages = 0, createdMessages = 0;
+        for (int32 frame = 0; frame < framesCount; frame++)
+        {
+            // Clients input
+            for (NetworkPeer* client : clients)
+            {
+                for (int32 i = 0; i < messagesPerFrame; i++)
+                {
+                    NetworkMessage msg = client->BeginSendMessage();
+                    msg.WriteBytes(payload, messageSize);
+                    client->EndSendMessage(NetworkChannelType::Unreliable, msg);
+                    createdMessages++;
+                }
+            }
+            const int32 serverReceived = PumpEvents(server, NetworkEventType::Message, &serverBytes);
+            serverMessages += serverReceived;
+            createdMessages += serverReceived;
+
+            // Server state broadcast
+            for (int32 i = 0; i < messagesPerFrame; i++)
+            {
+                NetworkMessage msg = server->BeginSendMessage();
+                msg.WriteBytes(payload, messageSize);
+                server->EndSendMessage(NetworkChannelType::ReliableOrdered, msg, connections);
+                createdMessages++;
+            }
+            for (NetworkPeer* client : clients)
+            {
+                const int32 clientReceived = PumpEvents(client, NetworkEventType::Message, &clientsBytes);
+                clientsMessages += clientReceived;
+                createdMessages += clientReceived;
+            }
+        }
+        const double time = Platform::GetTimeSeconds() - startTime;
+        int32 allocatedBytes = 0;
+#if COMPILE_WITH_PROFILER
+        if (profilerEvent != -1)
+        {
+            allocatedBytes = ProfilerCPU::GetCurrentThread()->Buffer.Get(profilerEvent).NativeMemoryAllocation;
+            ProfilerCPU::EndEvent(profilerEvent);
+        }
+#endif
+        CHECK(serverMessages == clientsCount * framesCount * messagesPerFrame);
+        CHECK(clientsMessages == clientsCount * framesCount * messagesPerFrame);
+        const int32 messages = serverMessages + clientsMessages;
+        LOG(Info, "Loopback benchmark: {0} clients, {1} messages in {2} ms ({3} msg/s, {4} KB/s), {5} pooled messages created, {6} bytes allocated",
+            clientsCount, messages, (int32)(time * 1000.0), (int32)(messages / time), (int32)((serverBytes + clientsBytes) / time / 1024.0), createdMessages, allocatedBytes);
+
+        for (NetworkPeer* client : clients)
+            NetworkPeer::ShutdownPeer(client);
+        NetworkPeer::ShutdownPeer(server);
+    }
+}
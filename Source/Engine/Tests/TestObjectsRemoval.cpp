@@ -0,0 +1,94 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Object.h"
+#include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Platform/Platform.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    double FlushTime;
+    int32 DeletedCount;
+    int32 DeletedEarlyCount;
+
+    class TestRemovalObject : public Object
+    {
+    public:
+        float TimeToLive = 0.0f;
+
+        String ToString() const override
+        {
+            return TEXT("TestRemovalObject");
+        }
+
+        void OnDeleteObject() override
+        {
+            DeletedCount++;
+            if (FlushTime < TimeToLive)
+                DeletedEarlyCount++;
+            Object::OnDeleteObject();
+        }
+    };
+}
+
+TEST_CASE("ObjectsRemovalService")
+{
+    SECTION("Test Timeouts")
+    {
+        FlushTime = 0.0;
+        DeletedCount = 0;
+        DeletedEarlyCount = 0;
+        auto a = New<TestRemovalObject>();
+        auto b = New<TestRemovalObject>();
+        auto c = New<TestRemovalObject>();
+        a->DeleteObject(0.0f);
+        b->TimeToLive = 0.5f;
+        b->DeleteObject(b->TimeToLive);
+        c->TimeToLive = 2.0f;
+        c->DeleteObject(10.0f);
+        c->DeleteObject(c->TimeToLive); // Last request wins
+        ObjectsRemovalService::Flush();
+        CHECK(DeletedCount == 1);
+        for (int32 i = 0; i < 300; i++)
+        {
+            FlushTime += 0.01;
+            ObjectsRemovalService::Flush(0.01f, 0.0f);
+        }
+        CHECK(DeletedCount == 3);
+        CHECK(DeletedEarlyCount == 0);
+    }
+
+    SECTION("Test Benchmark")
+    {
+        // Schedule 100k removals with different timeouts and simulate 60 FPS updates until all get deleted
+        const int32 count = 100000;
+        FlushTime = 0.0;
+        DeletedCount = 0;
+        DeletedEarlyCount = 0;
+        RandomStream random(0);
+        double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < count; i++)
+        {
+            auto obj = New<TestRemovalObject>();
+            obj->TimeToLive = random.GetFraction() * 10.0f;
+            obj->DeleteObject(obj->TimeToLive);
+        }
+        const double addTime = Platform::GetTimeSeconds() - startTime;
+        const float dt = 1.0f / 60.0f;
+        int32 frames = 0;
+        startTime = Platform::GetTimeSeconds();
+        while (DeletedCount < count && frames < 60 * 12)
+        {
+            FlushTime += dt;
+            ObjectsRemovalService::Flush(dt, 0.0f);
+            frames++;
+        }
+        const double flushTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(DeletedCount == count);
+        CHECK(DeletedEarlyCount == 0);
+        LOG(Info, "Objects removal benchmark: {0} objects, add {1} ms, {2} flushes in {3} ms ({4} us/flush)", count, addTime * 1000.0, frames, flushTime * 1000.0, flushTime * 1000000.0 / frames);
+    }
+}
@@ -7,6 +7,7 @@
 #include "Engine/Level/Actors/EmptyActor.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
+#include "Engine/Level/Prefabs/PrefabPool.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 
 #include <ThirdParty/catch2/catch.hpp>
@@ -245,4 +246,174 @@ TEST_CASE("Prefabs")
         Content::DeleteAsset(prefabA);
         Content::DeleteAsset(prefabB);
     }
+    SECTION("Test Spawn Benchmark")
+    {
+        // Create Prefab B with a child
+        AssetReference<Prefab> prefabB = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefabB);
+        Guid id;
+        Guid::Parse("3a2b8e0e4b1f4f6f9c7d5e4a3b2c1d0e", id);
+        prefabB->ChangeID(id);
+        auto prefabBInit = prefabB->Init(Prefab::TypeName,
+                                         "["
+                                         "{"
+                                         "\"ID\": \"8b7c6d5e4f3a2b1c0d9e8f7a6b5c4d3e\","
+                                         "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                         "\"Name\": \"Prefab B.Root\""
+                                         "},"
+                                         "{"
+                                         "\"ID\": \"1f2e3d4c5b6a79881f2e3d4c5b6a7988\","
+                                         "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                         "\"ParentID\": \"8b7c6d5e4f3a2b1c0d9e8f7a6b5c4d3e\","
+                                         "\"Name\": \"Prefab B.Child\""
+                                         "}"
+                                         "]");
+        REQUIRE(!prefabBInit);
+
+        // Create Prefab A with nested Prefab B (with overriden name)
+        AssetReference<Prefab> prefabA = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefabA);
+        Guid::Parse("9d8c7b6a5f4e3d2c1b0a9f8e7d6c5b4a", id);
+        prefabA->ChangeID(id);
+        auto prefabAInit = prefabA->Init(Prefab::TypeName,
+                                         "["
+                                         "{"
+                                         "\"ID\": \"4a5b6c7d8e9f0a1b2c3d4e5f6a7b8c9d\","
+                                         "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                         "\"Name\": \"Prefab A.Root\""
+                                         "},"
+                                         "{"
+                                         "\"ID\": \"5b6c7d8e9f0a1b2c3d4e5f6a7b8c9d0e\","
+                                         "\"PrefabID\": \"3a2b8e0e4b1f4f6f9c7d5e4a3b2c1d0e\","
+                                         "\"PrefabObjectID\": \"8b7c6d5e4f3a2b1c0d9e8f7a6b5c4d3e\","
+                                         "\"ParentID\": \"4a5b6c7d8e9f0a1b2c3d4e5f6a7b8c9d\","
+                                         "\"Name\": \"Prefab A.Nested\""
+                                         "},"
+                                         "{"
+                                         "\"ID\": \"6c7d8e9f0a1b2c3d4e5f6a7b8c9d0e1f\","
+                                         "\"PrefabID\": \"3a2b8e0e4b1f4f6f9c7d5e4a3b2c1d0e\","
+                                         "\"PrefabObjectID\": \"1f2e3d4c5b6a79881f2e3d4c5b6a7988\","
+                                         "\"ParentID\": \"5b6c7d8e9f0a1b2c3d4e5f6a7b8c9d0e\""
+                                         "}"
+                                         "]");
+        REQUIRE(!prefabAInit);
+        REQUIRE(prefabA->GetTemplate());
+        REQUIRE(prefabA->GetTemplate()->Objects.Count() == 3);
+
+        // Spawn batch of instances from the compiled template
+        const int32 count = 1000;
+        Array<Transform> transforms;
+        transforms.Resize(count);
+        for (int32 i = 0; i < count; i++)
+            transforms[i] = Transform(Vector3((float)i, 0, 0));
+        double startTime = Platform::GetTimeSeconds();
+        Array<Actor*> instances = PrefabManager::SpawnPrefab(prefabA, ToSpan(transforms.Get(), transforms.Count()));
+        const double batchTime = Platform::GetTimeSeconds() - startTime;
+        REQUIRE(instances.Count() == count);
+        for (int32 i = 0; i < count; i++)
+        {
+            Actor* instance = instances[i];
+            REQUIRE(instance);
+            CHECK(instance->GetName() == TEXT("Prefab A.Root"));
+            CHECK(instance->GetPosition() == transforms[i].Translation);
+            CHECK(instance->GetPrefabID() == prefabA->GetID());
+            REQUIRE(instance->GetChildrenCount() == 1);
+            CHECK(instance->Children[0]->GetName() == TEXT("Prefab A.Nested"));
+            REQUIRE(instance->Children[0]->GetChildrenCount() == 1);
+            CHECK(instance->Children[0]->Children[0]->GetName() == TEXT("Prefab B.Child"));
+        }
+        CHECK(instances[0]->GetID() != instances[1]->GetID());
+        CHECK(instances[0]->Children[0]->GetID() != instances[1]->Children[0]->GetID());
+
+        // Spawn the same amount of instances one by one (the default spawn path)
+        Array<Actor*> singleInstances;
+        singleInstances.Resize(count);
+        startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < count; i++)
+            singleInstances[i] = PrefabManager::SpawnPrefab(prefabA, transforms[i]);
+        const double singleTime = Platform::GetTimeSeconds() - startTime;
+        REQUIRE(singleInstances[0]);
+        CHECK(singleInstances[0]->Children[0]->GetName() == TEXT("Prefab A.Nested"));
+        LOG(Info, "Prefab spawn benchmark: {0} instances, batch {1} us/spawn, single {2} us/spawn", count, batchTime * 1000000.0 / count, singleTime * 1000000.0 / count);
+
+        // Cleanup
+        for (Actor* instance : instances)
+            instance->DeleteObject();
+        for (Actor* instance : singleInstances)
+            instance->DeleteObject();
+        Content::DeleteAsset(prefabA);
+        Content::DeleteAsset(prefabB);
+    }
+    SECTION("Test Prefab Pool")
+    {
+        AssetReference<Prefab> prefab = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefab);
+        auto prefabInit = prefab->Init(Prefab::TypeName,
+                                       "["
+                                       "{"
+                                       "\"ID\": \"0d1c2b3a49584f6e7d8c9bab0a1b2c3d\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"Name\": \"Pooled.Root\""
+                                       "},"
+                                       "{"
+                                       "\"ID\": \"1e2d3c4b5a69708f8e9dacbc1b2c3d4e\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"ParentID\": \"0d1c2b3a49584f6e7d8c9bab0a1b2c3d\","
+                                       "\"Name\": \"Pooled.Child\""
+                                       "}"
+                                       "]");
+        REQUIRE(!prefabInit);
+        PrefabPool::SetCapacity(prefab, 2);
+
+        // Spawn new instance and modify it
+        Actor* instance = PrefabPool::Spawn(prefab, Transform(Vector3(1, 2, 3)));
+        REQUIRE(instance);
+        CHECK(instance->GetPosition() == Vector3(1, 2, 3));
+        const Guid childId = instance->Children[0]->GetID();
+        const Guid childPrefabObjectId = instance->Children[0]->GetPrefabObjectID();
+        instance->Children[0]->SetName(TEXT("Modified"));
+        instance->Children[0]->SetIsActive(false);
+
+        // Despawn and spawn again to reuse the same objects with the prefab state restored
+        PrefabPool::Despawn(instance);
+        CHECK(!instance->GetIsActive());
+        Actor* reused = PrefabPool::Spawn(prefab, Transform(Vector3(4, 5, 6)));
+        REQUIRE(reused == instance);
+        CHECK(reused->GetIsActive());
+        CHECK(reused->GetPosition() == Vector3(4, 5, 6));
+        REQUIRE(reused->GetChildrenCount() == 1);
+        CHECK(reused->Children[0]->GetID() == childId);
+        CHECK(reused->Children[0]->GetName() == TEXT("Pooled.Child"));
+        CHECK(reused->Children[0]->GetIsActive());
+        CHECK(reused->Children[0]->IsActiveInHierarchy());
+        CHECK(reused->Children[0]->GetPrefabObjectID() == childPrefabObjectId);
+
+        // Prewarm and despawn above the capacity
+        PrefabPool::Prewarm(prefab, 2);
+        CHECK(PrefabPool::GetStats(prefab).Pooled == 2);
+        PrefabPool::Despawn(reused);
+        auto stats = PrefabPool::GetStats(prefab);
+        CHECK(stats.Spawned == 2);
+        CHECK(stats.Reused == 1);
+        CHECK(stats.Created == 3);
+        CHECK(stats.Despawned == 2);
+        CHECK(stats.Destroyed == 1);
+        CHECK(stats.Pooled == 2);
+
+        // Instance deactivated by the user is still returned to the pool (but only once)
+        PrefabPool::Clear(prefab);
+        Actor* inactive = PrefabPool::Spawn(prefab, Transform(Vector3::Zero));
+        REQUIRE(inactive);
+        inactive->SetIsActive(false);
+        PrefabPool::Despawn(inactive);
+        PrefabPool::Despawn(inactive);
+        stats = PrefabPool::GetStats(prefab);
+        CHECK(stats.Despawned == 3);
+        CHECK(stats.Pooled == 1);
+
+        // Cleanup
+        PrefabPool::Clear(prefab);
+        CHECK(PrefabPool::GetStats(prefab).Pooled == 0);
+        Content::DeleteAsset(prefab);
+    }
 }
@@ -0,0 +1,72 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerMemory.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+// Memory allocations hooks are used only by the profiler builds on desktop platforms
+#if COMPILE_WITH_PROFILER && (PLATFORM_WINDOWS || PLATFORM_LINUX)
+
+TEST_CASE("ProfilerMemory")
+{
+    SECTION("Test Memory Tags")
+    {
+        // Custom tag is not used by the engine so other threads don't affect its stats
+        const bool wasEnabled = ProfilerMemory::GetEnabled();
+        ProfilerMemory::SetEnabled(true);
+        const MemoryTagStats before = ProfilerMemory::GetStats(MemoryTag::Custom);
+
+        // Untagged allocation is not tracked
+        void* untagged = Platform::Allocate(1000, 16);
+        CHECK(ProfilerMemory::GetCurrentTag() == MemoryTag::None);
+        CHECK(ProfilerMemory::GetStats(MemoryTag::Custom).Current == before.Current);
+
+        // Memory is accounted to the innermost tag
+        void* tagged;
+        {
+            PROFILE_MEM(Physics);
+            {
+                PROFILE_MEM(Custom);
+                CHECK(ProfilerMemory::GetCurrentTag() == MemoryTag::Custom);
+                tagged = Platform::Allocate(1000, 16);
+            }
+            CHECK(ProfilerMemory::GetCurrentTag() == MemoryTag::Physics);
+        }
+        CHECK(ProfilerMemory::GetCurrentTag() == MemoryTag::None);
+        MemoryTagStats stats = ProfilerMemory::GetStats(MemoryTag::Custom);
+        CHECK(stats.Current == before.Current + 1000);
+        CHECK(stats.Allocations == before.Allocations + 1);
+        CHECK(stats.TotalAllocations == before.TotalAllocations + 1);
+        CHECK(stats.Peak >= stats.Current);
+
+        // Free is tracked outside the tag scope
+        Platform::Free(tagged);
+        Platform::Free(untagged);
+        stats = ProfilerMemory::GetStats(MemoryTag::Custom);
+        CHECK(stats.Current == before.Current);
+        CHECK(stats.Allocations == before.Allocations);
+        CHECK(stats.TotalAllocations == before.TotalAllocations + 1);
+
+        ProfilerMemory::SetBudget(MemoryTag::Custom, 1024);
+        CHECK(ProfilerMemory::GetStats(MemoryTag::Custom).Budget == 1024);
+        ProfilerMemory::SetBudget(MemoryTag::Custom, 0);
+
+        // Disabling the tracking resets the stats
+        {
+            PROFILE_MEM(Custom);
+            tagged = Platform::Allocate(1000, 16);
+        }
+        CHECK(ProfilerMemory::GetStats(MemoryTag::Custom).Current == before.Current + 1000);
+        ProfilerMemory::SetEnabled(false);
+        stats = ProfilerMemory::GetStats(MemoryTag::Custom);
+        CHECK(stats.Current == 0);
+        CHECK(stats.Peak == 0);
+        CHECK(stats.Allocations == 0);
+        CHECK(stats.TotalAllocations == 0);
+        Platform::Free(tagged);
+        CHECK(ProfilerMemory::GetStats(MemoryTag::Custom).Current == 0);
+        ProfilerMemory::SetEnabled(wasEnabled);
+    }
+}
+
+#endif
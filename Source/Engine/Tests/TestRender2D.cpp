@@ -0,0 +1,139 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Matrix3x3.h"
+#include "Engine/Core/Math/Rectangle.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Render2D/Render2D.h"
+#include "Engine/Render2D/Render2DCommandList.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Render2D")
+{
+    SECTION("Test Command List Benchmark")
+    {
+        // Drawing is done outside the frame rendering so use only the Null device
+        if (GPUDevice::Instance == nullptr || GPUDevice::Instance->GetRendererType() != RendererType::Null)
+            return;
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        GPUTexture* output = GPUDevice::Instance->CreateTexture(TEXT("Test Render2D"));
+        REQUIRE(!output->Init(GPUTextureDescription::New2D(1920, 1080, PixelFormat::R8G8B8A8_UNorm)));
+        auto list = Render2DCommandList::Spawn(ScriptingObject::SpawnParams(Guid::New(), Render2DCommandList::TypeInitializer));
+
+        // Static widgets (background and a frame)
+        const int32 widgetsCount = 5000;
+        const auto drawWidgets = [=]()
+        {
+            for (int32 i = 0; i < widgetsCount; i++)
+            {
+                const Rectangle rect((float)(i % 100) * 19.0f, (float)(i / 100) * 21.0f, 18.0f, 20.0f);
+                Render2D::FillRectangle(rect, Color(0.2f, 0.2f, 0.2f, 0.8f));
+                Render2D::FillRectangle(rect.MakeExpanded(-2.0f), Color(0.5f, 0.5f, 0.5f, 0.8f));
+            }
+        };
+        const Matrix3x3 transform = Matrix3x3::Translation2D(Float2(10.0f, 20.0f));
+
+        double startTime = Platform::GetTimeSeconds();
+        Render2D::Begin(context, output);
+        Render2D::PushTransform(transform);
+        drawWidgets();
+        Render2D::PopTransform();
+        Render2D::End();
+        const double immediateTime = Platform::GetTimeSeconds() - startTime;
+
+        startTime = Platform::GetTimeSeconds();
+        Render2D::Begin(context, output);
+        Render2D::PushTransform(transform);
+        Render2D::BeginRecording(list);
+        drawWidgets();
+        Render2D::EndRecording();
+        Render2D::PopTransform();
+        Render2D::End();
+        const double recordTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(list->GetVerticesCount() == widgetsCount * 2 * 4);
+        CHECK(list->GetIndicesCount() == widgetsCount * 2 * 6);
+        CHECK(list->GetDrawCallsCount() == 1);
+
+        startTime = Platform::GetTimeSeconds();
+        Render2D::Begin(context, output);
+        Render2D::PushTransform(transform);
+        Render2D::DrawCommandList(list);
+        Render2D::PopTransform();
+        Render2D::End();
+        const double replayTime = Platform::GetTimeSeconds() - startTime;
+
+        LOG(Info, "Render2D command list benchmark: {0} widgets, immediate: {1} ms, record: {2} ms, replay: {3} ms", widgetsCount, immediateTime * 1000.0, recordTime * 1000.0, replayTime * 1000.0);
+
+        list->Clear();
+        CHECK(list->IsEmpty());
+        list->DeleteObjectNow();
+        SAFE_DELETE_GPU_RESOURCE(output);
+    }
+    SECTION("Test Command List Replay")
+    {
+        if (GPUDevice::Instance == nullptr || GPUDevice::Instance->GetRendererType() != RendererType::Null)
+            return;
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        GPUTexture* output = GPUDevice::Instance->CreateTexture(TEXT("Test Render2D"));
+        REQUIRE(!output->Init(GPUTextureDescription::New2D(256, 256, PixelFormat::R8G8B8A8_UNorm)));
+        auto list = Render2DCommandList::Spawn(ScriptingObject::SpawnParams(Guid::New(), Render2DCommandList::TypeInitializer));
+        auto immediate = Render2DCommandList::Spawn(ScriptingObject::SpawnParams(Guid::New(), Render2DCommandList::TypeInitializer));
+        auto replayed = Render2DCommandList::Spawn(ScriptingObject::SpawnParams(Guid::New(), Render2DCommandList::TypeInitializer));
+        const auto draw = []()
+        {
+            Render2D::FillRectangle(Rectangle(2.0f, 4.0f, 30.0f, 20.0f), Color(0.2f, 0.4f, 0.6f, 0.8f));
+            Render2D::PushClip(Rectangle(0.0f, 0.0f, 20.0f, 20.0f));
+            Render2D::FillRectangle(Rectangle(10.0f, 12.0f, 16.0f, 8.0f), Color(1.0f, 0.5f, 0.25f, 1.0f));
+            Render2D::PopClip();
+        };
+        const Matrix3x3 transform = Matrix3x3::Translation2D(Float2(10.0f, 20.0f));
+        const Color tint(0.5f, 1.0f, 0.25f, 0.5f);
+
+        // Capture the drawing done directly with the transformation and tint (outer recording keeps the transformed vertices)
+        Render2D::Begin(context, output);
+        Render2D::BeginRecording(immediate);
+        Render2D::PushTransform(transform);
+        Render2D::PushTint(tint);
+        draw();
+        Render2D::PopTint();
+        Render2D::PopTransform();
+        Render2D::EndRecording();
+
+        // Capture the replay of the list recorded in the local space
+        Render2D::BeginRecording(list);
+        draw();
+        Render2D::EndRecording();
+        Render2D::BeginRecording(replayed);
+        Render2D::PushTransform(transform);
+        Render2D::PushTint(tint);
+        Render2D::DrawCommandList(list);
+        Render2D::PopTint();
+        Render2D::PopTransform();
+        Render2D::EndRecording();
+        Render2D::End();
+
+        // Replayed vertices (positions, tint and clipping) match the immediate drawing
+        REQUIRE(replayed->GetVerticesCount() == immediate->GetVerticesCount());
+        CHECK(replayed->GetIndicesCount() == immediate->GetIndicesCount());
+        CHECK(Platform::MemoryCompare(replayed->GetVertices().Get(), immediate->GetVertices().Get(), immediate->GetVertices().Count()) == 0);
+
+        // Lists get outdated after the used resources change and are not drawn
+        CHECK(!list->IsOutdated());
+        Render2DCommandList::InvalidateAll();
+        CHECK(list->IsOutdated());
+        Render2D::Begin(context, output);
+        Render2D::BeginRecording(replayed);
+        Render2D::DrawCommandList(list);
+        Render2D::EndRecording();
+        Render2D::End();
+        CHECK(replayed->IsEmpty());
+
+        list->DeleteObjectNow();
+        immediate->DeleteObjectNow();
+        replayed->DeleteObjectNow();
+        SAFE_DELETE_GPU_RESOURCE(output);
+    }
+}
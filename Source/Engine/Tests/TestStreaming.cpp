@@ -0,0 +1,148 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/Texture.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Models/ModelData.h"
+#include "Engine/Graphics/Textures/StreamingTexture.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Streaming")
+{
+    SECTION("Test Texture Mip Demand")
+    {
+        // Quad of size 100x100 mapped to the whole UVs space
+        MeshData mesh;
+        mesh.Positions = { Float3(0, 0, 0), Float3(100, 0, 0), Float3(100, 0, 100), Float3(0, 0, 100) };
+        mesh.UVs = { Float2(0, 0), Float2(1, 0), Float2(1, 1), Float2(0, 1) };
+        mesh.Indices = { 0, 1, 2, 0, 2, 3 };
+        const float uvDensity = mesh.CalculateUVDensity();
+        CHECK(Math::NearEqual(uvDensity, 0.01f));
+        mesh.UVs.Clear();
+        CHECK(mesh.CalculateUVDensity() == 0.0f);
+
+        // View with 90 degrees FOV and 1024 pixels height (512 pixels per world unit at distance 1)
+        RenderView view;
+        view.Position = Float3::Zero;
+        view.Near = 10.0f;
+        Matrix::PerspectiveFov(PI * 0.5f, 1.0f, view.Near, 100000.0f, view.Projection);
+        view.ScreenSize = Float4(1024, 1024, 1.0f / 1024, 1.0f / 1024);
+
+        // Mip levels for 256x256 texture (texels per screen pixel is distance / 200)
+        const auto getMip = [&](float distance, float radius, float scale)
+        {
+            const float uvScreenDensity = RenderTools::ComputeUVScreenDensity(view, Float3(0, 0, distance), radius, uvDensity / scale);
+            return RenderTools::ComputeTextureMip(256, uvScreenDensity);
+        };
+        CHECK(getMip(100.0f, 0.0f, 1.0f) == 0);
+        CHECK(getMip(300.0f, 0.0f, 1.0f) == 0);
+        CHECK(getMip(600.0f, 0.0f, 1.0f) == 1);
+        CHECK(getMip(2000.0f, 0.0f, 1.0f) == 3);
+        CHECK(getMip(100000.0f, 0.0f, 1.0f) == 8);
+        CHECK(getMip(600.0f, 0.0f, 2.0f) == 0); // Scaled object
+        CHECK(getMip(2000.0f, 1900.0f, 1.0f) == 0); // Camera close to the large object bounds
+        CHECK(RenderTools::ComputeUVScreenDensity(view, Float3(0, 0, 100), 0.0f, 0.0f) == 0.0f);
+
+        // Accumulate requests from many threads
+        auto texture = Content::CreateVirtualAsset<Texture>();
+        REQUIRE(texture);
+        auto initData = New<TextureBase::InitData>();
+        initData->Format = PixelFormat::R8G8B8A8_UNorm;
+        initData->Width = 256;
+        initData->Height = 256;
+        initData->ArraySize = 1;
+        initData->Mips.Resize(9);
+        for (int32 mipIndex = 0; mipIndex < initData->Mips.Count(); mipIndex++)
+        {
+            auto& mip = initData->Mips[mipIndex];
+            const int32 mipSize = 256 >> mipIndex;
+            mip.RowPitch = mipSize * 4;
+            mip.SlicePitch = mip.RowPitch * mipSize;
+            mip.Data.Allocate(mip.SlicePitch);
+        }
+        REQUIRE(!texture->Init(initData));
+        const StreamingTexture* streamingTexture = texture->StreamingTexture();
+        CHECK(streamingTexture->FlushRequestedMip() == MAX_int32);
+        const int32 threadsCount = 8;
+        Thread* threads[threadsCount];
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            Function<int32()> f = [i, streamingTexture]()
+            {
+                for (int32 j = 0; j < 10000; j++)
+                    streamingTexture->RequestMip(i + 1 + j % 8);
+                return 0;
+            };
+            threads[i] = ThreadSpawner::Start(f, String::Format(TEXT("Test Streaming {0}"), i));
+        }
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            threads[i]->Join();
+            Delete(threads[i]);
+        }
+        CHECK(streamingTexture->FlushRequestedMip() == 1);
+        CHECK(streamingTexture->FlushRequestedMip() == MAX_int32);
+
+        // Request from the on-screen size
+        streamingTexture->RequestUVScreenDensity(RenderTools::ComputeUVScreenDensity(view, Float3(0, 0, 2000.0f), 0.0f, uvDensity));
+        streamingTexture->RequestUVScreenDensity(RenderTools::ComputeUVScreenDensity(view, Float3(0, 0, 600.0f), 0.0f, uvDensity));
+        CHECK(streamingTexture->FlushRequestedMip() == 1);
+
+        // Use that doesn't report the on-screen size (eg. skinned mesh or UI) requests the full quality
+        streamingTexture->RequestUVScreenDensity(RenderTools::ComputeUVScreenDensity(view, Float3(0, 0, 2000.0f), 0.0f, uvDensity));
+        streamingTexture->RequestMip(0);
+        CHECK(streamingTexture->FlushRequestedMip() == 0);
+
+        Content::DeleteAsset(texture);
+    }
+    SECTION("Test Model LOD Demand")
+    {
+        auto model = Content::CreateVirtualAsset<Model>();
+        REQUIRE(model);
+        CHECK(model->GetUsedLOD() == -1);
+        CHECK(model->UpdateUsedLOD(0.0, 10.0f) == MAX_int32);
+
+        // Accumulate requests from many threads
+        const int32 threadsCount = 8;
+        Thread* threads[threadsCount];
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            Function<int32()> f = [i, model]()
+            {
+                for (int32 j = 0; j < 10000; j++)
+                    model->RequestLOD(i + 2 + j % 4);
+                return 0;
+            };
+            threads[i] = ThreadSpawner::Start(f, String::Format(TEXT("Test Streaming {0}"), i));
+        }
+        for (int32 i = 0; i < threadsCount; i++)
+        {
+            threads[i]->Join();
+            Delete(threads[i]);
+        }
+        CHECK(model->UpdateUsedLOD(1.0, 10.0f) == 2);
+        CHECK(model->GetUsedLOD() == 2);
+
+        // Higher quality LOD is used at once
+        model->RequestLOD(1);
+        CHECK(model->UpdateUsedLOD(2.0, 10.0f) == 1);
+
+        // Lower quality LOD (or none) is used only after the timeout
+        model->RequestLOD(3);
+        CHECK(model->UpdateUsedLOD(5.0, 10.0f) == 1);
+        model->RequestLOD(3);
+        CHECK(model->UpdateUsedLOD(12.0, 10.0f) == 3);
+        CHECK(model->UpdateUsedLOD(15.0, 10.0f) == 3);
+        CHECK(model->UpdateUsedLOD(22.0, 10.0f) == MAX_int32);
+        CHECK(model->GetUsedLOD() == -1);
+
+        // Negative LOD index is clamped
+        model->RequestLOD(-1);
+        CHECK(model->UpdateUsedLOD(23.0, 10.0f) == 0);
+
+        Content::DeleteAsset(model);
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Math/Color.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Terrain/Terrain.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Terrain")
+{
+    SECTION("Test Height Queries")
+    {
+        // Setup a single patch terrain with the slope along X axis
+        const int32 chunkSize = 15;
+        const int32 heightMapSize = chunkSize * 4 + 1;
+        auto terrain = Terrain::Spawn(ScriptingObject::SpawnParams(Guid::New(), Terrain::TypeInitializer));
+        terrain->Setup(1, chunkSize);
+        terrain->AddPatch(Int2::Zero);
+        Array<float> heightMap;
+        heightMap.Resize(heightMapSize * heightMapSize);
+        for (int32 z = 0; z < heightMapSize; z++)
+        {
+            for (int32 x = 0; x < heightMapSize; x++)
+                heightMap[z * heightMapSize + x] = (float)x * 10.0f;
+        }
+        REQUIRE(!terrain->SetupPatchHeightMap(Int2::Zero, heightMap.Count(), heightMap.Get(), nullptr, true));
+
+        // Queries are disabled by default
+        float height;
+        CHECK(!terrain->GetHeight(Vector3(100, 0, 100), height));
+        CHECK(terrain->GetHeightDataMemoryUsage() == 0);
+        terrain->SetRetainHeightData(true);
+
+        // Point queries
+        REQUIRE(terrain->GetHeight(Vector3(150, 0, 100), height));
+        CHECK(Math::NearEqual(height, 15.0f, 0.1f));
+        CHECK(terrain->GetHeightDataMemoryUsage() >= heightMap.Count() * sizeof(uint16));
+        CHECK(!terrain->GetHeight(Vector3(-100, 0, 100), height));
+        Float3 normal;
+        REQUIRE(terrain->GetNormal(Vector3(150, 0, 100), normal));
+        CHECK(Float3::NearEqual(normal, Float3(-0.1f, 1.0f, 0.0f).GetNormalized(), 0.01f));
+        Color splatmap0, splatmap1;
+        REQUIRE(terrain->GetSplatWeights(Vector3(150, 0, 100), splatmap0, splatmap1));
+        CHECK(Math::NearEqual(splatmap0.R, 1.0f));
+
+        // Transformed terrain
+        terrain->SetLocalPosition(Vector3(0, 1000, 0));
+        terrain->SetLocalScale(Float3(2.0f));
+        REQUIRE(terrain->GetHeight(Vector3(300, 0, 200), height));
+        CHECK(Math::NearEqual(height, 1030.0f, 0.2f));
+
+        // Batched queries match the point queries
+        const int32 count = 100000;
+        const float size = heightMapSize * TERRAIN_UNITS_PER_VERTEX * 2.0f;
+        Array<Vector3> positions;
+        Array<float> heights;
+        positions.Resize(count);
+        heights.Resize(count);
+        RandomStream random(0);
+        for (int32 i = 0; i < count; i++)
+            positions[i] = Vector3(random.GetFraction() * size * 1.2f - size * 0.1f, 0, random.GetFraction() * size);
+        const double startTime = Platform::GetTimeSeconds();
+        const int32 hits = terrain->GetHeights(ToSpan(positions.Get(), count), ToSpan(heights.Get(), count));
+        const double batchTime = Platform::GetTimeSeconds() - startTime;
+        CHECK(hits > 0);
+        CHECK(hits < count);
+        int32 pointHits = 0;
+        bool isMatching = true;
+        for (int32 i = 0; i < count; i++)
+        {
+            if (terrain->GetHeight(positions[i], height))
+            {
+                pointHits++;
+                isMatching &= Math::NearEqual(height, heights[i], 0.01f);
+            }
+            else
+            {
+                isMatching &= heights[i] == MIN_float;
+            }
+        }
+        CHECK(isMatching);
+        CHECK(pointHits == hits);
+        LOG(Info, "Terrain height queries benchmark: {0} positions sampled in {1} ms", count, batchTime * 1000.0);
+
+        // Disabling releases the data
+        terrain->SetRetainHeightData(false);
+        CHECK(terrain->GetHeightDataMemoryUsage() == 0);
+
+        terrain->DeleteObjectNow();
+    }
+    SECTION("Test Height Queries Holes")
+    {
+        // Setup a flat terrain with a hole made of vertices 20-24 on both axes
+        const int32 chunkSize = 15;
+        const int32 heightMapSize = chunkSize * 4 + 1;
+        auto terrain = Terrain::Spawn(ScriptingObject::SpawnParams(Guid::New(), Terrain::TypeInitializer));
+        terrain->Setup(1, chunkSize);
+        terrain->AddPatch(Int2::Zero);
+        Array<float> heightMap;
+        Array<byte> holesMask;
+        heightMap.Resize(heightMapSize * heightMapSize);
+        holesMask.Resize(heightMapSize * heightMapSize);
+        for (int32 z = 0; z < heightMapSize; z++)
+        {
+            for (int32 x = 0; x < heightMapSize; x++)
+            {
+                const int32 i = z * heightMapSize + x;
+                heightMap[i] = 50.0f;
+                holesMask[i] = x >= 20 && x <= 24 && z >= 20 && z <= 24 ? 0 : 255;
+            }
+        }
+        REQUIRE(!terrain->SetupPatchHeightMap(Int2::Zero, heightMap.Count(), heightMap.Get(), holesMask.Get(), true));
+        terrain->SetRetainHeightData(true);
+
+        // Cells with any hole vertex are not over the terrain
+        float height;
+        Float3 normal;
+        Color splatmap0, splatmap1;
+        REQUIRE(terrain->GetHeight(Vector3(1050, 0, 1050), height));
+        CHECK(Math::NearEqual(height, 50.0f, 0.1f));
+        CHECK(!terrain->GetHeight(Vector3(2250, 0, 2250), height));
+        CHECK(!terrain->GetHeight(Vector3(1950, 0, 2250), height));
+        CHECK(!terrain->GetHeight(Vector3(2450, 0, 2450), height));
+        CHECK(terrain->GetHeight(Vector3(2550, 0, 2250), height));
+        CHECK(!terrain->GetNormal(Vector3(2250, 0, 2250), normal));
+        CHECK(!terrain->GetSplatWeights(Vector3(2250, 0, 2250), splatmap0, splatmap1));
+
+        // Batched queries skip the holes
+        Vector3 positions[4] = { Vector3(1050, 0, 1050), Vector3(2250, 0, 2250), Vector3(1950, 0, 2250), Vector3(2550, 0, 2250) };
+        float heights[4];
+        CHECK(terrain->GetHeights(ToSpan(positions, 4), ToSpan(heights, 4)) == 2);
+        CHECK(Math::NearEqual(heights[0], 50.0f, 0.1f));
+        CHECK(heights[1] == MIN_float);
+        CHECK(heights[2] == MIN_float);
+        CHECK(Math::NearEqual(heights[3], 50.0f, 0.1f));
+
+        terrain->DeleteObjectNow();
+    }
+}
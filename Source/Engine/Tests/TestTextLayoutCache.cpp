@@ -0,0 +1,133 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Content/Content.h"
+#include "Engine/Render2D/Font.h"
+#include "Engine/Render2D/FontAsset.h"
+#include "Engine/Render2D/TextLayoutCache.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("TextLayoutCache")
+{
+    SECTION("Test Hits And Eviction")
+    {
+        const int32 capacity = TextLayoutCache::Capacity;
+        TextLayoutCache::Capacity = 2;
+        TextLayoutCache::Clear();
+        TextLayoutCache::ResetStats();
+
+        // Cache is keyed by the font pointer so the fake fonts are enough
+        const Font* fontA = (const Font*)(uintptr)0x1000;
+        const Font* fontB = (const Font*)(uintptr)0x2000;
+        TextLayoutOptions layout;
+        FontLineCache line;
+        line.Location = Float2(1, 2);
+        line.Size = Float2(30, 10);
+        line.FirstCharIndex = 0;
+        line.LastCharIndex = 2;
+        Array<Float2> glyphs;
+        glyphs.Add(Float2(1, 2));
+        glyphs.Add(Float2(11, 2));
+        glyphs.Add(Float2(21, 2));
+
+        Array<FontLineCache> lines;
+        Array<Float2> outputGlyphs;
+        CHECK(!TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, &outputGlyphs));
+        TextLayoutCache::Add(fontA, TEXT("abc"), layout, &line, 1, glyphs, 0.001);
+        CHECK(TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, &outputGlyphs));
+        CHECK(lines.Count() == 1);
+        CHECK(lines[0].Size == line.Size);
+        CHECK(outputGlyphs.Count() == 3);
+        CHECK(outputGlyphs[2] == glyphs[2]);
+
+        // Different text, font or layout is a miss
+        CHECK(!TextLayoutCache::TryGet(fontA, TEXT("abd"), layout, lines, nullptr));
+        CHECK(!TextLayoutCache::TryGet(fontB, TEXT("abc"), layout, lines, nullptr));
+        layout.Scale = 2.0f;
+        CHECK(!TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, nullptr));
+        layout.Scale = 1.0f;
+
+        // Moved text (bounds location) reuses the layout (lines and glyphs are relative to the bounds)
+        layout.Bounds.Location = Float2(100, 50);
+        CHECK(TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, nullptr));
+        layout.Bounds.Location = Float2::Zero;
+
+        // The least recently used layout gets evicted
+        TextLayoutCache::Add(fontB, TEXT("abc"), layout, &line, 1, glyphs, 0.001);
+        CHECK(TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, nullptr));
+        TextLayoutCache::Add(fontA, TEXT("xyz"), layout, &line, 1, glyphs, 0.001);
+        CHECK(!TextLayoutCache::TryGet(fontB, TEXT("abc"), layout, lines, nullptr));
+        CHECK(TextLayoutCache::TryGet(fontA, TEXT("abc"), layout, lines, nullptr));
+        CHECK(TextLayoutCache::TryGet(fontA, TEXT("xyz"), layout, lines, nullptr));
+
+        // Font invalidation removes only its layouts
+        TextLayoutCache::Add(fontB, TEXT("abc"), layout, &line, 1, glyphs, 0.001);
+        TextLayoutCache::Invalidate(fontA);
+        CHECK(!TextLayoutCache::TryGet(fontA, TEXT("xyz"), layout, lines, nullptr));
+        CHECK(TextLayoutCache::TryGet(fontB, TEXT("abc"), layout, lines, nullptr));
+
+        const TextLayoutCacheStats stats = TextLayoutCache::GetStats();
+        CHECK(stats.Hits == 6);
+        CHECK(stats.Misses == 6);
+        CHECK(stats.Evictions == 2);
+        CHECK(stats.Count == 1);
+        CHECK(stats.MemoryUsage > 0);
+        CHECK(Math::NearEqual((float)stats.TimeSavedMs, 6.0f));
+
+        TextLayoutCache::Capacity = capacity;
+        TextLayoutCache::Clear();
+        TextLayoutCache::ResetStats();
+    }
+
+    SECTION("Test Cached Layout Matches Uncached")
+    {
+        // Use the engine font (skip if tests run without the engine content)
+        FontAsset* fontAsset = Content::LoadAsyncInternal<FontAsset>(TEXT("Editor/Fonts/Roboto-Regular"));
+        if (fontAsset == nullptr || fontAsset->WaitForLoaded())
+            return;
+        Font* font = fontAsset->CreateFont(12);
+        REQUIRE(font);
+        const StringView text = TEXT("Cached text layout\nwith multiple lines and wrapping of the long words");
+        TextLayoutOptions layout;
+        layout.Bounds = Rectangle(10, 20, 120, 200);
+        layout.TextWrapping = TextWrapping::WrapWords;
+        const int32 capacity = TextLayoutCache::Capacity;
+        TextLayoutCache::Clear();
+
+        // Process the text (first time caches the layout) and then reuse it, also for the moved text
+        for (int32 i = 0; i < 2; i++)
+        {
+            TextLayoutCache::Capacity = 0;
+            Array<FontLineCache> uncachedLines;
+            Array<Float2> uncachedGlyphs;
+            font->ProcessText(text, uncachedLines, uncachedGlyphs, layout);
+            TextLayoutCache::Capacity = Math::Max(capacity, 1);
+            Array<FontLineCache> lines;
+            Array<Float2> glyphs;
+            font->ProcessText(text, lines, glyphs, layout);
+            lines.Clear();
+            glyphs.Clear();
+            const int64 hits = TextLayoutCache::GetStats().Hits;
+            font->ProcessText(text, lines, glyphs, layout);
+            CHECK(TextLayoutCache::GetStats().Hits == hits + 1);
+
+            REQUIRE(lines.Count() == uncachedLines.Count());
+            CHECK(lines.Count() > 2);
+            for (int32 j = 0; j < lines.Count(); j++)
+            {
+                CHECK(lines[j].Location == uncachedLines[j].Location);
+                CHECK(lines[j].Size == uncachedLines[j].Size);
+                CHECK(lines[j].FirstCharIndex == uncachedLines[j].FirstCharIndex);
+                CHECK(lines[j].LastCharIndex == uncachedLines[j].LastCharIndex);
+            }
+            REQUIRE(glyphs.Count() == uncachedGlyphs.Count());
+            for (int32 j = 0; j < glyphs.Count(); j++)
+                CHECK(glyphs[j] == uncachedGlyphs[j]);
+
+            layout.Bounds.Location = Float2(300, 400);
+        }
+
+        TextLayoutCache::Capacity = capacity;
+        TextLayoutCache::Clear();
+        TextLayoutCache::ResetStats();
+    }
+}
@@ -1544,6 +1544,13 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
         }
     }
 
+    // Calculate meshes UVs density (used by textures streaming)
+    for (auto& lod : meshData.LODs)
+    {
+        for (auto& mesh : lod.Meshes)
+            mesh->UVDensity = mesh->CalculateUVDensity();
+    }
+
     const auto endTime = DateTime::NowUTC();
     LOG(Info, "Model file imported in {0} ms", static_cast<int32>((endTime - startTime).GetTotalMilliseconds()));
 
@@ -31,6 +31,8 @@ public class ContainerControl : Control
 
         private bool _clipChildren = true;
         private bool _cullChildren = true;
+        private Render2DCommandList _drawCache;
+        private bool _isDrawCacheDirty;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="ContainerControl"/> class.
@@ -115,6 +117,29 @@ public bool CullChildren
             set => _cullChildren = value;
         }
 
+        /// <summary>
+        /// Gets or sets a value indicating whether cache the drawing of the control and its children. Cached drawing is replayed with only the transformation, tint and clipping update which is much faster for static UI. Children layout, visibility and collection changes invalidate the cache automatically, other appearance changes need to call <see cref="Control.InvalidateDrawCache"/>.
+        /// </summary>
+        [EditorOrder(550), Tooltip("If checked, control will cache the drawing of itself and its children and replay it during rendering. Use it for static UI.")]
+        public bool CacheDrawing
+        {
+            get => _drawCache != null;
+            set
+            {
+                if (value == CacheDrawing)
+                    return;
+                if (value)
+                {
+                    _drawCache = new Render2DCommandList();
+                    _isDrawCacheDirty = true;
+                }
+                else
+                {
+                    Object.Destroy(ref _drawCache);
+                }
+            }
+        }
+
         /// <summary>
         /// Locks all child controls layout and itself.
         /// </summary>
@@ -420,6 +445,8 @@ public virtual void OnChildResized(Control control)
         [NoAnimate]
         public virtual void OnChildrenChanged()
         {
+            InvalidateDrawCache();
+
             // Check if control isn't during disposing state
             if (!IsDisposing)
             {
@@ -717,6 +744,7 @@ public override void OnDestroy()
                 _children[i].OnDestroy();
             }
             _children.Clear();
+            Object.Destroy(ref _drawCache);
         }
 
         /// <inheritdoc />
@@ -754,6 +782,34 @@ public override void Update(float deltaTime)
         /// Draw the control and the children.
         /// </summary>
         public override void Draw()
+        {
+            if (_drawCache != null)
+            {
+                // Replay the cached drawing or record it again after changes (including the used resources changes, eg. font scale)
+                if (!_isDrawCacheDirty && !_drawCache.IsOutdated)
+                {
+                    Render2D.DrawCommandList(_drawCache);
+                    return;
+                }
+                _isDrawCacheDirty = false;
+                Render2D.BeginRecording(_drawCache);
+                DrawSelfAndChildren();
+                Render2D.EndRecording();
+                return;
+            }
+
+            DrawSelfAndChildren();
+        }
+
+        /// <inheritdoc />
+        public override void InvalidateDrawCache()
+        {
+            _isDrawCacheDirty = true;
+
+            base.InvalidateDrawCache();
+        }
+
+        private void DrawSelfAndChildren()
         {
             DrawSelf();
 
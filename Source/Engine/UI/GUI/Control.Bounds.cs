@@ -513,6 +513,8 @@ public void UpdateTransform()
 
             // Cache inverted transform
             Matrix3x3.Invert(ref _cachedTransform, out _cachedTransformInv);
+
+            _parent?.InvalidateDrawCache();
         }
 
         /// <summary>
@@ -275,6 +275,7 @@ public bool Visible
                     }
 
                     OnVisibleChanged();
+                    _parent?.InvalidateDrawCache();
                     _parent?.PerformLayout();
                 }
             }
@@ -444,6 +445,15 @@ public virtual void Draw()
             }
         }
 
+        /// <summary>
+        /// Invalidates the cached drawing of the parent controls (see <see cref="ContainerControl.CacheDrawing"/>). Call it when the control appearance changes so it will be drawn again.
+        /// </summary>
+        [NoAnimate]
+        public virtual void InvalidateDrawCache()
+        {
+            _parent?.InvalidateDrawCache();
+        }
+
         /// <summary>
         /// Update control layout
         /// </summary>
@@ -226,7 +226,7 @@ void TextRender::UpdateLayout()
                         param.SetIsOverride(false);
 
                     // Set the font parameter
-                    static StringView FontParamName = TEXT("Font");
+                    static const Name FontParamName(TEXT("Font"));
                     const auto param = drawChunk.Material->Params.Get(FontParamName);
                     if (param && param->GetParameterType() == MaterialParameterType::Texture)
                     {
@@ -391,9 +391,12 @@ void TextRender::Draw(RenderContext& renderContext)
         drawCall.Geometry.VertexBuffersOffsets[2] = 0;
         drawCall.InstanceCount = 1;
 
-        // Submit draw calls
+        // Submit draw calls (text doesn't compute the on-screen UVs density so don't limit the textures)
+        const bool requestTextures = (drawModes & (DrawPass::GBuffer | DrawPass::Forward)) != 0;
         for (const auto& e : _drawChunks)
         {
+            if (requestTextures)
+                e.Material->Params.RequestTexturesFullQuality();
             drawCall.Draw.IndicesCount = e.IndicesCount;
             drawCall.Draw.StartIndex = e.StartIndex;
             drawCall.Material = e.Material;
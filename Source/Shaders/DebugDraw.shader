@@ -4,7 +4,9 @@
 
 META_CB_BEGIN(0, Data)
 float4x4 ViewProjection;
-float3 Padding;
+float3 PositionOffset;
+float Padding;
+float3 PositionScale;
 bool EnableDepthTest;
 META_CB_END
 
@@ -27,6 +29,19 @@ VS2PS VS(float3 Position : POSITION, float4 Color : COLOR)
 	return output;
 }
 
+// Vertex shader for the vertices with positions quantized within the draw call bounds
+META_VS(true, FEATURE_LEVEL_ES2)
+META_VS_IN_ELEMENT(POSITION, 0, R16G16B16A16_UNORM, 0, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(COLOR,    0, R8G8B8A8_UNORM,     0, ALIGN, PER_VERTEX, 0, true)
+VS2PS VS_Packed(float4 Position : POSITION, float4 Color : COLOR)
+{
+	VS2PS output;
+	float3 position = PositionOffset + Position.xyz * PositionScale;
+	output.Position = mul(float4(position, 1), ViewProjection);
+	output.Color = Color;
+	return output;
+}
+
 void PerformDepthTest(float4 svPosition)
 {
 	// Depth test manually if compositing editor primitives